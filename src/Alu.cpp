@@ -0,0 +1,482 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <SDL_thread.h>
+
+#include "Alu.h"
+
+typedef Cpu8080::CommandProcessingUnit::Registers Registers;
+
+// ------------------------------------------------------------
+// Model.
+// ------------------------------------------------------------
+
+static bool IsEvenParity( Uint8 value )
+{
+	Uint32 bits = 0;
+	for ( ; value; value >>= 1 )
+	{
+		bits += value & 1;
+	}
+	return ( bits & 1 ) == 0;
+}
+
+static inline void SetSignZeroParity( CpuFlags & flags, Uint8 result )
+{
+	flags.s = result >> 7;
+	flags.z = result == 0;
+	flags.p = IsEvenParity( result );
+}
+
+// AC is the carry out of bit 3, i.e. whatever bit 4 of the sum has that the operands don't.
+static Uint8 ModelAdd( Uint8 a, Uint8 operand, Uint8 carry, CpuFlags & flags )
+{
+	const Uint32 sum = a + operand + carry;
+	flags.cy = ( sum >> 8 ) & 1;
+	flags.ac = ( ( a ^ operand ^ sum ) >> 4 ) & 1;
+	SetSignZeroParity( flags, ( Uint8 )sum );
+	return ( Uint8 )sum;
+}
+
+// The 8080 subtracts by adding the complement, so AC is the carry out of bit 3 of that and CY is its carry inverted (a borrow).
+static Uint8 ModelSubtract( Uint8 a, Uint8 operand, Uint8 borrow, CpuFlags & flags )
+{
+	const Uint8 result = ModelAdd( a, ( Uint8 )~operand, borrow ^ 1, flags );
+	flags.cy ^= 1;
+	return result;
+}
+
+// AND sets AC from bit 3 of either operand, OR and XOR clear it.
+static Uint8 ModelLogical( AluOp::T op, Uint8 a, Uint8 operand, CpuFlags & flags )
+{
+	const Uint8 result = op == AluOp::Ana ? a & operand : op == AluOp::Xra ? a ^ operand : a | operand;
+	flags.cy = 0;
+	flags.ac = op == AluOp::Ana ? ( ( a | operand ) >> 3 ) & 1 : 0;
+	SetSignZeroParity( flags, result );
+	return result;
+}
+
+static Uint8 ModelDecimalAdjust( Uint8 a, CpuFlags & flags )
+{
+	Uint8 correction = 0;
+	Uint8 carry = flags.cy;
+	if ( flags.ac || ( a & 0xf ) > 9 )
+	{
+		correction |= 0x06;
+	}
+	if ( flags.cy || ( a >> 4 ) > 9 || ( ( a >> 4 ) >= 9 && ( a & 0xf ) > 9 ) )
+	{
+		correction |= 0x60;
+		carry = 1;
+	}
+
+	const Uint8 result = ModelAdd( a, correction, 0, flags );
+	flags.cy = carry;
+	return result;
+}
+
+Uint8 ModelAlu( AluOp::T op, Uint8 a, Uint8 operand, CpuFlags & flags )
+{
+	switch ( op )
+	{
+		case AluOp::Add:	return ModelAdd( a, operand, 0, flags );
+		case AluOp::Adc:	return ModelAdd( a, operand, flags.cy, flags );
+		case AluOp::Sub:	return ModelSubtract( a, operand, 0, flags );
+		case AluOp::Sbb:	return ModelSubtract( a, operand, flags.cy, flags );
+		case AluOp::Ana:
+		case AluOp::Xra:
+		case AluOp::Ora:	return ModelLogical( op, a, operand, flags );
+		case AluOp::Cmp:	ModelSubtract( a, operand, 0, flags ); return a;
+
+		case AluOp::Inr:
+		{
+			const Uint8 result = operand + 1;
+			flags.ac = ( result & 0xf ) == 0;
+			SetSignZeroParity( flags, result );
+			return result;
+		}
+
+		case AluOp::Dcr:
+		{
+			const Uint8 result = operand - 1;
+			flags.ac = ( result & 0xf ) != 0xf;
+			SetSignZeroParity( flags, result );
+			return result;
+		}
+
+		case AluOp::Daa:	return ModelDecimalAdjust( a, flags );
+
+		case AluOp::Rlc:
+		{
+			flags.cy = a >> 7;
+			return ( Uint8 )( ( a << 1 ) | flags.cy );
+		}
+
+		case AluOp::Rrc:
+		{
+			flags.cy = a & 1;
+			return ( Uint8 )( ( a >> 1 ) | ( flags.cy << 7 ) );
+		}
+
+		case AluOp::Ral:
+		{
+			const Uint8 carry = flags.cy;
+			flags.cy = a >> 7;
+			return ( Uint8 )( ( a << 1 ) | carry );
+		}
+
+		case AluOp::Rar:
+		{
+			const Uint8 carry = flags.cy;
+			flags.cy = a & 1;
+			return ( Uint8 )( ( a >> 1 ) | ( carry << 7 ) );
+		}
+
+		case AluOp::Cma:	return ( Uint8 )~a;
+		case AluOp::Stc:	flags.cy = 1; return a;
+		case AluOp::Cmc:	flags.cy ^= 1; return a;
+
+		default:
+		{
+			assert( 0 );
+			return a;
+		}
+	}
+}
+
+// ------------------------------------------------------------
+// Tables.
+// ------------------------------------------------------------
+
+void BuildAluTables( AluTables & tables )
+{
+	CpuFlags flags;
+	flags.u8 = 0;
+	flags.s = flags.z = flags.ac = flags.p = flags.cy = 1;
+	tables.AllFlags = flags.u8;
+	flags.cy = 0;
+	tables.FlagsButCarry = flags.u8;
+
+	for ( Uint32 op = AluOp::Add; op <= AluOp::Cmp; ++op )
+	{
+		for ( Uint32 ix = 0; ix < 0x20000; ++ix )
+		{
+			flags.u8 = 0;
+			flags.cy = ix >> 16;
+			const Uint8 result = ModelAlu( ( AluOp::T )op, ( Uint8 )( ix >> 8 ), ( Uint8 )ix, flags );
+			tables.Binary[ op ][ ix >> 16 ][ ix & 0xffff ] = ( Uint16 )( result | ( flags.u8 << 8 ) );
+		}
+	}
+
+	for ( Uint32 ix = 0; ix < 0x100; ++ix )
+	{
+		flags.u8 = 0;
+		Uint8 result = ModelAlu( AluOp::Inr, 0, ( Uint8 )ix, flags );
+		tables.Inr[ ix ] = ( Uint16 )( result | ( flags.u8 << 8 ) );
+
+		flags.u8 = 0;
+		result = ModelAlu( AluOp::Dcr, 0, ( Uint8 )ix, flags );
+		tables.Dcr[ ix ] = ( Uint16 )( result | ( flags.u8 << 8 ) );
+	}
+
+	for ( Uint32 ix = 0; ix < 0x400; ++ix )
+	{
+		flags.u8 = 0;
+		flags.cy = ix >> 9;
+		flags.ac = ( ix >> 8 ) & 1;
+		const Uint8 result = ModelAlu( AluOp::Daa, ( Uint8 )ix, 0, flags );
+		tables.Daa[ ix ] = ( Uint16 )( result | ( flags.u8 << 8 ) );
+	}
+}
+
+const AluTables * g_AluTables = NULL;
+
+void InitAluTables( )
+{
+	if ( g_AluTables )
+		return;
+
+	AluTables * tables = new AluTables;
+	BuildAluTables( *tables );
+	g_AluTables = tables;
+}
+
+bool SaveAluTables( const char * file, const AluTables & tables )
+{
+	FILE * fh = NULL;
+	if ( fopen_s( &fh, file, "wb" ) != 0 )
+		return false;
+
+	const bool written = fwrite( &tables, sizeof( tables ), 1, fh ) == 1;
+	fclose( fh );
+	return written;
+}
+
+// ------------------------------------------------------------
+// Verifier.
+// ------------------------------------------------------------
+
+// Where an opcode's operand comes from, besides the registers (Registers::Gpr::T, with ___MEMORY for M).
+static const int kOperandImmediate = -1;
+static const int kOperandNone = -2;
+
+// Mismatches printed per opcode.
+static const Uint32 kAluMismatchesShown = 4;
+
+// Every case runs the one instruction at kAluTestPc, with HL (when it isn't the operand) pointing at kAluTestM.
+static const address kAluTestPc = 0x0100;
+static const address kAluTestM = 0x8000;
+
+struct AluOpcode
+{
+	Uint8		Opcode;
+	AluOp::T	Op;
+	int			Operand;
+	char		Name[ 8 ];
+};
+
+static void ListAluOpcodes( std::vector< AluOpcode > & opcodes )
+{
+	static const char * kRegNames = "BCDEHLMA";
+	static const char * kBinaryNames[ ] = { "ADD", "ADC", "SUB", "SBB", "ANA", "XRA", "ORA", "CMP" };
+	static const char * kImmediateNames[ ] = { "ADI", "ACI", "SUI", "SBI", "ANI", "XRI", "ORI", "CPI" };
+
+	AluOpcode opcode;
+	for ( int op = AluOp::Add; op <= AluOp::Cmp; ++op )
+	{
+		for ( int reg = 0; reg < 8; ++reg )
+		{
+			opcode.Opcode = ( Uint8 )( 0x80 + op * 8 + reg );
+			opcode.Op = ( AluOp::T )op;
+			opcode.Operand = reg;
+			sprintf_s( opcode.Name, sizeof( opcode.Name ), "%s %c", kBinaryNames[ op ], kRegNames[ reg ] );
+			opcodes.push_back( opcode );
+		}
+
+		opcode.Opcode = ( Uint8 )( 0xc6 + op * 8 );
+		opcode.Operand = kOperandImmediate;
+		sprintf_s( opcode.Name, sizeof( opcode.Name ), "%s", kImmediateNames[ op ] );
+		opcodes.push_back( opcode );
+	}
+
+	for ( int reg = 0; reg < 8; ++reg )
+	{
+		opcode.Opcode = ( Uint8 )( 0x04 + reg * 8 );
+		opcode.Op = AluOp::Inr;
+		opcode.Operand = reg;
+		sprintf_s( opcode.Name, sizeof( opcode.Name ), "INR %c", kRegNames[ reg ] );
+		opcodes.push_back( opcode );
+
+		opcode.Opcode = ( Uint8 )( 0x05 + reg * 8 );
+		opcode.Op = AluOp::Dcr;
+		sprintf_s( opcode.Name, sizeof( opcode.Name ), "DCR %c", kRegNames[ reg ] );
+		opcodes.push_back( opcode );
+	}
+
+	static const AluOpcode kAccumulatorOpcodes[ ] =
+	{
+		{ 0x27, AluOp::Daa, kOperandNone, "DAA" },
+		{ 0x07, AluOp::Rlc, kOperandNone, "RLC" },
+		{ 0x0f, AluOp::Rrc, kOperandNone, "RRC" },
+		{ 0x17, AluOp::Ral, kOperandNone, "RAL" },
+		{ 0x1f, AluOp::Rar, kOperandNone, "RAR" },
+		{ 0x2f, AluOp::Cma, kOperandNone, "CMA" },
+		{ 0x37, AluOp::Stc, kOperandNone, "STC" },
+		{ 0x3f, AluOp::Cmc, kOperandNone, "CMC" },
+	};
+	opcodes.insert( opcodes.end( ), kAccumulatorOpcodes, kAccumulatorOpcodes + sizeof( kAccumulatorOpcodes ) / sizeof( kAccumulatorOpcodes[ 0 ] ) );
+}
+
+static inline bool IsBinary( AluOp::T op )
+{
+	return op <= AluOp::Cmp;
+}
+
+// The register (or memory) an operand or INR/DCR result lives in.
+static Uint8 & OperandLocation( Cpu8080 & chip8, Uint8 * memory, int operand )
+{
+	Registers & regs = chip8.Cpu.Regs;
+	if ( operand == Registers::Gpr::___ACCUMULATOR )
+		return regs.accumulator;
+	if ( operand == Registers::Gpr::___MEMORY )
+		return memory[ kAluTestM ];
+	if ( operand == kOperandImmediate )
+		return memory[ kAluTestPc + 1 ];
+	return regs.gpr[ RegIndex( operand ) ];
+}
+
+static void FormatFlags( CpuFlags flags, char * text )
+{
+	text[ 0 ] = flags.s ? 'S' : '.';
+	text[ 1 ] = flags.z ? 'Z' : '.';
+	text[ 2 ] = flags.ac ? 'A' : '.';
+	text[ 3 ] = flags.p ? 'P' : '.';
+	text[ 4 ] = flags.cy ? 'C' : '.';
+	text[ 5 ] = 0;
+}
+
+struct AluJob
+{
+	const CpuEngine *					Engine;
+	const std::vector< AluOpcode > *	Opcodes;
+	SDL_mutex *							Lock;
+	size_t								NextOpcode;
+	AluReport *							Report;
+};
+
+// Runs one opcode for every input, returning the number of cases and mismatches.
+static void VerifyOpcode( AluJob & shared, const AluOpcode & opcode, Cpu8080 & chip8, Uint8 * memory, Uint64 & cases, Uint64 & mismatches )
+{
+	Registers & regs = chip8.Cpu.Regs;
+
+	// Binary ops take every accumulator, operand and carry in (the other flags are a mix, as they shouldn't matter),
+	// the rest every value and flags byte.
+	const bool binary = IsBinary( opcode.Op );
+	const Uint32 numInputs = binary ? 0x20000 : 0x10000;
+	for ( Uint32 ix = 0; ix < numInputs; ++ix )
+	{
+		Uint8 a;
+		Uint8 operand;
+		CpuFlags flags;
+		if ( binary )
+		{
+			a = ( Uint8 )( ix >> 8 );
+			operand = ( Uint8 )ix;
+			flags.u8 = ( Uint8 )( ( ix * 2654435761u ) >> 24 );
+			flags.cy = ix >> 16;
+		}
+		else
+		{
+			a = ( Uint8 )ix;
+			operand = ( Uint8 )ix;
+			flags.u8 = ( Uint8 )( ix >> 8 );
+			if ( opcode.Op == AluOp::Inr || opcode.Op == AluOp::Dcr )
+			{
+				a = ( Uint8 )~ix;
+			}
+		}
+
+		// The accumulator as the operand.
+		if ( opcode.Operand == Registers::Gpr::___ACCUMULATOR )
+		{
+			if ( a != operand && binary )
+				continue;
+			a = operand;
+		}
+
+		// Fill the registers with something the op shouldn't touch, then the inputs.
+		for ( size_t reg = 0; reg < Registers::Gpr::___MEMORY; ++reg )
+		{
+			regs.gpr[ reg ] = ( Uint8 )( 0x11 * ( reg + 1 ) );
+		}
+		regs.gprPair[ Registers::GprPair::HL ] = kAluTestM;
+		regs.pc = kAluTestPc;
+		regs.sp = 0xf000;
+		regs.accumulator = a;
+		regs.flags = flags;
+		memory[ kAluTestPc ] = opcode.Opcode;
+		if ( opcode.Operand != kOperandNone )
+		{
+			OperandLocation( chip8, memory, opcode.Operand ) = operand;
+		}
+
+		CpuFlags expectedFlags = flags;
+		const Uint8 expected = ModelAlu( opcode.Op, a, operand, expectedFlags );
+
+		shared.Engine->Step( chip8 );
+		cases++;
+
+		const bool inPlace = opcode.Op == AluOp::Inr || opcode.Op == AluOp::Dcr;
+		const Uint8 actual = inPlace ? OperandLocation( chip8, memory, opcode.Operand ) : regs.accumulator;
+		if ( actual == expected && regs.flags.u8 == expectedFlags.u8 && regs.pc == kAluTestPc + InstructionSize[ opcode.Opcode ] )
+			continue;
+
+		if ( mismatches++ < kAluMismatchesShown )
+		{
+			char flagsIn[ 6 ];
+			char flagsExpected[ 6 ];
+			char flagsActual[ 6 ];
+			FormatFlags( flags, flagsIn );
+			FormatFlags( expectedFlags, flagsExpected );
+			FormatFlags( regs.flags, flagsActual );
+
+			SDL_LockMutex( shared.Lock );
+			printf( "%-6s a %02x operand %02x flags %s (%02x): expected %02x %s (%02x) actual %02x %s (%02x) pc %04x\n", opcode.Name, a, operand, flagsIn, flags.u8,
+				expected, flagsExpected, expectedFlags.u8, actual, flagsActual, regs.flags.u8, regs.pc );
+			SDL_UnlockMutex( shared.Lock );
+		}
+	}
+}
+
+static int SDLCALL AluThread( void * userData )
+{
+	AluJob & shared = *( AluJob * )userData;
+
+	// Flat memory, so the instruction can sit anywhere and M can be written.
+	std::vector< Uint8 > memory( 0x10000 + 2, 0 );
+	Cpu8080 * chip8 = new Cpu8080;
+	chip8->Memory.Flat = &memory[ 0 ];
+	chip8->Memory.Rom = &memory[ 0 ];
+	chip8->HleEnabled = false;
+	chip8->InterruptsEnabled = false;
+
+	for ( ; ; )
+	{
+		SDL_LockMutex( shared.Lock );
+		size_t ix = shared.NextOpcode++;
+		SDL_UnlockMutex( shared.Lock );
+
+		if ( ix >= shared.Opcodes->size( ) )
+			break;
+
+		const AluOpcode & opcode = ( *shared.Opcodes )[ ix ];
+		Uint64 cases = 0;
+		Uint64 mismatches = 0;
+		VerifyOpcode( shared, opcode, *chip8, &memory[ 0 ], cases, mismatches );
+
+		SDL_LockMutex( shared.Lock );
+		if ( mismatches > kAluMismatchesShown )
+		{
+			printf( "%-6s and %llu more mismatches\n", opcode.Name, ( unsigned long long )( mismatches - kAluMismatchesShown ) );
+		}
+		shared.Report->Cases += cases;
+		shared.Report->Mismatches += mismatches;
+		shared.Report->OpcodesMismatched += mismatches ? 1 : 0;
+		SDL_UnlockMutex( shared.Lock );
+	}
+
+	delete chip8;
+	return 0;
+}
+
+bool VerifyAlu( const CpuEngine & engine, Uint32 threads, AluReport & report )
+{
+	memset( &report, 0, sizeof( report ) );
+
+	std::vector< AluOpcode > opcodes;
+	ListAluOpcodes( opcodes );
+	report.Opcodes = ( Uint32 )opcodes.size( );
+
+	AluJob shared;
+	shared.Engine = &engine;
+	shared.Opcodes = &opcodes;
+	shared.Lock = SDL_CreateMutex( );
+	shared.NextOpcode = 0;
+	shared.Report = &report;
+
+	std::vector< SDL_Thread * > workers( std::max( threads, 1u ) );
+	for ( size_t ix = 0; ix < workers.size( ); ++ix )
+	{
+		workers[ ix ] = SDL_CreateThread( AluThread, &shared );
+	}
+	for ( size_t ix = 0; ix < workers.size( ); ++ix )
+	{
+		SDL_WaitThread( workers[ ix ], NULL );
+	}
+
+	SDL_DestroyMutex( shared.Lock );
+
+	return report.Mismatches == 0;
+}
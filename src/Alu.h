@@ -0,0 +1,187 @@
+#pragma once
+
+#include <SDL.h>
+
+#include "Cpu8080.h"
+#include "Lockstep.h"
+
+// ------------------------------------------------------------
+// 8080 ALU reference model, verifier and lookup tables.
+//
+// ModelAlu is written from Intel's data sheet (and what the instruction
+// exercisers expect of real chips) rather than from the interpreter.
+// VerifyAlu runs every ALU opcode on an engine for every accumulator,
+// operand and carry in (or, for the single operand ones, every value and
+// flags byte), spread over a pool of SDL threads, and compares each with
+// the model. BuildAluTables flattens the model into tables a fast engine
+// can index instead of working the flags out.
+// ------------------------------------------------------------
+
+typedef Cpu8080::CommandProcessingUnit::Registers CpuRegisters;
+typedef CpuRegisters::Flags CpuFlags;
+
+struct AluOp
+{
+	enum T
+	{
+		Add = 0,	// ADD to CMP are in opcode order (0x80 + 8 * op for register B, 0xc6 + 8 * op for the immediates).
+		Adc,
+		Sub,
+		Sbb,
+		Ana,
+		Xra,
+		Ora,
+		Cmp,
+		Inr,
+		Dcr,
+		Daa,
+		Rlc,
+		Rrc,
+		Ral,
+		Rar,
+		Cma,
+		Stc,
+		Cmc,
+		Num
+	};
+};
+
+// Returns the result (the accumulator, or the operand for INR/DCR; CMP leaves the accumulator as it was)
+// and updates the flags the op sets, leaving the rest (and the padding bits) alone.
+Uint8 ModelAlu( AluOp::T op, Uint8 a, Uint8 operand, CpuFlags & flags );
+
+// Each entry holds the result in the low byte and the flags set by the op in the high byte (as CpuFlags::u8).
+struct AluTables
+{
+	Uint16	Binary[ AluOp::Cmp + 1 ][ 2 ][ 0x10000 ];	// By op, carry in, then ( a << 8 ) | operand.
+	Uint16	Inr[ 0x100 ];								// Every flag but CY (which INR and DCR leave alone).
+	Uint16	Dcr[ 0x100 ];
+	Uint16	Daa[ 0x400 ];								// ( cy << 9 ) | ( ac << 8 ) | a.
+
+	Uint8	AllFlags;									// The bits of CpuFlags::u8 holding flags (the rest are padding).
+	Uint8	FlagsButCarry;
+};
+
+// About 2MB, so best allocated.
+void BuildAluTables( AluTables & tables );
+
+// The tables shared by every machine with AluTablesEnabled (NULL until InitAluTables).
+extern const AluTables * g_AluTables;
+
+// Builds g_AluTables (once, and not thread safe, so before any threads are started).
+void InitAluTables( );
+
+// Writes the tables as they are in memory (little endian), for use outside the emulator.
+bool SaveAluTables( const char * file, const AluTables & tables );
+
+struct AluReport
+{
+	Uint32	Opcodes;
+	Uint64	Cases;
+	Uint32	OpcodesMismatched;
+	Uint64	Mismatches;
+};
+
+// Checks every ALU opcode of the engine against the model on up to threads threads, printing the first few
+// mismatches of each opcode. Returns true if everything matched.
+bool VerifyAlu( const CpuEngine & engine, Uint32 threads, AluReport & report );
+
+// ------------------------------------------------------------
+// The interpreter's ALU semantics on a register file, for the engines
+// that don't go through StepCpu (compiled blocks, fused sequences and the
+// opcode handlers). VerifyAlu holds them to the model.
+// ------------------------------------------------------------
+
+inline void AluSetSignZeroParity( CpuRegisters & regs, Uint8 r )
+{
+	regs.flags.z = r == 0;
+	regs.flags.s = r >> 7;
+	regs.flags.p = ParityTable256[ r ];
+}
+
+inline void AluAdd( CpuRegisters & regs, Uint8 value, Uint8 carry )
+{
+	const Uint16 r = regs.accumulator + value + carry;
+	regs.flags.ac = ( ( regs.accumulator & 0xf ) + ( value & 0xf ) + carry ) > 0xf;
+	regs.flags.cy = r > 0xff;
+	regs.accumulator = ( Uint8 )r;
+	AluSetSignZeroParity( regs, regs.accumulator );
+}
+
+// Returns the difference, for SUB and SBB to store and CMP not to.
+inline Uint8 AluSubtract( CpuRegisters & regs, Uint8 value, Uint8 borrow )
+{
+	const Sint16 r = ( Sint16 )regs.accumulator - value - borrow;
+	regs.flags.ac = ( ( Sint16 )( regs.accumulator & 0xf ) - ( value & 0xf ) - borrow ) >= 0;
+	regs.flags.cy = r < 0;
+	AluSetSignZeroParity( regs, ( Uint8 )r );
+	return ( Uint8 )r;
+}
+
+inline void AluAnd( CpuRegisters & regs, Uint8 value )
+{
+	regs.flags.ac = ( ( regs.accumulator | value ) >> 3 ) & 1;
+	regs.flags.cy = 0;
+	regs.accumulator &= value;
+	AluSetSignZeroParity( regs, regs.accumulator );
+}
+
+inline void AluXor( CpuRegisters & regs, Uint8 value )
+{
+	regs.flags.ac = 0;
+	regs.flags.cy = 0;
+	regs.accumulator ^= value;
+	AluSetSignZeroParity( regs, regs.accumulator );
+}
+
+inline void AluOr( CpuRegisters & regs, Uint8 value )
+{
+	regs.flags.ac = 0;
+	regs.flags.cy = 0;
+	regs.accumulator |= value;
+	AluSetSignZeroParity( regs, regs.accumulator );
+}
+
+inline Uint8 AluIncrement( CpuRegisters & regs, Uint8 value )
+{
+	const Uint8 r = value + 1;
+	regs.flags.ac = ( r & 0xf ) == 0;
+	AluSetSignZeroParity( regs, r );
+	return r;
+}
+
+inline Uint8 AluDecrement( CpuRegisters & regs, Uint8 value )
+{
+	const Uint8 r = value - 1;
+	regs.flags.ac = ( r & 0xf ) != 0xf;
+	AluSetSignZeroParity( regs, r );
+	return r;
+}
+
+inline void AluDoubleAdd( CpuRegisters & regs, Uint16 value )
+{
+	const Uint32 r = regs.gprPair[ CpuRegisters::GprPair::HL ] + value;
+	regs.gprPair[ CpuRegisters::GprPair::HL ] = ( Uint16 )r;
+	regs.flags.cy = r > 0xffff;
+}
+
+inline void AluDecimalAdjust( CpuRegisters & regs )
+{
+	const Uint8 a = regs.accumulator;
+	Uint8 correction = 0;
+	Uint8 carry = regs.flags.cy;
+	if ( ( ( a & 0xf ) > 9 ) || regs.flags.ac )
+	{
+		correction |= 0x06;
+	}
+	if ( ( ( a >> 4 ) > 9 ) || ( ( ( a >> 4 ) >= 9 ) && ( ( a & 0xf ) > 9 ) ) || regs.flags.cy )
+	{
+		correction |= 0x60;
+		carry = 1;
+	}
+
+	regs.accumulator = a + correction;
+	AluSetSignZeroParity( regs, regs.accumulator );
+	regs.flags.cy = carry;
+	regs.flags.ac = ( ( a ^ correction ^ regs.accumulator ) >> 4 ) & 1;
+}
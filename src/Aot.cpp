@@ -0,0 +1,443 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "Aot.h"
+
+// ------------------------------------------------------------
+// Translation.
+// ------------------------------------------------------------
+
+static const Uint32 kRomSize = 0x2000;
+
+static const char * kPairs[ 4 ] =
+{
+	"regs.gprPair[ AotRegisters::GprPair::BC ]",
+	"regs.gprPair[ AotRegisters::GprPair::DE ]",
+	"regs.gprPair[ AotRegisters::GprPair::HL ]",
+	"regs.sp",
+};
+
+// Flag tests of the conditional jumps, calls and returns (by bits 3-5 of the opcode).
+static const char * kConditions[ 8 ] =
+{
+	"! regs.flags.z",
+	"regs.flags.z",
+	"! regs.flags.cy",
+	"regs.flags.cy",
+	"! regs.flags.p",
+	"regs.flags.p",
+	"! regs.flags.s",
+	"regs.flags.s",
+};
+
+static const char * kHlMemory = "AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] )";
+
+// Register r (not M) as an lvalue.
+static void FormatRegister( int r, char * text, size_t size )
+{
+	assert( r != AotRegisters::Gpr::___MEMORY );
+	if ( r == AotRegisters::Gpr::___ACCUMULATOR )
+		sprintf_s( text, size, "regs.accumulator" );
+	else
+		sprintf_s( text, size, "regs.gpr[ %d ]", RegIndex( r ) );
+}
+
+// Register r, or M, as a value.
+static void FormatOperand( int r, char * text, size_t size )
+{
+	if ( r == AotRegisters::Gpr::___MEMORY )
+		sprintf_s( text, size, "%s", kHlMemory );
+	else
+		FormatRegister( r, text, size );
+}
+
+// Whether the instruction can go in a block. EI and DI change the interrupt state a step later (left to the
+// interpreter), HLT and the opcodes the interpreter doesn't run assert there.
+static bool IsTranslatable( Uint8 op )
+{
+	switch ( op )
+	{
+		case 0xfb:
+		case 0xf3:
+		case 0x76:
+		case 0x08: case 0x10: case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+		case 0xcb: case 0xd9: case 0xdd: case 0xed: case 0xfd:
+		case 0xf7:
+			return false;
+	}
+	return true;
+}
+
+// Writes the statements for one instruction, with a comment of its disassembly. Instructions leaving the block
+// set pc themselves, the block sets it after any others.
+static void EmitInstruction( FILE * fh, const Uint8 * rom, const RomCfg & cfg, address pc )
+{
+	const Uint8 op = rom[ pc ];
+	const Uint8 imm = rom[ pc + 1 ];
+	const Uint16 imm16 = ( Uint16 )( rom[ pc + 1 ] | ( rom[ pc + 2 ] << 8 ) );
+	const address next = ( address )( pc + InstructionSize[ op ] );
+	const int d = ( op >> 3 ) & 7;
+	const int s = op & 7;
+	const int rp = ( op >> 4 ) & 3;
+
+	char text[ 48 ];
+	FormatCfgInstruction( rom, cfg, pc, text, sizeof( text ) );
+	for ( char * c = text; *c; ++c )
+	{
+		*c = *c == '\t' ? ' ' : *c;
+	}
+	fprintf( fh, "\t// %04X %s\n", pc, text );
+
+	char dst[ 80 ];
+	char src[ 80 ];
+
+	// MOV, MVI.
+	if ( ( op & 0xc0 ) == 0x40 || ( op & 0xc7 ) == 0x06 )
+	{
+		const bool immediate = ( op & 0xc0 ) == 0x00;
+		if ( immediate )
+			sprintf_s( src, sizeof( src ), "0x%02x", imm );
+		else
+			FormatOperand( s, src, sizeof( src ) );
+
+		if ( d == AotRegisters::Gpr::___MEMORY )
+		{
+			fprintf( fh, "\tAotWrite8( chip8, %s, %s );\n", kPairs[ 2 ], src );
+		}
+		else
+		{
+			FormatRegister( d, dst, sizeof( dst ) );
+			fprintf( fh, "\t%s = %s;\n", dst, src );
+		}
+		return;
+	}
+
+	// ADD to CMP, and their immediates.
+	if ( ( op & 0xc0 ) == 0x80 || ( op & 0xc7 ) == 0xc6 )
+	{
+		if ( op >= 0xc0 )
+			sprintf_s( src, sizeof( src ), "0x%02x", imm );
+		else
+			FormatOperand( s, src, sizeof( src ) );
+
+		switch ( d )
+		{
+			case 0:	fprintf( fh, "\tAluAdd( regs, %s, 0 );\n", src ); break;
+			case 1:	fprintf( fh, "\tAluAdd( regs, %s, regs.flags.cy );\n", src ); break;
+			case 2:	fprintf( fh, "\tregs.accumulator = AluSubtract( regs, %s, 0 );\n", src ); break;
+			case 3:	fprintf( fh, "\tregs.accumulator = AluSubtract( regs, %s, regs.flags.cy );\n", src ); break;
+			case 4:	fprintf( fh, "\tAluAnd( regs, %s );\n", src ); break;
+			case 5:	fprintf( fh, "\tAluXor( regs, %s );\n", src ); break;
+			case 6:	fprintf( fh, "\tAluOr( regs, %s );\n", src ); break;
+			case 7:	fprintf( fh, "\tAluSubtract( regs, %s, 0 );\n", src ); break;
+		}
+		return;
+	}
+
+	// INR, DCR.
+	if ( ( op & 0xc6 ) == 0x04 )
+	{
+		const char * function = ( op & 1 ) ? "AluDecrement" : "AluIncrement";
+		if ( d == AotRegisters::Gpr::___MEMORY )
+		{
+			fprintf( fh, "\tAotWrite8( chip8, %s, %s( regs, %s ) );\n", kPairs[ 2 ], function, kHlMemory );
+		}
+		else
+		{
+			FormatRegister( d, dst, sizeof( dst ) );
+			fprintf( fh, "\t%s = %s( regs, %s );\n", dst, function, dst );
+		}
+		return;
+	}
+
+	// Conditional jumps, calls and returns.
+	if ( ( op & 0xc7 ) == 0xc2 )
+	{
+		fprintf( fh, "\tregs.pc = %s ? 0x%04x : 0x%04x;\n", kConditions[ d ], imm16, next );
+		return;
+	}
+	if ( ( op & 0xc7 ) == 0xc4 )
+	{
+		fprintf( fh, "\tif ( %s )\n\t{\n\t\tAotPush16( chip8, 0x%04x );\n\t\tregs.pc = 0x%04x;\n\t}\n\telse\n\t{\n\t\tregs.pc = 0x%04x;\n\t}\n", kConditions[ d ], next, imm16, next );
+		return;
+	}
+	if ( ( op & 0xc7 ) == 0xc0 )
+	{
+		fprintf( fh, "\tregs.pc = %s ? AotPop16( chip8 ) : 0x%04x;\n", kConditions[ d ], next );
+		return;
+	}
+
+	// RST.
+	if ( ( op & 0xc7 ) == 0xc7 )
+	{
+		fprintf( fh, "\tAotPush16( chip8, 0x%04x );\n\tregs.pc = 0x%04x;\n", next, d * 8 );
+		return;
+	}
+
+	switch ( op )
+	{
+		// LXI, INX, DCX, DAD.
+		case 0x01: case 0x11: case 0x21: case 0x31:
+			fprintf( fh, "\t%s = 0x%04x;\n", kPairs[ rp ], imm16 );
+			break;
+		case 0x03: case 0x13: case 0x23: case 0x33:
+			fprintf( fh, "\t%s += 1;\n", kPairs[ rp ] );
+			break;
+		case 0x0b: case 0x1b: case 0x2b: case 0x3b:
+			fprintf( fh, "\t%s -= 1;\n", kPairs[ rp ] );
+			break;
+		case 0x09: case 0x19: case 0x29: case 0x39:
+			fprintf( fh, "\tAluDoubleAdd( regs, %s );\n", kPairs[ rp ] );
+			break;
+
+		// Loads and stores.
+		case 0x02: case 0x12:
+			fprintf( fh, "\tAotWrite8( chip8, %s, regs.accumulator );\n", kPairs[ rp ] );
+			break;
+		case 0x0a: case 0x1a:
+			fprintf( fh, "\tregs.accumulator = AotRead8( chip8, %s );\n", kPairs[ rp ] );
+			break;
+		case 0x32:
+			fprintf( fh, "\tAotWrite8( chip8, 0x%04x, regs.accumulator );\n", imm16 );
+			break;
+		case 0x3a:
+			fprintf( fh, "\tregs.accumulator = AotRead8( chip8, 0x%04x );\n", imm16 );
+			break;
+		case 0x22:
+			fprintf( fh, "\tAotWrite16( chip8, 0x%04x, %s );\n", imm16, kPairs[ 2 ] );
+			break;
+		case 0x2a:
+			fprintf( fh, "\t%s = AotRead16( chip8, 0x%04x );\n", kPairs[ 2 ], imm16 );
+			break;
+		case 0xeb:
+			fprintf( fh, "\t{\n\t\tconst Uint16 de = %s;\n\t\t%s = %s;\n\t\t%s = de;\n\t}\n", kPairs[ 1 ], kPairs[ 1 ], kPairs[ 2 ], kPairs[ 2 ] );
+			break;
+
+		// Stack.
+		case 0xc5: case 0xd5: case 0xe5:
+			fprintf( fh, "\tAotPush16( chip8, %s );\n", kPairs[ rp ] );
+			break;
+		case 0xc1: case 0xd1: case 0xe1:
+			fprintf( fh, "\t%s = AotPop16( chip8 );\n", kPairs[ rp ] );
+			break;
+		case 0xf5:
+			fprintf( fh, "\tAotWrite8( chip8, regs.sp - 1, regs.accumulator );\n\tAotWrite8( chip8, regs.sp - 2, regs.flags.u8 );\n\tregs.sp -= 2;\n" );
+			break;
+		case 0xf1:
+			fprintf( fh, "\tregs.flags.u8 = AotRead8( chip8, regs.sp );\n\tregs.accumulator = AotRead8( chip8, regs.sp + 1 );\n\tregs.sp += 2;\n" );
+			break;
+		case 0xe3:
+			fprintf( fh, "\t{\n\t\tconst Uint16 hl = %s;\n\t\t%s = AotRead16( chip8, regs.sp );\n\t\tAotWrite16( chip8, regs.sp, hl );\n\t}\n", kPairs[ 2 ], kPairs[ 2 ] );
+			break;
+		case 0xf9:
+			fprintf( fh, "\tregs.sp = %s;\n", kPairs[ 2 ] );
+			break;
+
+		// Jumps, calls and returns.
+		case 0xc3:
+			fprintf( fh, "\tregs.pc = 0x%04x;\n", imm16 );
+			break;
+		case 0xcd:
+			fprintf( fh, "\tAotPush16( chip8, 0x%04x );\n\tregs.pc = 0x%04x;\n", next, imm16 );
+			break;
+		case 0xc9:
+			fprintf( fh, "\tregs.pc = AotPop16( chip8 );\n" );
+			break;
+		case 0xe9:
+			fprintf( fh, "\tregs.pc = %s;\n", kPairs[ 2 ] );
+			break;
+
+		// Accumulator and carry.
+		case 0x07:
+			fprintf( fh, "\tregs.flags.cy = regs.accumulator >> 7;\n\tregs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );\n" );
+			break;
+		case 0x0f:
+			fprintf( fh, "\tregs.flags.cy = regs.accumulator & 1;\n\tregs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );\n" );
+			break;
+		case 0x17:
+			fprintf( fh, "\t{\n\t\tconst Uint8 lsb = regs.flags.cy;\n\t\tregs.flags.cy = regs.accumulator >> 7;\n\t\tregs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | lsb );\n\t}\n" );
+			break;
+		case 0x1f:
+			fprintf( fh, "\t{\n\t\tconst Uint8 msb = regs.flags.cy;\n\t\tregs.flags.cy = regs.accumulator & 1;\n\t\tregs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( msb << 7 ) );\n\t}\n" );
+			break;
+		case 0x27:
+			fprintf( fh, "\tAluDecimalAdjust( regs );\n" );
+			break;
+		case 0x2f:
+			fprintf( fh, "\tregs.accumulator = ~regs.accumulator;\n" );
+			break;
+		case 0x37:
+			fprintf( fh, "\tregs.flags.cy = 1;\n" );
+			break;
+		case 0x3f:
+			fprintf( fh, "\tregs.flags.cy = ! regs.flags.cy;\n" );
+			break;
+
+		// I/O (the block has brought the clock up to date).
+		case 0xdb:
+			fprintf( fh, "\tregs.accumulator = IoRead( chip8, 0x%02x );\n", imm );
+			break;
+		case 0xd3:
+			fprintf( fh, "\tIoWrite( chip8, 0x%02x, regs.accumulator );\n", imm );
+			break;
+
+		case 0x00:
+			break;
+
+		default:
+			assert( 0 );
+			break;
+	}
+}
+
+static bool IsIo( Uint8 op )
+{
+	return op == 0xdb || op == 0xd3;
+}
+
+// Instructions of the block that can be translated (stopping at the first that can't).
+static Uint32 CountTranslatable( const Uint8 * rom, const CfgBlock & block )
+{
+	Uint32 count = 0;
+	for ( address pc = block.Start; pc < block.End && IsTranslatable( rom[ pc ] ); pc = ( address )( pc + InstructionSize[ rom[ pc ] ] ) )
+	{
+		++count;
+	}
+	return count;
+}
+
+// Address of the last of the block's first count instructions.
+static address GetLastTranslated( const Uint8 * rom, const CfgBlock & block, Uint32 count )
+{
+	address pc = block.Start;
+	for ( Uint32 ix = 1; ix < count; ++ix )
+	{
+		pc = ( address )( pc + InstructionSize[ rom[ pc ] ] );
+	}
+	return pc;
+}
+
+static void EmitBlock( FILE * fh, const Uint8 * rom, const RomCfg & cfg, const CfgBlock & block, Uint32 count )
+{
+	fprintf( fh, "// %u of %u instructions, %s.\n", count, block.Instructions, count == block.Instructions ? GetCfgExitName( block.Exit ) : "stops for the interpreter" );
+	fprintf( fh, "static void Block_%04X( Cpu8080 & chip8 )\n{\n\tAotRegisters & regs = chip8.Cpu.Regs;\n", block.Start );
+
+	// The clock is only brought up to date where it can be seen (I/O), and at the end.
+	Uint32 clock = 0;
+	address pc = block.Start;
+	for ( Uint32 ix = 0; ix < count; ++ix )
+	{
+		const Uint8 op = rom[ pc ];
+		if ( IsIo( op ) && clock < ix )
+		{
+			fprintf( fh, "\tchip8.InstructionsSinceInterrupt += %u;\n", ix - clock );
+			clock = ix;
+		}
+
+		EmitInstruction( fh, rom, cfg, pc );
+		pc = ( address )( pc + InstructionSize[ op ] );
+	}
+
+	// Whatever left the block has set pc, otherwise it carries on after the last instruction.
+	const bool leaves = count == block.Instructions && block.Exit != CfgExit::FallThrough && block.Exit != CfgExit::Invalid;
+	if ( ! leaves )
+	{
+		fprintf( fh, "\tregs.pc = 0x%04x;\n", pc );
+	}
+	fprintf( fh, "\tchip8.InstructionsSinceInterrupt += %u;\n}\n\n", count - clock );
+}
+
+bool WriteAotSource( const char * file, const Uint8 * rom, const RomCfg & cfg, Uint32 & blocks, Uint32 & instructions )
+{
+	FILE * fh = NULL;
+	if ( fopen_s( &fh, file, "w" ) != 0 )
+		return false;
+
+	blocks = 0;
+	instructions = 0;
+
+	fprintf( fh, "// Generated by 8080Emulator -aot from the invaders ROM (see Aot.h), don't edit.\n" );
+	fprintf( fh, "// %u blocks of %u instructions found, %u indirect jump sites.\n\n", ( Uint32 )cfg.Blocks.size( ), cfg.Instructions, ( Uint32 )cfg.IndirectJumps.size( ) );
+	fprintf( fh, "#include \"Aot.h\"\n\n" );
+
+	std::vector< const CfgBlock * > translated;
+	for ( size_t ix = 0; ix < cfg.Blocks.size( ); ++ix )
+	{
+		const CfgBlock & block = cfg.Blocks[ ix ];
+		const Uint32 count = CountTranslatable( rom, block );
+		if ( count == 0 )
+			continue;
+
+		EmitBlock( fh, rom, cfg, block, count );
+		translated.push_back( &block );
+		blocks++;
+		instructions += count;
+	}
+
+	fprintf( fh, "static const AotBlock kBlocks[ ] =\n{\n" );
+	for ( size_t ix = 0; ix < translated.size( ); ++ix )
+	{
+		const Uint32 count = CountTranslatable( rom, *translated[ ix ] );
+		fprintf( fh, "\t{ 0x%04x, %u, 0x%04x, Block_%04X },\n", translated[ ix ]->Start, count, GetLastTranslated( rom, *translated[ ix ], count ), translated[ ix ]->Start );
+	}
+	fprintf( fh, "};\n\n" );
+
+	fprintf( fh, "const AotProgram kInvadersAot =\n{\n\t0x%08xu,\n\tkBlocks,\n\tsizeof( kBlocks ) / sizeof( kBlocks[ 0 ] ),\n};\n", HashBytes( kHashSeed, rom, kRomSize ) );
+
+	const bool written = ferror( fh ) == 0;
+	fclose( fh );
+	return written;
+}
+
+// ------------------------------------------------------------
+// Engine.
+// ------------------------------------------------------------
+
+// Blocks by start address, for the ROM in s_AotRom.
+static const AotBlock * s_AotBlocks[ kRomSize ];
+static const Uint8 * s_AotRom = NULL;
+
+bool InitAotEngine( const Uint8 * rom )
+{
+	s_AotRom = NULL;
+	memset( s_AotBlocks, 0, sizeof( s_AotBlocks ) );
+
+#if defined(INVADERS_AOT)
+	const AotProgram & program = kInvadersAot;
+	if ( program.RomHash == HashBytes( kHashSeed, rom, kRomSize ) )
+	{
+		for ( size_t ix = 0; ix < program.NumBlocks; ++ix )
+		{
+			s_AotBlocks[ program.Blocks[ ix ].Start ] = &program.Blocks[ ix ];
+		}
+		s_AotRom = rom;
+	}
+#else
+	( void )rom;
+#endif
+
+	return s_AotRom != NULL;
+}
+
+void StepAot( Cpu8080 & chip8 )
+{
+	const address pc = chip8.Cpu.Regs.pc;
+	const AotBlock * block = chip8.Memory.Rom == s_AotRom && pc < kRomSize ? s_AotBlocks[ pc ] : NULL;
+
+	// The whole block has to run before the next interrupt is raised, with the interrupt state settled.
+	if ( block && CanRunUninterrupted( chip8, block->Instructions ) )
+	{
+		block->Run( chip8 );
+
+		// The interpreter didn't see these go by, so look for an idle loop as it would have.
+		CheckIdleLoop( chip8, pc, block->Last );
+		return;
+	}
+
+	// The translation stands in for the ROM, so HLE routines don't.
+	const bool hleEnabled = chip8.HleEnabled;
+	chip8.HleEnabled = false;
+	StepCpu( chip8 );
+	chip8.HleEnabled = hleEnabled;
+}
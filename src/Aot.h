@@ -0,0 +1,99 @@
+#pragma once
+
+#include <SDL.h>
+
+#include "Cpu8080.h"
+#include "Cfg.h"
+#include "Alu.h"
+
+// ------------------------------------------------------------
+// Ahead of time translation of the ROM to C++.
+//
+// WriteAotSource turns every block of the ROM's CFG (see Cfg.h) into a
+// straight-line C++ function, written out as InvadersAot.cpp and compiled
+// into the Release AOT configuration (which defines INVADERS_AOT), so the
+// game runs native code without generating any at runtime. Blocks stop
+// short of EI, DI and HLT, and update the clock before IN and OUT, so the
+// devices see the same instruction count as under the interpreter.
+//
+// The "aot" CPU engine looks the pc up in a table of the blocks and runs
+// the block when there are enough instructions left before the next
+// interrupt for all of it (and no EI/DI is pending, and no interrupt is
+// waiting), otherwise it steps the interpreter, which also covers any pc
+// the CFG didn't find. So interrupts are only checked at block ends, yet
+// land on the same instruction as they would have. A block ending in a
+// backward jump is checked for an idle loop, as the interpreter checks
+// the jump. The Release AOT build runs the game on this engine unless
+// -engine picks another.
+// ------------------------------------------------------------
+
+typedef Cpu8080::CommandProcessingUnit::Registers AotRegisters;
+
+typedef void ( * AotBlockFunction )( Cpu8080 & chip8 );
+
+struct AotBlock
+{
+	address				Start;
+	Uint16				Instructions;
+	address				Last;			// Address of the last instruction (the only one that can close a loop).
+	AotBlockFunction	Run;			// Executes the block, leaving pc at where it goes next.
+};
+
+struct AotProgram
+{
+	Uint32				RomHash;		// HashBytes of the ROM it was translated from.
+	const AotBlock *	Blocks;			// In address order.
+	size_t				NumBlocks;
+};
+
+#if defined(INVADERS_AOT)
+// InvadersAot.cpp.
+extern const AotProgram kInvadersAot;
+#endif
+
+// Writes C++ for every block it can translate (numbers of blocks and instructions written returned).
+bool WriteAotSource( const char * file, const Uint8 * rom, const RomCfg & cfg, Uint32 & blocks, Uint32 & instructions );
+
+// Takes the compiled program if it was translated from this ROM (once, before any threads are started). Returns
+// false if there is none for it, in which case the engine only interprets.
+bool InitAotEngine( const Uint8 * rom );
+
+// Runs a compiled block, or one instruction (or a waiting interrupt) on the interpreter.
+void StepAot( Cpu8080 & chip8 );
+
+// ------------------------------------------------------------
+// Helpers for the generated code (the interpreter's semantics, see StepCpu). The ALU ones are in Alu.h.
+// ------------------------------------------------------------
+
+inline Uint8 AotRead8( const Cpu8080 & chip8, Uint16 addr )
+{
+	return chip8.Memory[ CheckAddress( addr ) ];
+}
+
+inline Uint16 AotRead16( const Cpu8080 & chip8, Uint16 addr )
+{
+	return chip8.Memory.Read16( CheckAddress( addr ) );
+}
+
+inline void AotWrite8( Cpu8080 & chip8, Uint16 addr, Uint8 value )
+{
+	chip8.Memory.Write8( CheckAddress( addr ), value );
+}
+
+inline void AotWrite16( Cpu8080 & chip8, Uint16 addr, Uint16 value )
+{
+	chip8.Memory.Write16( CheckAddress( addr ), value );
+}
+
+inline void AotPush16( Cpu8080 & chip8, Uint16 value )
+{
+	AotWrite16( chip8, chip8.Cpu.Regs.sp - 2, value );
+	chip8.Cpu.Regs.sp -= 2;
+}
+
+inline Uint16 AotPop16( Cpu8080 & chip8 )
+{
+	const Uint16 value = AotRead16( chip8, chip8.Cpu.Regs.sp );
+	chip8.Cpu.Regs.sp += 2;
+	return value;
+}
@@ -0,0 +1,434 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+
+#include "Cfg.h"
+
+// ------------------------------------------------------------
+// Decoding.
+// ------------------------------------------------------------
+
+static const Uint32 kRomSize = 0x2000;
+
+static CfgExit::T ClassifyInstruction( Uint8 op )
+{
+	switch ( op )
+	{
+		case 0xc3:	return CfgExit::Jump;
+		case 0xcd:	return CfgExit::Call;
+		case 0xc9:	return CfgExit::Return;
+		case 0xe9:	return CfgExit::IndirectJump;
+		case 0x76:	return CfgExit::Halt;
+
+		// Undocumented NOPs, JMP, RET and CALLs, and RST 6 (none of which the interpreter runs).
+		case 0x08: case 0x10: case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+		case 0xcb: case 0xd9: case 0xdd: case 0xed: case 0xfd:
+		case 0xf7:
+			return CfgExit::Invalid;
+	}
+
+	switch ( op & 0xc7 )
+	{
+		case 0xc2:	return CfgExit::Branch;
+		case 0xc4:	return CfgExit::Call;
+		case 0xc0:	return CfgExit::ConditionalReturn;
+		case 0xc7:	return CfgExit::Restart;
+	}
+
+	return CfgExit::FallThrough;
+}
+
+// Whether execution can carry on with the instruction after (now or once a call returns).
+static inline bool Continues( CfgExit::T exit )
+{
+	return exit == CfgExit::FallThrough || exit == CfgExit::Branch || exit == CfgExit::Call || exit == CfgExit::ConditionalReturn || exit == CfgExit::Restart;
+}
+
+static address GetTarget( const Uint8 * rom, address pc, CfgExit::T exit )
+{
+	switch ( exit )
+	{
+		case CfgExit::Jump:
+		case CfgExit::Branch:
+		case CfgExit::Call:		return ( address )( rom[ pc + 1 ] | ( rom[ pc + 2 ] << 8 ) );
+		case CfgExit::Restart:	return rom[ pc ] & 0x38;
+		default:				return kCfgNoAddress;
+	}
+}
+
+static void AddSorted( std::vector< address > & addresses, address addr )
+{
+	std::vector< address >::iterator it = std::lower_bound( addresses.begin( ), addresses.end( ), addr );
+	if ( it == addresses.end( ) || *it != addr )
+	{
+		addresses.insert( it, addr );
+	}
+}
+
+// Decodes everything reachable from the entry points, filling in the map.
+static void TraceCode( const Uint8 * rom, std::vector< address > & work, RomCfg & cfg )
+{
+	while ( ! work.empty( ) )
+	{
+		address pc = work.back( );
+		work.pop_back( );
+
+		if ( pc >= kRomSize )
+		{
+			AddSorted( cfg.OutsideTargets, pc );
+			continue;
+		}
+
+		cfg.Map[ pc ] |= kCfgBlockStart;
+		while ( ! ( cfg.Map[ pc ] & kCfgInstruction ) )
+		{
+			const Uint8 op = rom[ pc ];
+			const Uint32 size = InstructionSize[ op ];
+			if ( pc + size > kRomSize )
+				break;
+
+			cfg.Map[ pc ] |= kCfgInstruction | ( ( cfg.Map[ pc ] & kCfgOperand ) ? kCfgOverlap : 0 );
+			for ( Uint32 ix = 1; ix < size; ++ix )
+			{
+				cfg.Map[ pc + ix ] |= kCfgOperand | ( ( cfg.Map[ pc + ix ] & kCfgInstruction ) ? kCfgOverlap : 0 );
+			}
+
+			const CfgExit::T exit = ClassifyInstruction( op );
+			const address target = GetTarget( rom, pc, exit );
+			if ( target < kRomSize )
+			{
+				cfg.Map[ target ] |= ( exit == CfgExit::Call || exit == CfgExit::Restart ) ? kCfgRoutine : 0;
+				work.push_back( target );
+			}
+			else if ( target != kCfgNoAddress )
+			{
+				AddSorted( cfg.OutsideTargets, target );
+			}
+
+			if ( exit == CfgExit::IndirectJump )
+			{
+				cfg.Map[ pc ] |= kCfgIndirectJump;
+				AddSorted( cfg.IndirectJumps, pc );
+			}
+
+			if ( ! Continues( exit ) || pc + size >= kRomSize )
+				break;
+
+			pc = ( address )( pc + size );
+			if ( exit != CfgExit::FallThrough )
+			{
+				cfg.Map[ pc ] |= kCfgBlockStart;
+			}
+		}
+	}
+}
+
+// Walks from a block start to the end of its block.
+static CfgBlock TraceBlock( const Uint8 * rom, const RomCfg & cfg, address start )
+{
+	CfgBlock block;
+	block.Start = start;
+	block.Instructions = 0;
+	block.Target = kCfgNoAddress;
+	block.Next = kCfgNoAddress;
+
+	address pc = start;
+	for ( ; ; )
+	{
+		const Uint8 op = rom[ pc ];
+		const address next = ( address )( pc + InstructionSize[ op ] );
+		block.Instructions++;
+		block.Exit = ClassifyInstruction( op );
+		block.Target = GetTarget( rom, pc, block.Exit );
+		block.End = next;
+
+		if ( Continues( block.Exit ) )
+		{
+			// Running off the end of the ROM, or into bytes that weren't decoded (an instruction straddling the end).
+			if ( next >= kRomSize || ! ( cfg.Map[ next ] & kCfgInstruction ) )
+			{
+				block.Exit = CfgExit::Invalid;
+				block.Target = kCfgNoAddress;
+				break;
+			}
+
+			block.Next = next;
+			if ( block.Exit != CfgExit::FallThrough || ( cfg.Map[ next ] & kCfgBlockStart ) )
+				break;
+
+			pc = next;
+			continue;
+		}
+
+		break;
+	}
+
+	return block;
+}
+
+void BuildRomCfg( const Uint8 * rom, const std::vector< address > & entries, RomCfg & cfg )
+{
+	memset( cfg.Map, 0, sizeof( cfg.Map ) );
+	cfg.Blocks.clear( );
+	cfg.IndirectJumps.clear( );
+	cfg.OutsideTargets.clear( );
+
+	std::vector< address > work( kCfgVectors, kCfgVectors + sizeof( kCfgVectors ) / sizeof( kCfgVectors[ 0 ] ) );
+	work.insert( work.end( ), entries.begin( ), entries.end( ) );
+	for ( size_t ix = 0; ix < work.size( ); ++ix )
+	{
+		if ( work[ ix ] < kRomSize )
+		{
+			cfg.Map[ work[ ix ] ] |= kCfgRoutine;
+		}
+	}
+
+	TraceCode( rom, work, cfg );
+
+	cfg.Instructions = 0;
+	cfg.CodeBytes = 0;
+	cfg.Routines = 0;
+	for ( Uint32 pc = 0; pc < kRomSize; ++pc )
+	{
+		const Uint8 map = cfg.Map[ pc ];
+		cfg.Instructions += ( map & kCfgInstruction ) ? 1 : 0;
+		cfg.CodeBytes += ( map & ( kCfgInstruction | kCfgOperand ) ) ? 1 : 0;
+		cfg.Routines += ( map & kCfgRoutine ) ? 1 : 0;
+
+		if ( ( map & kCfgBlockStart ) && ( map & kCfgInstruction ) )
+		{
+			cfg.Blocks.push_back( TraceBlock( rom, cfg, ( address )pc ) );
+		}
+	}
+}
+
+static bool BlockStartsAfter( address pc, const CfgBlock & block )
+{
+	return pc < block.Start;
+}
+
+const CfgBlock * FindCfgBlock( const RomCfg & cfg, address pc )
+{
+	std::vector< CfgBlock >::const_iterator it = std::upper_bound( cfg.Blocks.begin( ), cfg.Blocks.end( ), pc, BlockStartsAfter );
+	if ( it == cfg.Blocks.begin( ) )
+		return NULL;
+
+	--it;
+	return pc < it->End ? &*it : NULL;
+}
+
+// ------------------------------------------------------------
+// Runtime resolution.
+// ------------------------------------------------------------
+
+Uint32 ResolveIndirectJumps( const Cpu8080 & start, const RomCfg & cfg, Uint32 frames, std::vector< address > & targets )
+{
+	// HLE routines would run over any sites inside them.
+	Cpu8080 * chip8 = new Cpu8080( start );
+	chip8->HleEnabled = false;
+
+	std::vector< bool > jumped( kRomSize, false );
+	Uint32 sites = 0;
+
+	const Uint32 endFrame = start.Frame + frames;
+	while ( chip8->Frame < endFrame )
+	{
+		if ( IsInterruptDue( *chip8 ) )
+		{
+			RaiseInterrupt( *chip8 );
+			continue;
+		}
+
+		// A waiting interrupt is taken instead of the instruction.
+		const address pc = chip8->Cpu.Regs.pc;
+		const bool interrupting = chip8->InterruptsEnabled && ( chip8->InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] || chip8->InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] );
+		const bool indirect = ! interrupting && pc < kRomSize && ( cfg.Map[ pc ] & kCfgIndirectJump );
+
+		StepCpu( *chip8 );
+
+		if ( indirect )
+		{
+			AddSorted( targets, chip8->Cpu.Regs.pc );
+			sites += jumped[ pc ] ? 0 : 1;
+			jumped[ pc ] = true;
+		}
+	}
+
+	delete chip8;
+	return sites;
+}
+
+Uint32 BuildResolvedRomCfg( const Cpu8080 & start, Uint32 frames, RomCfg & cfg, std::vector< address > & targets )
+{
+	targets.clear( );
+	BuildRomCfg( start.Memory.Rom, targets, cfg );
+
+	Uint32 resolved = 0;
+	while ( frames )
+	{
+		const size_t found = targets.size( );
+		resolved = ResolveIndirectJumps( start, cfg, frames, targets );
+		if ( targets.size( ) == found )
+			break;
+
+		BuildRomCfg( start.Memory.Rom, targets, cfg );
+	}
+	return resolved;
+}
+
+// ------------------------------------------------------------
+// Listing.
+// ------------------------------------------------------------
+
+// Mnemonics, with %s for the operand.
+static const char * kMnemonics[ 256 ] =
+{
+	"nop", "lxi b,%s", "stax b", "inx b", "inr b", "dcr b", "mvi b,%s", "rlc", "*nop", "dad b", "ldax b", "dcx b", "inr c", "dcr c", "mvi c,%s", "rrc",	// 0x00
+	"*nop", "lxi d,%s", "stax d", "inx d", "inr d", "dcr d", "mvi d,%s", "ral", "*nop", "dad d", "ldax d", "dcx d", "inr e", "dcr e", "mvi e,%s", "rar",	// 0x10
+	"*nop", "lxi h,%s", "shld %s", "inx h", "inr h", "dcr h", "mvi h,%s", "daa", "*nop", "dad h", "lhld %s", "dcx h", "inr l", "dcr l", "mvi l,%s", "cma",	// 0x20
+	"*nop", "lxi sp,%s", "sta %s", "inx sp", "inr m", "dcr m", "mvi m,%s", "stc", "*nop", "dad sp", "lda %s", "dcx sp", "inr a", "dcr a", "mvi a,%s", "cmc",	// 0x30
+	"mov b,b", "mov b,c", "mov b,d", "mov b,e", "mov b,h", "mov b,l", "mov b,m", "mov b,a", "mov c,b", "mov c,c", "mov c,d", "mov c,e", "mov c,h", "mov c,l", "mov c,m", "mov c,a",	// 0x40
+	"mov d,b", "mov d,c", "mov d,d", "mov d,e", "mov d,h", "mov d,l", "mov d,m", "mov d,a", "mov e,b", "mov e,c", "mov e,d", "mov e,e", "mov e,h", "mov e,l", "mov e,m", "mov e,a",	// 0x50
+	"mov h,b", "mov h,c", "mov h,d", "mov h,e", "mov h,h", "mov h,l", "mov h,m", "mov h,a", "mov l,b", "mov l,c", "mov l,d", "mov l,e", "mov l,h", "mov l,l", "mov l,m", "mov l,a",	// 0x60
+	"mov m,b", "mov m,c", "mov m,d", "mov m,e", "mov m,h", "mov m,l", "hlt", "mov m,a", "mov a,b", "mov a,c", "mov a,d", "mov a,e", "mov a,h", "mov a,l", "mov a,m", "mov a,a",	// 0x70
+	"add b", "add c", "add d", "add e", "add h", "add l", "add m", "add a", "adc b", "adc c", "adc d", "adc e", "adc h", "adc l", "adc m", "adc a",	// 0x80
+	"sub b", "sub c", "sub d", "sub e", "sub h", "sub l", "sub m", "sub a", "sbb b", "sbb c", "sbb d", "sbb e", "sbb h", "sbb l", "sbb m", "sbb a",	// 0x90
+	"ana b", "ana c", "ana d", "ana e", "ana h", "ana l", "ana m", "ana a", "xra b", "xra c", "xra d", "xra e", "xra h", "xra l", "xra m", "xra a",	// 0xa0
+	"ora b", "ora c", "ora d", "ora e", "ora h", "ora l", "ora m", "ora a", "cmp b", "cmp c", "cmp d", "cmp e", "cmp h", "cmp l", "cmp m", "cmp a",	// 0xb0
+	"rnz", "pop b", "jnz %s", "jmp %s", "cnz %s", "push b", "adi %s", "rst 0", "rz", "ret", "jz %s", "*jmp %s", "cz %s", "call %s", "aci %s", "rst 1",	// 0xc0
+	"rnc", "pop d", "jnc %s", "out %s", "cnc %s", "push d", "sui %s", "rst 2", "rc", "*ret", "jc %s", "in %s", "cc %s", "*call %s", "sbi %s", "rst 3",	// 0xd0
+	"rpo", "pop h", "jpo %s", "xthl", "cpo %s", "push h", "ani %s", "rst 4", "rpe", "pchl", "jpe %s", "xchg", "cpe %s", "*call %s", "xri %s", "rst 5",	// 0xe0
+	"rp", "pop psw", "jp %s", "di", "cp %s", "push psw", "ori %s", "rst 6", "rm", "sphl", "jm %s", "ei", "cm %s", "*call %s", "cpi %s", "rst 7",	// 0xf0
+};
+
+static const char * kCfgExitNames[ CfgExit::Num ] =
+{
+	"falls through",
+	"jumps",
+	"branches",
+	"calls",
+	"returns",
+	"returns conditionally",
+	"restarts",
+	"jumps indirectly",
+	"halts",
+	"invalid",
+};
+
+const char * GetCfgMnemonic( Uint8 op )
+{
+	return kMnemonics[ op ];
+}
+
+const char * GetCfgExitName( CfgExit::T exit )
+{
+	assert( exit < CfgExit::Num );
+	return kCfgExitNames[ exit ];
+}
+
+void FormatCfgInstruction( const Uint8 * rom, const RomCfg & cfg, address pc, char * text, size_t size )
+{
+	const Uint8 op = rom[ pc ];
+	const CfgExit::T exit = ClassifyInstruction( op );
+
+	// Code destinations by label, anything else as a number (in the same form as invaders.lst).
+	char operand[ 16 ] = "";
+	if ( InstructionSize[ op ] == 3 )
+	{
+		const address value = ( address )( rom[ pc + 1 ] | ( rom[ pc + 2 ] << 8 ) );
+		const bool label = exit != CfgExit::FallThrough && value < kRomSize && ( cfg.Map[ value ] & kCfgInstruction );
+		sprintf_s( operand, sizeof( operand ), label ? "L%04X" : "0%04XH", value );
+	}
+	else if ( InstructionSize[ op ] == 2 )
+	{
+		sprintf_s( operand, sizeof( operand ), "0%02XH", rom[ pc + 1 ] );
+	}
+
+	char mnemonic[ 32 ];
+	sprintf_s( mnemonic, sizeof( mnemonic ), kMnemonics[ op ], operand );
+
+	// Tab between the mnemonic and its operands.
+	char * space = strchr( mnemonic, ' ' );
+	if ( space )
+	{
+		*space = '\t';
+	}
+	sprintf_s( text, size, "%s", mnemonic );
+}
+
+bool WriteCfgListing( const char * file, const Uint8 * rom, const RomCfg & cfg )
+{
+	FILE * fh = NULL;
+	if ( fopen_s( &fh, file, "w" ) != 0 )
+		return false;
+
+	fprintf( fh, "\t\t\t\t\t\t\t;\n" );
+	fprintf( fh, "\t\t\t\t\t\t\t;\tControl flow graph of the ROM\n" );
+	fprintf( fh, "\t\t\t\t\t\t\t;\n" );
+	fprintf( fh, "\t\t\t\t\t\t\t;\tBlocks:\t\t\t%u\n", ( Uint32 )cfg.Blocks.size( ) );
+	fprintf( fh, "\t\t\t\t\t\t\t;\tRoutines:\t\t%u\n", cfg.Routines );
+	fprintf( fh, "\t\t\t\t\t\t\t;\tInstructions:\t%u\n", cfg.Instructions );
+	fprintf( fh, "\t\t\t\t\t\t\t;\tCode bytes:\t\t%u (of %u)\n", cfg.CodeBytes, kRomSize );
+	fprintf( fh, "\t\t\t\t\t\t\t;\tIndirect jumps:\t%u\n", ( Uint32 )cfg.IndirectJumps.size( ) );
+	for ( size_t ix = 0; ix < cfg.OutsideTargets.size( ); ++ix )
+	{
+		fprintf( fh, "\t\t\t\t\t\t\t;\tTarget outside the ROM: 0%04XH\n", cfg.OutsideTargets[ ix ] );
+	}
+	fprintf( fh, "\t\t\t\t\t\t\t;\n\t\t\t\t\t\t\t\torg\t00000H\n\t\t\t\t\t\t\t;\n" );
+
+	Uint32 pc = 0;
+	while ( pc < kRomSize )
+	{
+		const Uint8 map = cfg.Map[ pc ];
+
+		// Data, up to 8 bytes a line, stopping at code.
+		if ( ! ( map & kCfgInstruction ) )
+		{
+			char bytes[ 32 ] = "";
+			char values[ 64 ] = "";
+			Uint32 count = 0;
+			for ( ; count < 8 && pc + count < kRomSize && ! ( cfg.Map[ pc + count ] & kCfgInstruction ); ++count )
+			{
+				const Uint8 value = rom[ pc + count ];
+				sprintf_s( bytes + strlen( bytes ), sizeof( bytes ) - strlen( bytes ), "%02X ", value );
+				sprintf_s( values + strlen( values ), sizeof( values ) - strlen( values ), count ? ",0%02XH" : "0%02XH", value );
+			}
+			fprintf( fh, "%04X : %-24s\t\tdb\t%s\n", pc, bytes, values );
+			pc += count;
+			continue;
+		}
+
+		const CfgBlock * block = ( map & kCfgBlockStart ) ? FindCfgBlock( cfg, ( address )pc ) : NULL;
+		if ( block && block->Start == pc )
+		{
+			fprintf( fh, "%04X\t\t\t\t\t\t\tL%04X:", pc, pc );
+			fprintf( fh, "\t\t\t\t; %s%u instructions, %s", ( map & kCfgRoutine ) ? "routine, " : "", block->Instructions, GetCfgExitName( block->Exit ) );
+			fprintf( fh, ( map & kCfgOverlap ) ? ", overlaps another instruction\n" : "\n" );
+		}
+
+		char bytes[ 16 ] = "";
+		const Uint32 size = InstructionSize[ rom[ pc ] ];
+		for ( Uint32 ix = 0; ix < size && pc + ix < kRomSize; ++ix )
+		{
+			sprintf_s( bytes + strlen( bytes ), sizeof( bytes ) - strlen( bytes ), "%02X ", rom[ pc + ix ] );
+		}
+
+		char text[ 48 ];
+		FormatCfgInstruction( rom, cfg, ( address )pc, text, sizeof( text ) );
+		fprintf( fh, "%04X : %-24s\t\t%s%s\n", pc, bytes, text, ( map & kCfgIndirectJump ) ? "\t\t; indirect jump, resolved at runtime" : "" );
+
+		// Gap after code that doesn't carry on, as invaders.lst has.
+		const CfgExit::T exit = ClassifyInstruction( rom[ pc ] );
+		if ( ! Continues( exit ) )
+		{
+			fprintf( fh, "\t\t\t\t\t\t\t;\n" );
+		}
+
+		pc += size;
+	}
+
+	const bool written = ferror( fh ) == 0;
+	fclose( fh );
+	return written;
+}
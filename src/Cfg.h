@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+
+#include "Cpu8080.h"
+
+// ------------------------------------------------------------
+// Static control flow graph of the ROM.
+//
+// Decodes the 8K ROM recursively from the reset vector and the interrupt
+// handlers (RST 0, 1 and 2), following JMP, CALL, the conditional jumps,
+// calls and returns and RST, so data tables are never mistaken for code.
+// The decoded instructions are split into basic blocks, each ending at a
+// transfer of control or where another block starts. PCHL (0xe9) can't be
+// followed statically, so its sites are flagged and their targets can be
+// resolved by running the game (ResolveIndirectJumps) and fed back in as
+// extra entry points. Engines that translate code can take the blocks up
+// front rather than discovering them while the game runs, and
+// WriteCfgListing annotates the ROM much as data/invaders.lst does.
+// ------------------------------------------------------------
+
+static const address kCfgNoAddress = 0xffff;
+
+// What RomCfg::Map holds for each ROM byte.
+static const Uint8 kCfgInstruction = 1 << 0;	// An instruction starts here.
+static const Uint8 kCfgOperand = 1 << 1;		// Immediate bytes of an instruction.
+static const Uint8 kCfgBlockStart = 1 << 2;
+static const Uint8 kCfgRoutine = 1 << 3;		// Entry point, called or jumped to by an RST or interrupt.
+static const Uint8 kCfgIndirectJump = 1 << 4;	// A PCHL.
+static const Uint8 kCfgOverlap = 1 << 5;		// Decoded both as an instruction and as part of another.
+
+// How a block is left (by its last instruction, or by running into the next block).
+struct CfgExit
+{
+	enum T
+	{
+		FallThrough = 0,	// Into the block starting after it.
+		Jump,				// JMP.
+		Branch,				// Jcc, Next when not taken.
+		Call,				// CALL or Ccc, Next once it returns (or isn't taken).
+		Return,				// RET.
+		ConditionalReturn,	// Rcc, Next when not taken.
+		Restart,			// RST, Next once it returns.
+		IndirectJump,		// PCHL.
+		Halt,				// HLT.
+		Invalid,			// An opcode the interpreter doesn't run.
+		Num
+	};
+};
+
+struct CfgBlock
+{
+	address		Start;
+	address		End;			// One past the last byte of the last instruction.
+	Uint16		Instructions;
+	CfgExit::T	Exit;
+	address		Target;			// Jump, branch, call or RST destination (kCfgNoAddress for none).
+	address		Next;			// Where it carries on besides Target (kCfgNoAddress for none).
+};
+
+struct RomCfg
+{
+	Uint8					Map[ 0x2000 ];
+	std::vector< CfgBlock >	Blocks;				// In address order.
+	std::vector< address >	IndirectJumps;		// PCHL sites, in address order.
+	std::vector< address >	OutsideTargets;		// Destinations outside the ROM (RAM, or the mirrors), in address order.
+	Uint32					Instructions;
+	Uint32					CodeBytes;
+	Uint32					Routines;
+};
+
+// The entry points every CFG is built from.
+static const address kCfgVectors[ ] = { 0x0000, 0x0008, 0x0010 };
+
+// Builds the CFG from the vectors and any further entry points (targets of indirect jumps found at runtime).
+void BuildRomCfg( const Uint8 * rom, const std::vector< address > & entries, RomCfg & cfg );
+
+// Returns the block starting at or containing pc, or NULL if it isn't code.
+const CfgBlock * FindCfgBlock( const RomCfg & cfg, address pc );
+
+// Runs the interpreter from start for frames, recording where the CFG's PCHL sites jump to (adding any new ones to
+// targets, which stays sorted). Returns the number of sites that jumped.
+Uint32 ResolveIndirectJumps( const Cpu8080 & start, const RomCfg & cfg, Uint32 frames, std::vector< address > & targets );
+
+// Builds the CFG from the vectors, then runs the game from start for frames (if any) to resolve its indirect jumps,
+// rebuilding with their targets (which may have indirect jumps of their own) until no more turn up. Returns the number
+// of sites that jumped.
+Uint32 BuildResolvedRomCfg( const Cpu8080 & start, Uint32 frames, RomCfg & cfg, std::vector< address > & targets );
+
+// Disassembles the instruction at pc (lower case, as invaders.lst), with code destinations as labels.
+void FormatCfgInstruction( const Uint8 * rom, const RomCfg & cfg, address pc, char * text, size_t size );
+
+// Writes an annotated disassembly: labelled blocks and routines, code and data bytes, PCHL sites and their exits.
+bool WriteCfgListing( const char * file, const Uint8 * rom, const RomCfg & cfg );
+
+// Lower case, with %s standing for any immediate operand.
+const char * GetCfgMnemonic( Uint8 op );
+
+const char * GetCfgExitName( CfgExit::T exit );
@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "Cpm.h"
+
+typedef Cpu8080::CommandProcessingUnit::Registers Registers;
+
+// CP/M's page zero: the warm boot jump and the BDOS entry point.
+static const address kCpmWarmBoot = 0x0000;
+static const address kCpmBdosEntry = 0x0005;
+static const address kCpmProgramStart = 0x0100;
+
+// BDOS functions.
+struct BdosFunction
+{
+	enum T
+	{
+		SystemReset = 0,
+		ConsoleOutput = 2,
+		PrintString = 9,
+	};
+};
+
+static void WriteConsole( CpmResult & result, char c )
+{
+	result.Output.push_back( c );
+	putchar( c );
+}
+
+// Returns false for functions we don't support.
+static bool CallBdos( Cpu8080 & chip8, CpmResult & result )
+{
+	Registers & regs = chip8.Cpu.Regs;
+	switch ( regs.gpr[ RegIndex( Registers::Gpr::C ) ] )
+	{
+		case BdosFunction::SystemReset:
+		{
+			regs.pc = kCpmWarmBoot;
+			return true;
+		}
+
+		case BdosFunction::ConsoleOutput:
+		{
+			WriteConsole( result, ( char )regs.gpr[ RegIndex( Registers::Gpr::E ) ] );
+		}
+		break;
+
+		case BdosFunction::PrintString:
+		{
+			for ( Uint32 addr = regs.gprPair[ Registers::GprPair::DE ]; addr < 0x10000 && chip8.Memory[ addr ] != '$'; ++addr )
+			{
+				WriteConsole( result, ( char )chip8.Memory[ addr ] );
+			}
+		}
+		break;
+
+		default:
+		{
+			printf( "\nUnsupported BDOS function %u called from 0x%04x\n", regs.gpr[ RegIndex( Registers::Gpr::C ) ], chip8.Memory.Read16( regs.sp ) - 3 );
+			return false;
+		}
+	}
+
+	fflush( stdout );
+
+	// RET.
+	regs.pc = chip8.Memory.Read16( regs.sp );
+	regs.sp += 2;
+	return true;
+}
+
+static bool ContainsText( const std::vector< char > & output, const char * text )
+{
+	const size_t length = strlen( text );
+	for ( size_t ix = 0; ix + length <= output.size( ); ++ix )
+	{
+		if ( memcmp( &output[ ix ], text, length ) == 0 )
+			return true;
+	}
+	return false;
+}
+
+bool RunCpmProgram( const char * file, const CpuEngine & engine, Uint64 maxInstructions, CpmResult & result )
+{
+	result.Finished = false;
+	result.Failed = false;
+	result.Instructions = 0;
+	result.Output.clear( );
+
+	// Flat memory has two spare bytes at the end for fetches and 16 bit reads at 0xffff.
+	std::vector< Uint8 > memory( 0x10000 + 2, 0 );
+
+	FILE * fh = NULL;
+	if ( fopen_s( &fh, file, "rb" ) != 0 )
+		return false;
+
+	const size_t size = fread( &memory[ kCpmProgramStart ], 1, kCpmBdosBase - kCpmProgramStart, fh );
+	const bool tooLarge = fgetc( fh ) != EOF;
+	fclose( fh );
+	if ( size == 0 || tooLarge )
+		return false;
+
+	// Page zero: HLT at the warm boot (we stop before it runs), and JMP to BDOS (trapped before it runs).
+	memory[ kCpmWarmBoot ] = 0x76;
+	memory[ kCpmBdosEntry ] = 0xc3;
+	memory[ kCpmBdosEntry + 1 ] = ( Uint8 )kCpmBdosBase;
+	memory[ kCpmBdosEntry + 2 ] = ( Uint8 )( kCpmBdosBase >> 8 );
+
+	Cpu8080 * chip8 = new Cpu8080;
+	chip8->Memory.Flat = &memory[ 0 ];
+	chip8->Memory.Rom = &memory[ 0 ];
+	chip8->HleEnabled = false;
+	chip8->InterruptsEnabled = false;
+
+	// The CCP calls the program, so returning from it warm boots.
+	chip8->Cpu.Regs.pc = kCpmProgramStart;
+	chip8->Cpu.Regs.sp = kCpmBdosBase - 2;
+
+	for ( ; ; )
+	{
+		const address pc = chip8->Cpu.Regs.pc;
+		if ( pc == kCpmWarmBoot )
+		{
+			result.Finished = true;
+			break;
+		}
+		if ( pc == kCpmBdosEntry )
+		{
+			if ( ! CallBdos( *chip8, result ) )
+				break;
+			continue;
+		}
+		if ( maxInstructions && result.Instructions >= maxInstructions )
+			break;
+
+		// Interrupts are never raised, so the clock just counts instructions (wrapping).
+		const Uint32 clock = chip8->InstructionsSinceInterrupt;
+		engine.Step( *chip8 );
+		result.Instructions += chip8->InstructionsSinceInterrupt - clock;
+	}
+
+	delete chip8;
+
+	result.Failed = ContainsText( result.Output, "ERROR" ) || ContainsText( result.Output, "FAIL" );
+	return true;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+
+#include "Lockstep.h"
+
+// ------------------------------------------------------------
+// CP/M test bench.
+//
+// Runs a CP/M .COM program (the 8080 instruction exercisers and diagnostics)
+// headless on a CPU engine, to check and time the core away from Space
+// Invaders. The program is loaded at 0x0100 into a flat 64K of RAM (see
+// MachineMemory::Flat). CALL 5 is trapped for the BDOS console output
+// functions (2, write the character in E, and 9, write the '$' terminated
+// string at DE), and a jump to 0x0000 (warm boot) ends the program.
+// ------------------------------------------------------------
+
+// Where BDOS would start, as the program finds it at 0x0006 (the top of its memory).
+static const address kCpmBdosBase = 0xfe00;
+
+struct CpmResult
+{
+	bool				Finished;		// Returned to CP/M, rather than running out of instructions or calling an unsupported function.
+	bool				Failed;			// The console output reports an error (as the exercisers do).
+	Uint64				Instructions;
+	std::vector< char >	Output;			// Console output (also written to stdout as it is produced).
+};
+
+// Runs the program for up to maxInstructions (0 for no limit). Returns false if it couldn't be loaded.
+bool RunCpmProgram( const char * file, const CpuEngine & engine, Uint64 maxInstructions, CpmResult & result );
@@ -0,0 +1,2901 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <vector>
+
+#include "Cpu8080.h"
+#include "Hle.h"
+#include "Alu.h"
+#include "Cfg.h"
+#include "OpcodeHandlers.h"
+
+#if !defined(NDEBUG) || defined(_DEBUG) || defined(DEBUG)
+//#define _DUMP_INSTRUCTIONS
+#define _DUMP_DISASSEMBLY
+#endif
+
+#if defined(_DUMP_INSTRUCTIONS)
+#	define DumpInstruction( _Message, ... )	do { printf( _Message "\n", __VA_ARGS__ ); } while ( 0 )
+#else
+#	define DumpInstruction( _Message, ... )	do { } while ( 0 )
+#endif
+
+#if defined(_DUMP_DISASSEMBLY)
+#	define DumpDisassembly( _Message, ... )	do { printf( "%04x. %02x. "_Message "\n", chip8.Cpu.Regs.pc, chip8.Memory[ chip8.Cpu.Regs.pc ], __VA_ARGS__ ); } while ( 0 )
+#else
+#	define DumpDisassembly( _Message, ... ) do { } while ( 0 )
+#endif
+
+static inline const char * RegName( int ix )
+{
+	assert( ( ix >= 0 && ix < 6 ) || ix == 7 );
+	static const char * kRegNames[ ] = {
+		"B",
+		"C",
+		"D",
+		"E",
+		"H",
+		"L",
+		"M",
+		"A"
+	};
+	return kRegNames[ ix ];
+}
+
+// Folds the mirrors back into the 16K address space (or leaves the address alone in flat memory).
+#define MapAddress( _Addr )					( chip8.Memory.Flat ? ( Uint16 )( _Addr ) : CheckAddress( _Addr ) )
+#define MapProgramCounter( _Addr )			( chip8.Memory.Flat ? ( Uint16 )( _Addr ) : CheckProgramCounter( _Addr ) )
+
+#define IncrementPc( )						chip8.Cpu.Regs.pc += 1
+#define DoubleIncrementPc( )				chip8.Cpu.Regs.pc += 2
+
+#define GetHlMemory8( )						chip8.Memory[ MapAddress( chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::HL ] ) ]
+#define SetHlMemory8( _Val )				chip8.Memory.Write8( MapAddress( chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::HL ] ), _Val )
+
+#define GetRegisterBc( )					chip8.Cpu.Regs.gprPair[ CheckAddress( Cpu8080::CommandProcessingUnit::Registers::GprPair::BC ) ]
+#define SetRegisterBc( _Val )				GetRegisterBc( ) = _Val
+#define GetBcMemory8( )						chip8.Memory[ MapAddress( GetRegisterBc( ) ) ]
+#define GetBcMemory16( )					chip8.Memory.Read16( MapAddress( GetRegisterBc( ) ) )
+#define SetBcMemory8( _Val )				chip8.Memory.Write8( MapAddress( GetRegisterBc( ) ), _Val )
+#define SetBcMemory16( _Val )				chip8.Memory.Write16( MapAddress( GetRegisterBc( ) ), _Val )
+
+#define GetRegisterDe( )					chip8.Cpu.Regs.gprPair[ CheckAddress( Cpu8080::CommandProcessingUnit::Registers::GprPair::DE ) ]
+#define SetRegisterDe( _Val )				GetRegisterDe( ) = _Val
+#define GetDeMemory8( )						chip8.Memory[ MapAddress( GetRegisterDe( ) ) ]
+#define GetDeMemory16( )					chip8.Memory.Read16( MapAddress( GetRegisterDe( ) ) )
+#define SetDeMemory8( _Val )				chip8.Memory.Write8( MapAddress( GetRegisterDe( ) ), _Val )
+#define SetDeMemory16( _Val )				chip8.Memory.Write16( MapAddress( GetRegisterDe( ) ), _Val )
+
+#define GetRegisterHl( )					chip8.Cpu.Regs.gprPair[ CheckAddress( Cpu8080::CommandProcessingUnit::Registers::GprPair::HL ) ]
+#define SetRegisterHl( _Val )				GetRegisterHl( ) = _Val
+
+#define GetAccumulator( )					chip8.Cpu.Regs.accumulator
+#define SetAccumulator( _Val )				GetAccumulator( ) = _Val
+
+#define GetMemory8AtAddress( _Addr )		chip8.Memory[ MapAddress( _Addr ) ]
+#define SetMemory8AtAddress( _Addr, _Val )	chip8.Memory.Write8( MapAddress( _Addr ), _Val )
+
+#define GetMemory16AtAddress( _Addr )		chip8.Memory.Read16( MapAddress( _Addr ) )
+#define SetMemory16AtAddress( _Addr, _Val )	chip8.Memory.Write16( MapAddress( _Addr ), _Val )
+
+#define GetRegisterSp( )					chip8.Cpu.Regs.sp
+#define SetRegisterSp( _Val )				GetRegisterSp( ) = _Val
+#define DecrementSp( )						GetRegisterSp( ) -= 1
+#define DoubleDecrementSp( )				GetRegisterSp( ) -= 2
+#define IncrementSp( )						GetRegisterSp( ) += 1
+#define DoubleIncrementSp( )				GetRegisterSp( ) += 2
+#define PushAndDecrementStack8( _Val )		SetMemory8AtAddress( GetRegisterSp( ) - 1, _Val ); DecrementSp( )
+#define PushAndDecrementStack16( _Val )		SetMemory16AtAddress( GetRegisterSp( ) - 2, _Val ); DoubleDecrementSp( )
+
+#define PopStack8( )						GetMemory8AtAddress( GetRegisterSp( ) )
+#define PopStack16( )						GetMemory16AtAddress( GetRegisterSp( ) )
+
+#define GetFlags( )							chip8.Cpu.Regs.flags
+#define SetFlags( _Val )					GetFlags( ).u8 = _Val
+
+#define SetRegisterPc( _Val )				chip8.Cpu.Regs.pc = MapProgramCounter( _Val )
+
+// For the given base value, generation case statements for each source register variation (assuming source is in bits 0-2)
+#define _GenSrcVariations( _Base )	\
+			_Base:					\
+			case _Base + 1:			\
+			case _Base + 2:			\
+			case _Base + 3:			\
+			case _Base + 4:			\
+			case _Base + 5:			\
+			case _Base + 7
+
+// For the given base value, generation case statements for each destination register variation (assuming destination is in bits 3-5)
+#define _GenDstVariations( _Base )	\
+			_Base:					\
+			case _Base + 8:			\
+			case _Base + 16:		\
+			case _Base + 24:		\
+			case _Base + 32:		\
+			case _Base + 40:		\
+			case _Base + 56
+
+// For the given base value, generation case statements for each source/destination register variation (assuming source is in bits 0-2 and destination is in bits 3-5)
+#define _GenDstSrcVariations( _Base )				\
+			_GenSrcVariations( _Base ):				\
+			case _GenSrcVariations( _Base + 8 ):	\
+			case _GenSrcVariations( _Base + 16 ):	\
+			case _GenSrcVariations( _Base + 24 ):	\
+			case _GenSrcVariations( _Base + 32 ):	\
+			case _GenSrcVariations( _Base + 40 ):	\
+			case _GenSrcVariations( _Base + 56 )
+
+// ------------------------------------------------------------
+// Idle loop detection.
+//
+// The ROM spends a lot of time spinning on RAM flags which only the
+// interrupt handlers change (e.g. 0x0ada: LDA 0x20c0 / ANA A / JNZ 0x0ada).
+// If a short backward branch closes a loop whose body only reads memory and
+// updates registers/flags, and the register file is identical on two
+// consecutive trips round the back edge, then nothing can change until the
+// next interrupt, so we skip every whole trip that fits before it. The
+// remaining part of a trip runs as usual, so the interrupt is taken at the
+// same instruction, with the same registers, as when nothing is skipped.
+// ------------------------------------------------------------
+
+// Largest loop body (in bytes, including the branch) we consider.
+static const address kIdleLoopMaxBodySize = 16;
+
+bool IsSideEffectFreeInstruction( Uint8 op )
+{
+	switch ( op )
+	{
+		// MOV M, r and HLT.
+		case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
+			return false;
+
+		// MVI M, INR M, DCR M, STAX, STA, SHLD.
+		case 0x36: case 0x34: case 0x35: case 0x02: case 0x12: case 0x32: case 0x22:
+			return false;
+
+		// Jumps (conditional ones are loop exits, unconditional ones the back edge).
+		case 0xc3: case 0xc2: case 0xca: case 0xd2: case 0xda: case 0xe2: case 0xea: case 0xf2: case 0xfa:
+			return true;
+
+		// Immediate ALU operations.
+		case 0xc6: case 0xce: case 0xd6: case 0xde: case 0xe6: case 0xee: case 0xf6: case 0xfe:
+			return true;
+
+		// XCHG.
+		case 0xeb:
+			return true;
+	}
+
+	// Everything else below 0xc0 is a register/flag update or a memory read
+	// (0xc0 and above: stack, calls, returns, restarts, I/O, EI/DI).
+	return op < 0xc0;
+}
+
+// Whether the loop body closed by the jump at each address of the ROM in s_LoopBodyRom is free of side effects (see
+// InitCpuCaches, only read once it has been built).
+static bool s_SideEffectFreeLoopBodies[ 0x2000 ];
+static const Uint8 * s_LoopBodyRom = NULL;
+
+static bool FindSideEffectFreeLoopBody( const MachineMemory & memory, address branchPc, address target )
+{
+	bool sideEffectFree = true;
+	address pc = target;
+	while ( pc < branchPc )
+	{
+		if ( ! IsSideEffectFreeInstruction( memory[ pc ] ) )
+		{
+			sideEffectFree = false;
+			break;
+		}
+		pc += InstructionSize[ memory[ pc ] ];
+	}
+
+	// Must land exactly on the branch (i.e. we haven't decoded immediates as instructions).
+	return sideEffectFree && pc == branchPc;
+}
+
+static bool IsSideEffectFreeLoopBody( const Cpu8080 & chip8, address branchPc, address target )
+{
+	if ( target > branchPc || branchPc - target >= kIdleLoopMaxBodySize )
+		return false;
+
+	// A loop is only closed by a jump back to its operand (the cache's target) in the ROM.
+	if ( chip8.Memory.Rom == s_LoopBodyRom && branchPc < 0x2000 )
+		return s_SideEffectFreeLoopBodies[ branchPc ];
+
+	return FindSideEffectFreeLoopBody( chip8.Memory, branchPc, target );
+}
+
+// Call after a backward jump from branchPc. Returns true when the loop is known to spin until the next interrupt.
+static bool IsIdleLoop( Cpu8080 & chip8, address branchPc )
+{
+	Cpu8080::IdleLoop & idle = chip8.Idle;
+	const address target = chip8.Cpu.Regs.pc;
+
+	if ( ! IsSideEffectFreeLoopBody( chip8, branchPc, target ) )
+	{
+		idle.Active = false;
+		return false;
+	}
+
+	if ( idle.Active && idle.Start == target && idle.End == branchPc && memcmp( &idle.Regs, &chip8.Cpu.Regs, sizeof( idle.Regs ) ) == 0 )
+	{
+		return true;
+	}
+
+	// First trip round (or something changed), remember where we were.
+	idle.Active = true;
+	idle.Start = target;
+	idle.End = branchPc;
+	idle.Regs = chip8.Cpu.Regs;
+	idle.Clock = chip8.InstructionsSinceInterrupt;
+	return false;
+}
+
+const Uint8 kNoRom[ kRomImageSize ] = { 0 };
+
+const Uint8 * InternRom( const Uint8 * rom )
+{
+	static std::vector< Uint8 * > s_Roms;
+
+	for ( size_t ix = 0; ix < s_Roms.size( ); ++ix )
+	{
+		if ( memcmp( s_Roms[ ix ], rom, 0x2000 ) == 0 )
+			return s_Roms[ ix ];
+	}
+
+	s_Roms.push_back( new Uint8[ kRomImageSize ] );
+	memcpy( s_Roms.back( ), rom, 0x2000 );
+	memset( s_Roms.back( ) + 0x2000, 0, kRomImageSize - 0x2000 );
+	return s_Roms.back( );
+}
+
+// Executes an 8 bit ALU instruction (ADD to CMP and their immediates, INR, DCR, DAA) with a lookup in the ALU tables
+// for the result and every flag it sets, returns false if it isn't one. Leaves pc on the last byte, as the cases do.
+static inline bool ExecuteAluFromTables( Cpu8080 & chip8, Uint8 instruction, Uint8 immediate )
+{
+	typedef Cpu8080::CommandProcessingUnit::Registers Registers;
+	const AluTables & tables = *g_AluTables;
+
+	if ( ( instruction & 0xc0 ) == 0x80 || ( instruction & 0xc7 ) == 0xc6 )
+	{
+		const Uint8 s = instruction & 7;
+		Uint8 operand;
+		if ( instruction >= 0xc0 )
+		{
+			operand = immediate;
+			IncrementPc( );
+		}
+		else
+		{
+			operand = s == Registers::Gpr::___MEMORY ? GetHlMemory8( ) : chip8.Cpu.Regs.gpr[ RegIndex( s ) ];
+		}
+
+		// CMP's entries hold the accumulator unchanged.
+		const Uint16 entry = tables.Binary[ ( instruction >> 3 ) & 7 ][ GetFlags( ).cy ][ ( GetAccumulator( ) << 8 ) | operand ];
+		SetAccumulator( ( Uint8 )entry );
+		SetFlags( ( GetFlags( ).u8 & ~tables.AllFlags ) | ( entry >> 8 ) );
+		return true;
+	}
+
+	if ( ( instruction & 0xc6 ) == 0x04 )
+	{
+		const Uint8 d = ( instruction >> 3 ) & 7;
+		const Uint16 * table = ( instruction & 1 ) ? tables.Dcr : tables.Inr;
+		Uint16 entry;
+		if ( d == Registers::Gpr::___MEMORY )
+		{
+			entry = table[ GetHlMemory8( ) ];
+			SetHlMemory8( ( Uint8 )entry );
+		}
+		else
+		{
+			Uint8 & r = chip8.Cpu.Regs.gpr[ RegIndex( d ) ];
+			entry = table[ r ];
+			r = ( Uint8 )entry;
+		}
+		SetFlags( ( GetFlags( ).u8 & ~tables.FlagsButCarry ) | ( entry >> 8 ) );
+		return true;
+	}
+
+	if ( instruction == 0x27 )
+	{
+		const Uint16 entry = tables.Daa[ ( GetFlags( ).cy << 9 ) | ( GetFlags( ).ac << 8 ) | GetAccumulator( ) ];
+		SetAccumulator( ( Uint8 )entry );
+		SetFlags( ( GetFlags( ).u8 & ~tables.AllFlags ) | ( entry >> 8 ) );
+		return true;
+	}
+
+	return false;
+}
+
+bool g_SkipIdleLoops = true;
+
+// Executes the instruction at pc (already fetched, or a RST standing in for an interrupt) and moves pc on. Keeping the
+// clock and taking interrupts are left to the caller. UseHandlers takes the opcodes kOpcodeHandlers covers from the
+// table; without it every opcode is decoded by the switch, which the reference engine keeps as a check on the table.
+template< bool UseHandlers >
+static inline void ExecuteInstruction( Cpu8080 & chip8, Uint8 instruction )
+{
+	Uint8  s = instruction & 7;
+	Uint8  d = ( instruction >> 3 ) & 7;
+	const address operandPc = chip8.Cpu.Regs.pc + 1;
+	Uint8  immediate = chip8.Memory.Rom[ operandPc ];
+	Uint16 immediate16 = ( chip8.Memory.Rom[ operandPc + 1 ] << 8 ) | chip8.Memory.Rom[ operandPc ];
+
+	const OpcodeHandler handler = UseHandlers ? kOpcodeHandlers[ instruction ] : NULL;
+	if ( chip8.AluTablesEnabled && ExecuteAluFromTables( chip8, instruction, immediate ) )
+	{
+		// Done from the tables rather than the case below.
+	}
+	else if ( handler )
+	{
+		// MOV, MVI, INR, DCR, the ALU ops and their immediates, LXI, INX, DCX, DAD, STAX, LDAX and NOP are specialised
+		// for each opcode (see OpcodeHandlers.h), and move pc on themselves.
+		DumpDisassembly( "%s", GetCfgMnemonic( instruction ) );
+		handler( chip8 );
+		return;
+	}
+	else switch ( instruction )
+	{
+		// ------------------------------------------------------------
+		// Move, Load & Store.
+		// ------------------------------------------------------------
+
+		// Source + Destination variations.
+		case _GenDstSrcVariations( 0x40 ):
+		{
+			// Move register.
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "MOV %s, %s", RegName( d ), RegName( s ) );
+			DumpInstruction( "r%d = r%d", d, s );
+			chip8.Cpu.Regs.gpr[ RegIndex( d ) ] = chip8.Cpu.Regs.gpr[ RegIndex( s ) ];
+		}
+		break;
+
+		// Just source variations.
+		case _GenSrcVariations( 0x70 ):
+		{
+			// Move register to memory.
+			// Cycles : 2
+			// States : 7
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "MOV M, %s", RegName( s ) );
+			DumpInstruction( "(HL) = r%d", s );
+			SetHlMemory8( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
+		}
+		break;
+
+		// Just destination variations.
+		case _GenDstVariations( 0x46 ):
+		{
+			// Move memory to register.
+			// Cycles : 2
+			// States : 7
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "MOV %s, M", RegName( d ) );
+			DumpInstruction( "r%d = (HL)", d );
+			chip8.Cpu.Regs.gpr[ RegIndex( d ) ] = GetHlMemory8( );
+		}
+		break;
+
+		// Just destination variations.
+		case _GenDstVariations( 0x6 ):
+		{
+			// Move intermediate to register.
+			// Cycles : 2
+			// States : 7
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "MVI %s, 0x%x", RegName( d ), immediate );
+			DumpInstruction( "r%d = 0x%x", d, immediate );
+			chip8.Cpu.Regs.gpr[ RegIndex( d ) ] = immediate;
+
+			// Skip over immediate we read into register.
+			IncrementPc( );
+		}
+		break;
+
+		case 0x36:
+		{
+			// Move immediate memory.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "MVI M, 0x%x", immediate );
+			DumpInstruction( "(HL) = 0x%x", immediate );
+			SetHlMemory8( immediate );
+
+			// Next instruction is immediate we just used.
+			IncrementPc( );
+		}
+		break;
+
+		case 0x1:
+		{
+			// Load immediate into register pair BC
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "LXI B, 0x%x", immediate16 );
+			DumpInstruction( "BC = 0x%x", immediate16 );
+			SetRegisterBc( immediate16 );
+
+			// Next two instruction are immediates we just used.
+			DoubleIncrementPc( );
+		}
+		break;
+
+		case 0x11:
+		{
+			// Load immediate into register pair DE
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "LXI D, 0x%x", immediate16 );
+			DumpInstruction( "DE = 0x%x", immediate16 );
+			SetRegisterDe( immediate16 );
+
+			// Next two instruction are immediates we just used.
+			DoubleIncrementPc( );
+		}
+		break;
+
+		case 0x21:
+		{
+			// Load immediate into register pair HL
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "LXI H, 0x%x", immediate16 );
+			DumpInstruction( "HL = 0x%x", immediate16 );
+			SetRegisterHl( immediate16 );
+
+			// Next two instruction are immediates we just used.
+			DoubleIncrementPc( );
+		}
+		break;
+
+		case 0x2:
+		{
+			// Store accumulator into (BC).
+			// Cycles : 2
+			// States : 7
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "STAX B" );
+			DumpInstruction( "(BC) = accumulator" );
+			SetBcMemory8( GetAccumulator( ) );
+		}
+		break;
+
+		case 0x12:
+		{
+			// Store accumulator into (DE).
+			// Cycles : 2
+			// States : 7
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "STAX D" );
+			DumpInstruction( "(DE) = accumulator" );
+			SetDeMemory8( GetAccumulator( ) );
+		}
+		break;
+
+		case 0xa:
+		{
+			// Load accumulator from (BC).
+			// Cycles : 2
+			// States : 7
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "LDAX B" );
+			DumpInstruction( "accumulator = (BC)" );
+			SetAccumulator( GetBcMemory8( ) );
+		}
+		break;
+
+		case 0x1a:
+		{
+			// Load accumulator from (DE).
+			// Cycles : 2
+			// States : 7
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "LDAX D" );
+			DumpInstruction( "accumulator = (DE)" );
+			SetAccumulator( GetDeMemory8( ) );
+		}
+		break;
+
+		case 0x32:
+		{
+			// Store accumulator to address.
+			// Cycles : 4
+			// States : 13
+			// Flags  : none
+			// Addressing : direct
+			DumpDisassembly( "STA 0x%x", immediate16 );
+			DumpInstruction( "(immediate16) = accumulator" );
+			SetMemory8AtAddress( immediate16, GetAccumulator( ) );
+
+			// Next two instruction are address we just used.
+			DoubleIncrementPc( );
+		}
+		break;
+
+		case 0x3a:
+		{
+			// Load accumulator from address.
+			// Cycles : 4
+			// States : 13
+			// Flags  : none
+			// Addressing : direct
+			DumpDisassembly( "LDA 0x%x", immediate16 );
+			DumpInstruction( "accumulator = (immediate16)" );
+			SetAccumulator( GetMemory8AtAddress( immediate16 ) );
+
+			// Next two instruction are address we just used.
+			DoubleIncrementPc( );
+		}
+		break;
+
+		case 0x22:
+		{
+			// Store HL direct.
+			// Cycles : 5
+			// States : 16
+			// Flags  : none
+			// Addressing : direct
+			DumpDisassembly( "SHLD" );
+			DumpInstruction( "(immediate16) = HL" );
+			SetMemory16AtAddress( immediate16, GetRegisterHl( ) );
+
+			// Next two instruction are address we just used.
+			DoubleIncrementPc( );
+		}
+		break;
+
+		case 0x2a:
+		{
+			// Load HL direct.
+			// Cycles : 5
+			// States : 16
+			// Flags  : none
+			// Addressing : direct
+			DumpDisassembly( "LHLD" );
+			DumpInstruction( "HL = (immediate16)" );
+			SetRegisterHl( GetMemory16AtAddress( immediate16 ) );
+
+			// Next two instruction are address we just used.
+			DoubleIncrementPc( );
+		}
+		break;
+
+		case 0xeb:
+		{
+			// Exchange DE and HL.
+			// Cycles : 1
+			// States : 4
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "XCHG" );
+			DumpInstruction( "DE <=> HL" );
+			Uint16 de = GetRegisterDe( );
+			Uint16 hl = GetRegisterHl( );
+			SetRegisterDe( hl );
+			SetRegisterHl( de );
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Stack operations.
+		// ------------------------------------------------------------
+		case 0xc5:
+		{
+			// Push BC onto stack.
+			// Cycles : 3
+			// States : 11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "PUSH B" );
+			DumpInstruction( "(SP-2) = BC ; SP -= 2" );
+			PushAndDecrementStack16( GetRegisterBc( ) );
+		}
+		break;
+
+		case 0xd5:
+		{
+			// Push DE onto stack.
+			// Cycles : 3
+			// States : 11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "PUSH D" );
+			DumpInstruction( "(SP-2) = DE ; SP -= 2" );
+			PushAndDecrementStack16( GetRegisterDe( ) );
+		}
+		break;
+
+		case 0xe5:
+		{
+			// Push HL onto stack.
+			// Cycles : 3
+			// States : 11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "PUSH H" );
+			DumpInstruction( "(SP-2) = HL ; SP -= 2" );
+			PushAndDecrementStack16( GetRegisterHl( ) );
+		}
+		break;
+
+		case 0xf5:
+		{
+			// Push A and flags onto stack.
+			// Cycles : 3
+			// States : 11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "PUSH PSW" );
+			DumpInstruction( "(SP-1) = A ; (SP-2) = FLAGS ; SP -= 2" );
+			PushAndDecrementStack8( GetAccumulator( ) );
+			PushAndDecrementStack8( GetFlags( ).u8 );
+		}
+		break;
+
+		case 0xc1:
+		{
+			// Pop BC from stack.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "POP B" );
+			DumpInstruction( "BC = (SP) ; SP += 2" );
+			SetRegisterBc( PopStack16( ) );
+			DoubleIncrementSp( );
+		}
+		break;
+
+		case 0xd1:
+		{
+			// Pop DE from stack.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "POP D" );
+			DumpInstruction( "DE = (SP) ; SP += 2" );
+			SetRegisterDe( PopStack16( ) );
+			DoubleIncrementSp( );
+		}
+		break;
+
+		case 0xe1:
+		{
+			// Pop HL from stack.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "POP H" );
+			DumpInstruction( "HL = (SP) ; SP += 2" );
+			SetRegisterHl( PopStack16( ) );
+			DoubleIncrementSp( );
+		}
+		break;
+
+		case 0xf1:
+		{
+			// Pop A and flags from stack.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "POP PSW" );
+			DumpInstruction( "FLAGS = (SP) ; A = (SP+1) ; SP += 2" );
+			SetFlags( PopStack8( ) );
+			IncrementSp( );
+			SetAccumulator( PopStack8( ) );
+			IncrementSp( );
+		}
+		break;
+
+		case 0xe3:
+		{
+			// (SP) <=> HL.
+			// Cycles : 5
+			// States : 18
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "XTHL" );
+			DumpInstruction( "(SP) <=> HL" );
+			Uint16 hl = GetRegisterHl( );
+			Uint16 derefSp = GetMemory16AtAddress( GetRegisterSp( ) );
+			SetRegisterHl( derefSp );
+			SetMemory16AtAddress( GetRegisterSp( ), hl );
+		}
+		break;
+
+		case 0xf9:
+		{
+			// SP = HL.
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "SPHL" );
+			DumpInstruction( "SP = HL" );
+			SetRegisterSp( GetRegisterHl( ) );
+		}
+		break;
+
+		case 0x31:
+		{
+			// Load immediate into SP
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "LXI SP, 0x%x", immediate16 );
+			DumpInstruction( "SP = 0x%x", immediate16 );
+			SetRegisterSp( immediate16 );
+
+			// Next two instruction are immediates we just used.
+ 				DoubleIncrementPc( );
+		}
+		break;
+
+		case 0x33:
+		{
+			// Increments SP by one
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "INX SP" );
+			DumpInstruction( "SP++" );
+			SetRegisterSp( GetRegisterSp( ) + 1 );
+		}
+		break;
+
+		case 0x3b:
+		{
+			// Decrements SP by one
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "DCX SP" );
+			DumpInstruction( "SP--" );
+			SetRegisterSp( GetRegisterSp( ) - 1 );
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Jump.
+		// ------------------------------------------------------------
+		case 0xc3:
+		{
+			// Jump to specified address.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "JMP 0x%x", immediate16 );
+			DumpInstruction( "PC = immediate16" );
+
+			// -1 to take account of the increment at the end of the loop.
+			SetRegisterPc( immediate16 - 1 );
+		}
+		break;
+
+		case 0xda:
+		{
+			// Jump to specified address if carry flag is set.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "JC 0x%x", immediate16 );
+			DumpInstruction( "If carry bit set then PC = immediate16" );
+
+			if ( chip8.Cpu.Regs.flags.cy )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xd2:
+		{
+			// Jump to specified address if carry flag is not set.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "JNC 0x%x", immediate16 );
+			DumpInstruction( "If carry bit not set then PC = immediate16" );
+
+			if ( ! chip8.Cpu.Regs.flags.cy )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xca:
+		{
+			// Jump to specified address if zero flag is set.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "JZ 0x%x", immediate16 );
+			DumpInstruction( "If zero bit set then PC = immediate16" );
+
+			if ( chip8.Cpu.Regs.flags.z )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xc2:
+		{
+			// Jump to specified address if zero flag is not set.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "JNZ 0x%x", immediate16 );
+			DumpInstruction( "If zero bit not set then PC = immediate16" );
+
+			if ( ! chip8.Cpu.Regs.flags.z )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xf2:
+		{
+			// Jump to specified address if positive.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "JP 0x%x", immediate16 );
+			DumpInstruction( "If positive then PC = immediate16" );
+
+			if ( ! chip8.Cpu.Regs.flags.s )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xfa:
+		{
+			// Jump to specified address if negative.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "JM 0x%x", immediate16 );
+			DumpInstruction( "If negative then PC = immediate16" );
+
+			if ( chip8.Cpu.Regs.flags.s )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xea:
+		{
+			// Jump to specified address if parity even.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "JPE 0x%x", immediate16 );
+			DumpInstruction( "If parity even then PC = immediate16" );
+
+			if ( chip8.Cpu.Regs.flags.p )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xe2:
+		{
+			// Jump to specified address if parity odd.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : immediate
+			DumpDisassembly( "JPO 0x%x", immediate16 );
+			DumpInstruction( "If parity odd then PC = immediate16" );
+
+			if ( ! chip8.Cpu.Regs.flags.p )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xe9:
+		{
+			// Jump to HL value.
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "PCHL" );
+			DumpInstruction( "PC = HL" );
+
+			// -1 to take account of the increment at the end of the loop.
+			SetRegisterPc( GetRegisterHl( ) - 1 );
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Call.
+		// ------------------------------------------------------------
+		case 0xcd:
+		{
+			// Calls specified address (save next PC location to stack).
+			// Cycles : 5
+			// States : 17
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "CALL 0x%x", immediate16 );
+			DumpInstruction( "(SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
+
+			// Store next instruction (+3 as next two bytes make up the jump to address).
+			PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
+
+			// -1 to take account of the increment at the end of the loop.
+			SetRegisterPc( immediate16 - 1 );
+		}
+		break;
+
+		case 0xdc:
+		{
+			// Calls specified address on carry (save next PC location to stack).
+			// Cycles : 3/5
+			// States : 11/17
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "CC 0x%x", immediate16 );
+			DumpInstruction( "If carry (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
+
+			if ( GetFlags( ).cy )
+			{
+				// Store next instruction (+3 as next two bytes make up the jump to address).
+				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
+
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xd4:
+		{
+			// Calls specified address on no carry (save next PC location to stack).
+			// Cycles : 3/5
+			// States : 11/17
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "CNC 0x%x", immediate16 );
+			DumpInstruction( "If no carry (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
+
+			if ( ! GetFlags( ).cy )
+			{
+				// Store next instruction (+3 as next two bytes make up the jump to address).
+				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
+
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xcc:
+		{
+			// Calls specified address on zero (save next PC location to stack).
+			// Cycles : 3/5
+			// States : 11/17
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "CZ 0x%x", immediate16 );
+			DumpInstruction( "If zero (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
+
+			if ( GetFlags( ).z )
+			{
+				// Store next instruction (+3 as next two bytes make up the jump to address).
+				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
+
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xc4:
+		{
+			// Calls specified address on not zero (save next PC location to stack).
+			// Cycles : 3/5
+			// States : 11/17
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "CNZ 0x%x", immediate16 );
+			DumpInstruction( "If zero (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
+
+			if ( ! GetFlags( ).z )
+			{
+				// Store next instruction (+3 as next two bytes make up the jump to address).
+				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
+
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xf4:
+		{
+			// Calls specified address on positive (save next PC location to stack).
+			// Cycles : 3/5
+			// States : 11/17
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "CP 0x%x", immediate16 );
+			DumpInstruction( "If positive (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
+
+			if ( ! GetFlags( ).s )
+			{
+				// Store next instruction (+3 as next two bytes make up the jump to address).
+				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
+
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xfc:
+		{
+			// Calls specified address on negative (save next PC location to stack).
+			// Cycles : 3/5
+			// States : 11/17
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "CM 0x%x", immediate16 );
+			DumpInstruction( "If positive (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
+
+			if ( GetFlags( ).s )
+			{
+				// Store next instruction (+3 as next two bytes make up the jump to address).
+				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
+
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xec:
+		{
+			// Calls specified address on parity even (save next PC location to stack).
+			// Cycles : 3/5
+			// States : 11/17
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "CPE 0x%x", immediate16 );
+			DumpInstruction( "If parity even (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
+
+			if ( GetFlags( ).p )
+			{
+				// Store next instruction (+3 as next two bytes make up the jump to address).
+				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
+
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		case 0xe4:
+		{
+			// Calls specified address on parity odd (save next PC location to stack).
+			// Cycles : 3/5
+			// States : 11/17
+			// Flags  : none
+			// Addressing : immediate/register indirect
+			DumpDisassembly( "CPO 0x%x", immediate16 );
+			DumpInstruction( "If parity odd (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
+
+			if ( ! GetFlags( ).p )
+			{
+				// Store next instruction (+3 as next two bytes make up the jump to address).
+				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
+
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( immediate16 - 1 );
+			}
+			else
+			{
+				// Next two instruction are address we didn't jump to.
+				DoubleIncrementPc( );
+			}
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Return.
+		// ------------------------------------------------------------
+		case 0xc9:
+		{
+			// Return to caller (on stack).
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RET" );
+			DumpInstruction( "Return to caller" );
+
+
+			// -1 to take account of the increment at the end of the loop.
+			SetRegisterPc( PopStack16( ) - 1 );
+
+			// We have popped the last two stack entries.
+			DoubleIncrementSp( );
+		}
+		break;
+
+		case 0xd8:
+		{
+			// Return on carry to caller (on stack).
+			// Cycles : 1/3
+			// States : 5/11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RC" );
+			DumpInstruction( "Return on carry to caller" );
+
+			if ( GetFlags( ).cy )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( PopStack16( ) - 1 );
+
+				// We have popped the last two stack entries.
+				DoubleIncrementSp( );
+			}
+		}
+		break;
+
+		case 0xd0:
+		{
+			// Return on not carry to caller (on stack).
+			// Cycles : 1/3
+			// States : 5/11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RNC" );
+			DumpInstruction( "Return on not carry to caller" );
+
+			if ( ! GetFlags( ).cy )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( PopStack16( ) - 1 );
+
+				// We have popped the last two stack entries.
+				DoubleIncrementSp( );
+			}
+		}
+		break;
+
+		case 0xc8:
+		{
+			// Return on zero to caller (on stack).
+			// Cycles : 1/3
+			// States : 5/11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RZ" );
+			DumpInstruction( "Return on zero to caller" );
+
+			if ( GetFlags( ).z )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( PopStack16( ) - 1 );
+
+				// We have popped the last two stack entries.
+				DoubleIncrementSp( );
+			}
+		}
+		break;
+
+		case 0xc0:
+		{
+			// Return on not zero to caller (on stack).
+			// Cycles : 1/3
+			// States : 5/11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RNZ" );
+			DumpInstruction( "Return on not zero to caller" );
+
+			if ( ! GetFlags( ).z )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( PopStack16( ) - 1 );
+
+				// We have popped the last two stack entries.
+				DoubleIncrementSp( );
+			}
+		}
+		break;
+
+		case 0xf0:
+		{
+			// Return on positive to caller (on stack).
+			// Cycles : 1/3
+			// States : 5/11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RP" );
+			DumpInstruction( "Return on positive to caller" );
+
+			if ( ! GetFlags( ).s )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( PopStack16( ) - 1 );
+
+				// We have popped the last two stack entries.
+				DoubleIncrementSp( );
+			}
+		}
+		break;
+
+		case 0xf8:
+		{
+			// Return on negative to caller (on stack).
+			// Cycles : 1/3
+			// States : 5/11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RM" );
+			DumpInstruction( "Return on negative to caller" );
+
+			if ( GetFlags( ).s )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( PopStack16( ) - 1 );
+
+				// We have popped the last two stack entries.
+				DoubleIncrementSp( );
+			}
+		}
+		break;
+
+		case 0xe8:
+		{
+			// Return on parity even to caller (on stack).
+			// Cycles : 1/3
+			// States : 5/11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RPE" );
+			DumpInstruction( "Return on parity even to caller" );
+
+			if ( GetFlags( ).p )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( PopStack16( ) - 1 );
+
+				// We have popped the last two stack entries.
+				DoubleIncrementSp( );
+			}
+		}
+		break;
+
+		case 0xe0:
+		{
+			// Return on parity odd to caller (on stack).
+			// Cycles : 1/3
+			// States : 5/11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RPO" );
+			DumpInstruction( "Return on parity odd to caller" );
+
+			if ( ! GetFlags( ).p )
+			{
+				// -1 to take account of the increment at the end of the loop.
+				SetRegisterPc( PopStack16( ) - 1 );
+
+				// We have popped the last two stack entries.
+				DoubleIncrementSp( );
+			}
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Restart.
+		// ------------------------------------------------------------
+		case _GenDstVariations( 0xc7 ):
+		{
+			// Restart.
+			// Cycles : 3
+			// States : 11
+			// Flags  : none
+			// Addressing : register indirect
+			DumpDisassembly( "RST" );
+			DumpInstruction( "Restart" );
+
+			// Store next instruction (+1 as we don't have any extra data for this instruction, it is encoded into the instruction).
+			PushAndDecrementStack16( chip8.Cpu.Regs.pc + 1 );
+
+			// -1 to take account of the increment at the end of the loop.
+			SetRegisterPc( ( d * 8 ) - 1 );
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Increment and decrement.
+		// ------------------------------------------------------------
+		case _GenDstVariations( 0x4 ):
+		{
+			// Increment register.
+			// Cycles : 1
+			// States : 5
+			// Flags  : Z, S, P, AC
+			// Addressing : register
+			DumpDisassembly( "INR %s", RegName( d ) );
+			DumpInstruction( "r%d += 1", d );
+
+			chip8.Cpu.Regs.gpr[ RegIndex( d ) ] += 1;
+
+			GetFlags( ).z = chip8.Cpu.Regs.gpr[ RegIndex( d ) ] == 0;
+			GetFlags( ).s = chip8.Cpu.Regs.gpr[ RegIndex( d ) ] >> 7;
+			GetFlags( ).p = ParityTable256[ chip8.Cpu.Regs.gpr[ RegIndex( d ) ] ];
+			GetFlags( ).ac = ( chip8.Cpu.Regs.gpr[ RegIndex( d ) ] & 0xf ) == 0x0;
+		}
+		break;
+
+		case _GenDstVariations( 0x5 ):
+		{
+			// Decrement register.
+			// Cycles : 1
+			// States : 5
+			// Flags  : Z, S, P, AC
+			// Addressing : register
+			DumpDisassembly( "DCR %s", RegName( d ) );
+			DumpInstruction( "r%d -= 1", d );
+
+			chip8.Cpu.Regs.gpr[ RegIndex( d ) ] -= 1;
+
+			GetFlags( ).z = chip8.Cpu.Regs.gpr[ RegIndex( d ) ] == 0;
+			GetFlags( ).s = chip8.Cpu.Regs.gpr[ RegIndex( d ) ] >> 7;
+			GetFlags( ).p = ParityTable256[ chip8.Cpu.Regs.gpr[ RegIndex( d ) ] ];
+			GetFlags( ).ac = ( chip8.Cpu.Regs.gpr[ RegIndex( d ) ] & 0xf ) != 0xf;
+		}
+		break;
+
+		case 0x34:
+		{
+			// Increment value in memory (HL).
+			// Cycles : 3
+			// States : 10
+			// Flags  : Z, S, P, AC
+			// Addressing : register indirect
+			DumpDisassembly( "INR M" );
+			DumpInstruction( "(HL) += 1" );
+
+			Uint8 v = GetHlMemory8( );
+			v += 1;
+			SetHlMemory8( v );
+
+			GetFlags( ).z = v == 0;
+			GetFlags( ).s = v >> 7;
+			GetFlags( ).p = ParityTable256[ v ];
+			GetFlags( ).ac = ( v & 0xf ) == 0x0;
+		}
+		break;
+
+		case 0x35:
+		{
+			// Decrement value in memory (HL).
+			// Cycles : 3
+			// States : 10
+			// Flags  : Z, S, P, AC
+			// Addressing : register
+			DumpDisassembly( "DCR M" );
+			DumpInstruction( "(HL) -= 1" );
+
+			Uint8 v = GetHlMemory8( );
+			v -= 1;
+			SetHlMemory8( v );
+
+			GetFlags( ).z = v == 0;
+			GetFlags( ).s = v >> 7;
+			GetFlags( ).p = ParityTable256[ v ];
+			GetFlags( ).ac = ( v & 0xf ) != 0xf;
+		}
+		break;
+
+		case 0x03:
+		{
+			// Increment BC.
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "INX B" );
+			DumpInstruction( "BC += 1" );
+
+			chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::BC ] += 1;
+		}
+		break;
+
+		case 0x13:
+		{
+			// Increment DE.
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "INX D" );
+			DumpInstruction( "DE += 1" );
+
+			chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::DE ] += 1;
+		}
+		break;
+
+		case 0x23:
+		{
+			// Increment HL.
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "INX H" );
+			DumpInstruction( "HL += 1" );
+
+			chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::HL ] += 1;
+		}
+		break;
+
+		case 0x0b:
+		{
+			// Decrement BC.
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "DCX B" );
+			DumpInstruction( "BC -= 1" );
+
+			chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::BC ] -= 1;
+		}
+		break;
+
+		case 0x1b:
+		{
+			// Decrement DE.
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "DCX D" );
+			DumpInstruction( "DE -= 1" );
+
+			chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::DE ] -= 1;
+		}
+		break;
+
+		case 0x2b:
+		{
+			// Decrement HL.
+			// Cycles : 1
+			// States : 5
+			// Flags  : none
+			// Addressing : register
+			DumpDisassembly( "DCX H" );
+			DumpInstruction( "HL -= 1" );
+
+			chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::HL ] -= 1;
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Add.
+		// ------------------------------------------------------------
+		case _GenSrcVariations( 0x80 ):
+		{
+			// Add register to accumulator.
+			// Cycles : 1
+			// States : 4
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register
+			DumpDisassembly( "ADD %s", RegName( s ) );
+			DumpInstruction( "accumulator += r%d", s );
+
+			// Result (as 16 bit to detect carry).
+			Uint16 r  = chip8.Cpu.Regs.accumulator + chip8.Cpu.Regs.gpr[ RegIndex( s ) ];
+
+			// Result of adding lower nibbles together (to detect auxiliary carry).
+			Uint8 nr = ( chip8.Cpu.Regs.accumulator & 0xf ) + ( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf );
+
+			// Truncate Uint16 to Uint8, we handle flags after.
+			chip8.Cpu.Regs.accumulator = ( Uint8 )r;
+
+			GetFlags( ).z = chip8.Cpu.Regs.accumulator == 0;
+			GetFlags( ).s = chip8.Cpu.Regs.accumulator >> 7;
+			GetFlags( ).p = ParityTable256[ chip8.Cpu.Regs.accumulator ];
+			GetFlags( ).cy = r > 0xff;
+			GetFlags( ).ac = nr > 0xf;
+		}
+		break;
+
+		case _GenSrcVariations( 0x88 ):
+		{
+			// Add register and carry flag to accumulator.
+			// Cycles : 1
+			// States : 4
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register
+			DumpDisassembly( "ADC %s", RegName( s ) );
+			DumpInstruction( "accumulator += r%d + carry", s );
+
+			// Result (as 16 bit to detect carry).
+			Uint16 r  = chip8.Cpu.Regs.accumulator + chip8.Cpu.Regs.gpr[ RegIndex( s ) ] + GetFlags( ).cy;
+
+			// Result of adding lower nibbles together (to detect auxiliary carry).
+			Uint8 nr = ( chip8.Cpu.Regs.accumulator & 0xf ) + ( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf ) + GetFlags( ).cy;
+
+			// Truncate Uint16 to Uint8, we handle flags after.
+			chip8.Cpu.Regs.accumulator = ( Uint8 )r;
+
+			GetFlags( ).z = chip8.Cpu.Regs.accumulator == 0;
+			GetFlags( ).s = chip8.Cpu.Regs.accumulator >> 7;
+			GetFlags( ).p = ParityTable256[ chip8.Cpu.Regs.accumulator ];
+			GetFlags( ).cy = r > 0xff;
+			GetFlags( ).ac = nr > 0xf;
+		}
+		break;
+
+		case 0x86:
+		{
+			// Add (HL) to accumulator.
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register indirect
+			DumpDisassembly( "ADD M" );
+			DumpInstruction( "accumulator += (HL)" );
+
+			// Result (as 16 bit to detect carry).
+			Uint16 r  = GetAccumulator( ) + GetHlMemory8( );
+
+			// Result of adding lower nibbles together (to detect auxiliary carry).
+			Uint8 nr = ( GetAccumulator( ) & 0xf ) + ( GetHlMemory8( ) & 0xf );
+
+			// Truncate Uint16 to Uint8, we handle flags after.
+			SetAccumulator( ( Uint8 )r );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r > 0xff;
+			GetFlags( ).ac = nr > 0xf;
+		}
+		break;
+
+		case 0x8e:
+		{
+			// Add (HL) and carry flag to accumulator.
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register indirect
+			DumpDisassembly( "ADC M" );
+			DumpInstruction( "accumulator += (HL) + carry" );
+
+			// Result (as 16 bit to detect carry).
+			Uint16 r  = GetAccumulator( ) + GetHlMemory8( ) + GetFlags( ).cy;
+
+			// Result of adding lower nibbles together (to detect auxiliary carry).
+			Uint8 nr = ( GetAccumulator( ) & 0xf ) + ( GetHlMemory8( ) & 0xf ) + GetFlags( ).cy;
+
+			// Truncate Uint16 to Uint8, we handle flags after.
+			SetAccumulator( ( Uint8 )r );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r > 0xff;
+			GetFlags( ).ac = nr > 0xf;
+		}
+		break;
+
+		case 0xc6:
+		{
+			// Add immediate to accumulator.
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : immediate
+			DumpDisassembly( "ADI 0x%x", immediate );
+			DumpInstruction( "accumulator += %d", immediate );
+
+			// Result (as 16 bit to detect carry).
+			Uint16 r  = GetAccumulator( ) + immediate;
+
+			// Result of adding lower nibbles together (to detect auxiliary carry).
+			Uint8 nr = ( GetAccumulator( ) & 0xf ) + ( immediate & 0xf );
+
+			// Truncate Uint16 to Uint8, we handle flags after.
+			SetAccumulator( ( Uint8 )r );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r > 0xff;
+			GetFlags( ).ac = nr > 0xf;
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		case 0xce:
+		{
+			// Add immediate and carry to accumulator.
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : immediate
+			DumpDisassembly( "ACI 0x%x", immediate );
+			DumpInstruction( "accumulator += %d + carry", immediate );
+
+			// Result (as 16 bit to detect carry).
+			Uint16 r  = GetAccumulator( ) + immediate + GetFlags( ).cy;
+
+			// Result of adding lower nibbles together (to detect auxiliary carry).
+			Uint8 nr = ( GetAccumulator( ) & 0xf ) + ( immediate & 0xf ) + GetFlags( ).cy;
+
+			// Truncate Uint16 to Uint8, we handle flags after.
+			SetAccumulator( ( Uint8 )r );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r > 0xff;
+			GetFlags( ).ac = nr > 0xf;
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		case 0x09:
+		{
+			// Add BC to HL.
+			// Cycles : 3
+			// States : 10
+			// Flags  : CY
+			// Addressing : register
+			DumpDisassembly( "DAD B" );
+			DumpInstruction( "HL += BC" );
+
+			// Result (as 32 bit to detect carry).
+			Uint32 r  = GetRegisterHl( ) + GetRegisterBc( );
+
+			// Truncate Uint32 to Uint16, we handle flags after.
+			SetRegisterHl( ( Uint16 )r );
+
+			GetFlags( ).cy = r > 0xffff;
+		}
+		break;
+
+		case 0x19:
+		{
+			// Add DE to HL.
+			// Cycles : 3
+			// States : 10
+			// Flags  : CY
+			// Addressing : register
+			DumpDisassembly( "DAD D" );
+			DumpInstruction( "HL += DE" );
+
+			// Result (as 32 bit to detect carry).
+			Uint32 r  = GetRegisterHl( ) + GetRegisterDe( );
+
+			// Truncate Uint32 to Uint16, we handle flags after.
+			SetRegisterHl( ( Uint16 )r );
+
+			GetFlags( ).cy = r > 0xffff;
+		}
+		break;
+
+		case 0x29:
+		{
+			// Add HL to HL.
+			// Cycles : 3
+			// States : 10
+			// Flags  : CY
+			// Addressing : register
+			DumpDisassembly( "DAD H" );
+			DumpInstruction( "HL += HL" );
+
+			// Result (as 32 bit to detect carry).
+			Uint32 r  = GetRegisterHl( ) + GetRegisterHl( );
+
+			// Truncate Uint32 to Uint16, we handle flags after.
+			SetRegisterHl( ( Uint16 )r );
+
+			GetFlags( ).cy = r > 0xffff;
+		}
+		break;
+
+		case 0x39:
+		{
+			// Add SP to HL.
+			// Cycles : 3
+			// States : 10
+			// Flags  : CY
+			// Addressing : register
+			DumpDisassembly( "DAD SP" );
+			DumpInstruction( "HL += SP" );
+
+			// Result (as 32 bit to detect carry).
+			Uint32 r  = GetRegisterHl( ) + GetRegisterSp( );
+
+			// Truncate Uint32 to Uint16, we handle flags after.
+			SetRegisterHl( ( Uint16 )r );
+
+			GetFlags( ).cy = r > 0xffff;
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Subtract.
+		// ------------------------------------------------------------
+		case _GenSrcVariations( 0x90 ):
+		{
+			// Subtract register from accumulator.
+			// Cycles : 1
+			// States : 4
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register
+			DumpDisassembly( "SUB %s", RegName( s ) );
+			DumpInstruction( "accumulator -= r%d", s );
+
+			// Result (as signed 16 bit to detect carry).
+			Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )chip8.Cpu.Regs.gpr[ RegIndex( s ) ];
+
+			// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
+			Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf );
+
+			// Handle borrow after.
+			SetAccumulator( GetAccumulator( ) - chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r < 0;
+			GetFlags( ).ac = nr >= 0;	// AC is the carry out of bit 3 of the complement add, so set when nothing was borrowed.
+		}
+		break;
+
+		case _GenSrcVariations( 0x98 ):
+		{
+			// Subtract register and borrow from accumulator.
+			// Cycles : 1
+			// States : 4
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register
+			DumpDisassembly( "SBB %s", RegName( s ) );
+			DumpInstruction( "accumulator -= (r%d + borrow)", s );
+
+			// Result (as signed 16 bit to detect carry).
+			Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )chip8.Cpu.Regs.gpr[ RegIndex( s ) ] - ( Sint16 )GetFlags( ).cy;
+
+			// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
+			Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf ) - GetFlags( ).cy;
+
+			// Handle borrow after.
+			SetAccumulator( GetAccumulator( ) - chip8.Cpu.Regs.gpr[ RegIndex( s ) ] - GetFlags( ).cy );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r < 0;
+			GetFlags( ).ac = nr >= 0;	// AC is the carry out of bit 3 of the complement add, so set when nothing was borrowed.
+		}
+		break;
+
+		case 0x96:
+		{
+			// Subtract (HL) from accumulator.
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register indirect
+			DumpDisassembly( "SUB M" );
+			DumpInstruction( "accumulator -= (HL)" );
+
+			// Result (as signed 16 bit to detect carry).
+			Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )GetHlMemory8( );
+
+			// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
+			Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( GetHlMemory8( ) & 0xf );
+
+			// Handle borrow after.
+			SetAccumulator( GetAccumulator( ) - GetHlMemory8( ) );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r < 0;
+			GetFlags( ).ac = nr >= 0;	// AC is the carry out of bit 3 of the complement add, so set when nothing was borrowed.
+		}
+		break;
+
+		case 0x9e:
+		{
+			// Subtract (HL) and carry from accumulator.
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register indirect
+			DumpDisassembly( "SBB M" );
+			DumpInstruction( "accumulator -= ( (HL) + borrow )" );
+
+			// Result (as signed 16 bit to detect carry).
+			Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )GetHlMemory8( ) - GetFlags( ).cy;
+
+			// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
+			Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( GetHlMemory8( ) & 0xf ) - GetFlags( ).cy;
+
+			// Handle borrow after.
+			SetAccumulator( GetAccumulator( ) - GetHlMemory8( ) - GetFlags( ).cy );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r < 0;
+			GetFlags( ).ac = nr >= 0;	// AC is the carry out of bit 3 of the complement add, so set when nothing was borrowed.
+		}
+		break;
+
+		case 0xd6:
+		{
+			// Subtract immediate from accumulator.
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : immediate
+			DumpDisassembly( "SUI 0x%x", immediate );
+			DumpInstruction( "accumulator -= %d", immediate );
+
+			// Result (as signed 16 bit to detect carry).
+			Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )immediate;
+
+			// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
+			Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( immediate & 0xf );
+
+			// Handle borrow after.
+			SetAccumulator( GetAccumulator( ) - immediate );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r < 0;
+			GetFlags( ).ac = nr >= 0;	// AC is the carry out of bit 3 of the complement add, so set when nothing was borrowed.
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		case 0xde:
+		{
+			// Subtract immediate and carry from accumulator.
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : immediate
+			DumpDisassembly( "SBI 0x%x", immediate );
+			DumpInstruction( "accumulator -= (%d + borrow)", immediate );
+
+			// Result (as signed 16 bit to detect carry).
+			Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )immediate - GetFlags( ).cy;
+
+			// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
+			Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( immediate & 0xf ) - GetFlags( ).cy;
+
+			// Handle borrow after.
+			SetAccumulator( GetAccumulator( ) - immediate - GetFlags( ).cy );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = r < 0;
+			GetFlags( ).ac = nr >= 0;	// AC is the carry out of bit 3 of the complement add, so set when nothing was borrowed.
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Logical.
+		// ------------------------------------------------------------
+		case _GenSrcVariations( 0xa0 ):
+		{
+			// Accumulator is AND with register (result to accumulator).
+			// Cycles : 1
+			// States : 4
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register
+			DumpDisassembly( "ANA %s", RegName( s ) );
+			DumpInstruction( "accumulator &= r%d", s );
+
+			const Uint8 ac = ( ( GetAccumulator( ) | chip8.Cpu.Regs.gpr[ RegIndex( s ) ] ) >> 3 ) & 1;	// The 8080 ORs bit 3 of the operands into AC.
+			SetAccumulator( GetAccumulator( ) & chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = 0;	// Documents specify this (makes sense).
+			GetFlags( ).ac = ac;
+		}
+		break;
+
+		case _GenSrcVariations( 0xa8 ):
+		{
+			// Accumulator is XOR with register (result to accumulator).
+			// Cycles : 1
+			// States : 4
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register
+			DumpDisassembly( "XRA %s", RegName( s ) );
+			DumpInstruction( "accumulator ^= r%d", s );
+
+			SetAccumulator( GetAccumulator( ) ^ chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = 0;	// Documents specify this (makes sense).
+			GetFlags( ).ac = 0;	// Documents specify this too.
+		}
+		break;
+
+		case _GenSrcVariations( 0xb0 ):
+		{
+			// Accumulator is OR with register (result to accumulator).
+			// Cycles : 1
+			// States : 4
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register
+			DumpDisassembly( "ORA %s", RegName( s ) );
+			DumpInstruction( "accumulator |= r%d", s );
+
+			SetAccumulator( GetAccumulator( ) | chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = 0;	// Documents specify this (makes sense).
+			GetFlags( ).ac = 0;	// Documents specify this too.
+		}
+		break;
+
+		case _GenSrcVariations( 0xb8 ):
+		{
+			// Compare accumulator with register.
+			// Cycles : 1
+			// States : 4
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register
+			DumpDisassembly( "CMP %s", RegName( s ) );
+			DumpInstruction( "tempReg = accumulator - r%d", s );
+
+			Uint8 r = GetAccumulator( ) - chip8.Cpu.Regs.gpr[ RegIndex( s ) ];
+
+			GetFlags( ).z = r == 0;
+			GetFlags( ).s = r >> 7;
+			GetFlags( ).p = ParityTable256[ r ];
+			GetFlags( ).cy = GetAccumulator( ) < chip8.Cpu.Regs.gpr[ RegIndex( s ) ] ? 1 : 0;
+			GetFlags( ).ac = ( GetAccumulator( ) & 0xf ) >= ( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf );
+		}
+		break;
+
+		case 0xa6:
+		{
+			// Accumulator is AND with (HL) (result to accumulator).
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register indirect
+			DumpDisassembly( "ANA M" );
+			DumpInstruction( "accumulator &= (HL)" );
+
+			const Uint8 ac = ( ( GetAccumulator( ) | GetHlMemory8( ) ) >> 3 ) & 1;	// The 8080 ORs bit 3 of the operands into AC.
+			SetAccumulator( GetAccumulator( ) & GetHlMemory8( ) );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = 0;	// Documents specify this (makes sense).
+			GetFlags( ).ac = ac;
+		}
+		break;
+
+		case 0xae:
+		{
+			// Accumulator is XOR with (HL) (result to accumulator).
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register indirect
+			DumpDisassembly( "XRA M" );
+			DumpInstruction( "accumulator ^= (HL)" );
+
+			SetAccumulator( GetAccumulator( ) ^ GetHlMemory8( ) );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = 0;	// Documents specify this (makes sense).
+			GetFlags( ).ac = 0;	// Documents specify this too.
+		}
+		break;
+
+		case 0xb6:
+		{
+			// Accumulator is OR with (HL) (result to accumulator).
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register indirect
+			DumpDisassembly( "ORA M" );
+			DumpInstruction( "accumulator |= (HL)" );
+
+			SetAccumulator( GetAccumulator( ) | GetHlMemory8( ) );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = 0;	// Documents specify this (makes sense).
+			GetFlags( ).ac = 0;	// Documents specify this too.
+		}
+		break;
+
+		case 0xbe:
+		{
+			// Compare accumulator with (HL).
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : register indirect
+			DumpDisassembly( "CMP M" );
+			DumpInstruction( "tempReg = accumulator - (HL)" );
+
+			Uint8 r = GetAccumulator( ) - GetHlMemory8( );
+
+			GetFlags( ).z = r == 0;
+			GetFlags( ).s = r >> 7;
+			GetFlags( ).p = ParityTable256[ r ];
+			GetFlags( ).cy = GetAccumulator( ) < GetHlMemory8( ) ? 1 : 0;
+			GetFlags( ).ac = ( GetAccumulator( ) & 0xf ) >= ( GetHlMemory8( ) & 0xf );
+		}
+		break;
+
+		case 0xe6:
+		{
+			// Accumulator is AND with immediate (result to accumulator).
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : immediate
+			DumpDisassembly( "ANI 0x%x", immediate );
+			DumpInstruction( "accumulator &= %d", immediate );
+
+			const Uint8 ac = ( ( GetAccumulator( ) | immediate ) >> 3 ) & 1;	// The 8080 ORs bit 3 of the operands into AC.
+			SetAccumulator( GetAccumulator( ) & immediate );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = 0;	// Documents specify this (makes sense).
+			GetFlags( ).ac = ac;
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		case 0xee:
+		{
+			// Accumulator is XOR with immediate (result to accumulator).
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : immediate
+			DumpDisassembly( "XRI 0x%x", immediate );
+			DumpInstruction( "accumulator ^= %d", immediate );
+
+			SetAccumulator( GetAccumulator( ) ^ immediate );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = 0;	// Documents specify this (makes sense).
+			GetFlags( ).ac = 0;	// Documents specify this too.
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		case 0xf6:
+		{
+			// Accumulator is OR with immediate (result to accumulator).
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : immediate
+			DumpDisassembly( "ORI 0x%x", immediate );
+			DumpInstruction( "accumulator |= %d", immediate );
+
+			SetAccumulator( GetAccumulator( ) | immediate );
+
+			GetFlags( ).z = GetAccumulator( ) == 0;
+			GetFlags( ).s = GetAccumulator( ) >> 7;
+			GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
+			GetFlags( ).cy = 0;	// Documents specify this (makes sense).
+			GetFlags( ).ac = 0;	// Documents specify this too.
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		case 0xfe:
+		{
+			// Compare accumulator with immediate.
+			// Cycles : 2
+			// States : 7
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : immediate
+			DumpDisassembly( "CPI 0x%x", immediate );
+			DumpInstruction( "tempReg = accumulator - %d", immediate );
+
+			Uint8 r = GetAccumulator( ) - immediate;
+
+			GetFlags( ).z = r == 0;
+			GetFlags( ).s = r >> 7;
+			GetFlags( ).p = ParityTable256[ r ];
+			GetFlags( ).cy = GetAccumulator( ) < immediate ? 1 : 0;
+			GetFlags( ).ac = ( GetAccumulator( ) & 0xf ) >= ( immediate & 0xf ) ? 1 : 0;
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Rotate.
+		// ------------------------------------------------------------
+		case 0x7:
+		{
+			// Accumulator is rotated left (carry and LSB gets MSB).
+			// Cycles : 1
+			// States : 4
+			// Flags  : CY
+			// Addressing : -
+			DumpDisassembly( "RLC" );
+			DumpInstruction( "accumulator <<= 1" );
+
+			GetFlags( ).cy = GetAccumulator( ) >> 7;
+
+			SetAccumulator( ( GetAccumulator( ) << 1 ) | GetFlags( ).cy );
+		}
+		break;
+
+		case 0xf:
+		{
+			// Accumulator is rotated right (carry and MSB gets LSB).
+			// Cycles : 1
+			// States : 4
+			// Flags  : CY
+			// Addressing : -
+			DumpDisassembly( "RRC" );
+			DumpInstruction( "accumulator >>= 1" );
+
+			GetFlags( ).cy = GetAccumulator( ) & 0x1;
+
+			SetAccumulator( ( GetAccumulator( ) >> 1 ) | ( GetFlags( ).cy << 7 ) );
+		}
+		break;
+
+		case 0x17:
+		{
+			// Accumulator is rotated left (carry gets MSB, LSB gets carry).
+			// Cycles : 1
+			// States : 4
+			// Flags  : CY
+			// Addressing : -
+			DumpDisassembly( "RAL" );
+			DumpInstruction( "accumulator <<= 1" );
+
+			// Store carry.
+			Uint8 lsb = GetFlags( ).cy;
+
+			// Set carry to MSB.
+			GetFlags( ).cy = GetAccumulator( ) >> 7;
+
+			SetAccumulator( ( GetAccumulator( ) << 1 ) | lsb );
+		}
+		break;
+
+		case 0x1f:
+		{
+			// Accumulator is rotated right (carry gets LSB, MSB gets carry).
+			// Cycles : 1
+			// States : 4
+			// Flags  : CY
+			// Addressing : -
+			DumpDisassembly( "RAR" );
+			DumpInstruction( "accumulator >>= 1" );
+
+			// Store carry.
+			Uint8 msb = GetFlags( ).cy;
+
+			// Set carry to LSB.
+			GetFlags( ).cy = GetAccumulator( ) & 0x1;
+
+			SetAccumulator( ( GetAccumulator( ) >> 1 ) | ( msb << 7 ) );
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Specials.
+		// ------------------------------------------------------------
+		case 0x2f:
+		{
+			// Accumulator is complimented.
+			// Cycles : 1
+			// States : 4
+			// Flags  : none
+			// Addressing : -
+			DumpDisassembly( "CMA" );
+			DumpInstruction( "accumulator ~= accumulator" );
+
+			SetAccumulator( ~ GetAccumulator( )  );
+		}
+		break;
+
+		case 0x37:
+		{
+			// Carry is set to 1.
+			// Cycles : 1
+			// States : 4
+			// Flags  : CY
+			// Addressing : -
+			DumpDisassembly( "STC" );
+			DumpInstruction( "CARRY = 1" );
+
+			GetFlags( ).cy = 1;
+		}
+		break;
+
+		case 0x3f:
+		{
+			// Carry flag is complimented.
+			// Cycles : 1
+			// States : 4
+			// Flags  : CY
+			// Addressing : -
+			DumpDisassembly( "CMC" );
+			DumpInstruction( "carry ~= carry" );
+
+			GetFlags( ).cy = 1 - GetFlags( ).cy;
+		}
+		break;
+
+		case 0x27:
+		{
+			// BCD accumulator.
+			// Cycles : 1
+			// States : 4
+			// Flags  : Z, S, P, CY, AC
+			// Addressing : -
+			DumpDisassembly( "DAA" );
+			DumpInstruction( "BCD accumulator" );
+
+			// Both corrections are decided from the accumulator as it was (the high one also when the low one will carry into it).
+			const Uint8	a = GetAccumulator( );
+			Uint8		correction = 0;
+			Uint8		carry = GetFlags( ).cy;
+			if ( ( ( a & 0xf ) > 9 ) || GetFlags( ).ac )
+			{
+				correction |= 0x06;
+			}
+			if ( ( ( a >> 4 ) > 9 ) || ( ( ( a >> 4 ) >= 9 ) && ( ( a & 0xf ) > 9 ) ) || GetFlags( ).cy )
+			{
+				correction |= 0x60;
+				carry = 1;
+			}
+
+			const Uint8 r = a + correction;
+			SetAccumulator( r );
+
+			GetFlags( ).z = r == 0;
+			GetFlags( ).s = r >> 7;
+			GetFlags( ).p = ParityTable256[ r ];
+			GetFlags( ).cy = carry;
+			GetFlags( ).ac = ( ( a ^ correction ^ r ) >> 4 ) & 1;
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Input/output.
+		// ------------------------------------------------------------
+		case 0xdb:
+		{
+			// Data from specified port stored into accumulator
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : direct
+			DumpDisassembly( "IN 0x%x", immediate );
+			DumpInstruction( "A = Port[ %d ]", immediate );
+
+			SetAccumulator( IoRead( chip8, immediate ) );
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		case 0xd3:
+		{
+			// Accumulator contents stored onto specified data port.
+			// Cycles : 3
+			// States : 10
+			// Flags  : none
+			// Addressing : direct
+			DumpDisassembly( "OUT 0x%x", immediate );
+			DumpInstruction( "Port[ %d ] = A", immediate );
+
+			IoWrite( chip8, immediate, GetAccumulator( ) );
+
+			// Skip over immediate we used this operation.
+			IncrementPc( );
+		}
+		break;
+
+		// ------------------------------------------------------------
+		// Control.
+		// ------------------------------------------------------------
+		case 0xfb:
+		{
+			// Enable interrupts.
+			// Cycles : 1
+			// States : 4
+			// Flags  : none
+			// Addressing : -
+			DumpDisassembly( "EI" );
+			DumpInstruction( "Enable interrupts (after next instruction)" );
+
+			// Enabled when the next instruction starts, but no interrupt is taken until it has run (see StepCpu).
+			if ( ! chip8.InterruptsEnabled )
+			{
+				chip8.InterruptsDelayed = true;
+			}
+		}
+		break;
+
+		case 0xf3:
+		{
+			// Disable interrupts.
+			// Cycles : 1
+			// States : 4
+			// Flags  : none
+			// Addressing : -
+			DumpDisassembly( "DI" );
+			DumpInstruction( "Disable interrupts" );
+
+			// Straight away, no interrupt is taken after it (and any EI just before it is undone).
+			chip8.InterruptsEnabled = false;
+			chip8.InterruptsDelayed = false;
+		}
+		break;
+
+		case 0x0:
+		{
+			// No operation.
+			// Cycles : 1
+			// States : 4
+			// Flags  : none
+			// Addressing : -
+			DumpDisassembly( "NOP" );
+			DumpInstruction( "No operation" );
+		}
+		break;
+
+		case 0x76:
+		{
+			// Halt.
+			// Cycles : 1
+			// States : 7
+			// Flags  : none
+			// Addressing : -
+			DumpDisassembly( "HLT" );
+			DumpInstruction( "No operation" );
+			assert( 0 );
+		}
+		break;
+
+		default:
+		{
+			// Unsupported instruction.
+			assert( 0 );
+		}
+		break;
+	}
+
+	// Jump forward to next instruction.
+	chip8.Cpu.Regs.pc += 1;
+}
+
+// Idle loop? Nothing can change until the next interrupt, so skip the whole trips round it that fit before then (code in
+// flat memory isn't ROM, so isn't cached). Call after the clock has counted the instruction at instructionPc.
+static inline void SkipIdleLoop( Cpu8080 & chip8, address instructionPc, Uint8 instruction )
+{
+	if ( g_SkipIdleLoops && ! chip8.Memory.Flat )
+	{
+		if ( chip8.Cpu.Regs.pc <= instructionPc && InstructionSize[ instruction ] == 3 && IsSideEffectFreeInstruction( instruction ) )
+		{
+			const Uint32 threshold = kInstructionsBeforeInterrupt[ chip8.NextInterrupt ];
+			if ( IsIdleLoop( chip8, instructionPc ) && chip8.InstructionsSinceInterrupt < threshold )
+			{
+				// Instructions in a trip, from the last time round (the clock only counts up between interrupts).
+				const Uint32 trip = chip8.InstructionsSinceInterrupt - chip8.Idle.Clock;
+				const Uint32 skipped = trip ? ( threshold - chip8.InstructionsSinceInterrupt ) / trip * trip : 0;
+				chip8.Idle.Skipped += skipped;
+				chip8.InstructionsSinceInterrupt += skipped;
+				chip8.Idle.Clock = chip8.InstructionsSinceInterrupt;
+			}
+		}
+		else if ( chip8.Idle.Active && ( chip8.Cpu.Regs.pc < chip8.Idle.Start || chip8.Cpu.Regs.pc > chip8.Idle.End ) )
+		{
+			// Left the loop.
+			chip8.Idle.Active = false;
+		}
+	}
+}
+
+void CheckIdleLoop( Cpu8080 & chip8, address firstPc, address lastPc )
+{
+	// Part of the line was outside the loop being watched (all of it is inside if both ends are).
+	const Cpu8080::IdleLoop & idle = chip8.Idle;
+	if ( idle.Active && ( firstPc < idle.Start || firstPc > idle.End || lastPc < idle.Start || lastPc > idle.End ) )
+	{
+		chip8.Idle.Active = false;
+	}
+
+	SkipIdleLoop( chip8, lastPc, chip8.Memory.Rom[ lastPc ] );
+}
+
+template< bool UseHandlers >
+static inline void StepCpuWith( Cpu8080 & chip8 )
+{
+	// Address of the instruction being processed.
+	address instructionPc = chip8.Cpu.Regs.pc;
+
+	Uint8  instruction = chip8.Memory.Rom[ MapProgramCounter( chip8.Cpu.Regs.pc ) ];
+
+	// Interrupts, none until the instruction after EI has run.
+	const bool interruptsDelayed = chip8.InterruptsDelayed;
+	if ( interruptsDelayed )
+	{
+		chip8.InterruptsDelayed = false;
+		chip8.InterruptsEnabled = true;
+	}
+	else if ( chip8.InterruptsEnabled )
+	{
+		if ( chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] )
+		{
+			chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] = false;
+
+			// RST 1.
+			instruction = 0xcf;
+
+			// The handler is about to change memory under any loop we were watching.
+			chip8.Idle.Active = false;
+
+
+			chip8.InterruptsEnabled = false;
+
+			// Haven't processed this instruction yet.
+			chip8.Cpu.Regs.pc--;
+		}
+		else if ( chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] )
+		{
+			chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] = false;
+
+			// RST 2.
+			instruction = 0xd7;
+
+			// The handler is about to change memory under any loop we were watching.
+			chip8.Idle.Active = false;
+
+
+			chip8.InterruptsEnabled = false;
+
+			// Haven't processed this instruction yet.
+			chip8.Cpu.Regs.pc--;
+		}
+	}
+
+	// Native replacement for the ROM routine starting here? (pc has moved back one if we are taking an interrupt instead,
+	// and straight after EI a waiting interrupt is taken after this instruction, so not part way through the routine)
+	if ( chip8.HleEnabled && chip8.Cpu.Regs.pc == instructionPc && ! interruptsDelayed && g_HleRoutines[ instructionPc ] )
+	{
+		Uint32 instructions = RunHleRoutine( chip8, g_HleRoutines[ instructionPc ] );
+		if ( instructions )
+		{
+			chip8.InstructionsSinceInterrupt += instructions;
+			chip8.Idle.Active = false;
+			return;
+		}
+	}
+
+	ExecuteInstruction< UseHandlers >( chip8, instruction );
+
+	// Increment instruction counter.
+	chip8.InstructionsSinceInterrupt++;
+
+	SkipIdleLoop( chip8, instructionPc, instruction );
+}
+
+void StepCpu( Cpu8080 & chip8 )
+{
+	StepCpuWith< true >( chip8 );
+}
+
+void StepCpuReference( Cpu8080 & chip8 )
+{
+	StepCpuWith< false >( chip8 );
+}
+
+// ------------------------------------------------------------
+// Straight-line blocks.
+//
+// StepCpu keeps the clock, takes interrupts and looks for idle loops
+// after every instruction. StepCpuBlock runs a whole block of the ROM
+// instead (up to and including a transfer of control, or EI, DI, IN or
+// OUT, whose effects the next instructions may see), counts it on the
+// clock in one go and does the rest only at its end. That is only when
+// nothing could have happened in between: the block ends before the next
+// interrupt is raised, none is waiting to be taken and no EI is about to
+// take effect (see CanRunUninterrupted). Otherwise, and at HLE routines,
+// HLT and the opcodes the interpreter doesn't run, it steps as StepCpu.
+// Blocks stop short of any HLE routine too, so one always starts a block.
+// ------------------------------------------------------------
+
+// Longest block we run (more would hardly ever fit before an interrupt anyway).
+static const Uint32 kMaxBlockInstructions = 64;
+
+// Instructions that end a block (they are part of it).
+static bool EndsBlock( Uint8 op )
+{
+	switch ( op )
+	{
+		// JMP, CALL, RET, PCHL.
+		case 0xc3: case 0xcd: case 0xc9: case 0xe9:
+			return true;
+
+		// EI, DI, IN, OUT.
+		case 0xfb: case 0xf3: case 0xdb: case 0xd3:
+			return true;
+	}
+
+	// Conditional returns, jumps and calls, and RST.
+	const Uint8 group = op & 0xc7;
+	return group == 0xc0 || group == 0xc2 || group == 0xc4 || group == 0xc7;
+}
+
+// Instructions only StepCpu runs: HLT and the undocumented opcodes (NOPs, JMP, RET and CALLs) and RST 6.
+static bool RunsAlone( Uint8 op )
+{
+	switch ( op )
+	{
+		case 0x76:
+		case 0x08: case 0x10: case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+		case 0xcb: case 0xd9: case 0xdd: case 0xed: case 0xfd:
+		case 0xf7:
+			return true;
+	}
+	return false;
+}
+
+// Instructions in the block starting at each address of the ROM in s_BlockRom (see InitCpuCaches, only read once it
+// has been built).
+static Uint8 s_BlockLengths[ 0x2000 ];
+static const Uint8 * s_BlockRom = NULL;
+
+static Uint32 FindBlockLength( const Uint8 * rom, address pc )
+{
+	Uint32 length = 0;
+	Uint32 addr = pc;
+	while ( length < kMaxBlockInstructions && addr + InstructionSize[ rom[ addr ] ] <= 0x2000 )
+	{
+		const Uint8 op = rom[ addr ];
+		if ( RunsAlone( op ) || ( length && g_HleRoutines[ addr ] ) )
+			break;
+
+		++length;
+		if ( EndsBlock( op ) )
+			break;
+
+		addr += InstructionSize[ op ];
+	}
+
+	// A block of one is stepped as any other instruction.
+	return length ? length : 1;
+}
+
+static Uint32 GetBlockLength( const Cpu8080 & chip8, address pc )
+{
+	if ( chip8.Memory.Rom == s_BlockRom )
+		return s_BlockLengths[ pc ];
+
+	return FindBlockLength( chip8.Memory.Rom, pc );
+}
+
+void InitCpuCaches( const Uint8 * rom )
+{
+	// Only the ROM is read.
+	MachineMemory memory;
+	memory.Rom = rom;
+	memory.Flat = NULL;
+
+	for ( address pc = 0; pc < 0x2000; ++pc )
+	{
+		s_BlockLengths[ pc ] = ( Uint8 )FindBlockLength( rom, pc );
+
+		// Only a jump can close a loop (see SkipIdleLoop), and only back to its operand (the ROM is padded past 0x1fff).
+		const Uint8 op = rom[ pc ];
+		const address target = ( address )( ( rom[ pc + 2 ] << 8 ) | rom[ pc + 1 ] );
+		s_SideEffectFreeLoopBodies[ pc ] = InstructionSize[ op ] == 3 && IsSideEffectFreeInstruction( op ) && target <= pc &&
+			pc - target < kIdleLoopMaxBodySize && FindSideEffectFreeLoopBody( memory, pc, target );
+	}
+
+	s_BlockRom = rom;
+	s_LoopBodyRom = rom;
+}
+
+Uint32 GetCpuBlockLength( const Cpu8080 & chip8 )
+{
+	const address pc = chip8.Cpu.Regs.pc;
+	return pc < 0x2000 && ! chip8.Memory.Flat ? GetBlockLength( chip8, pc ) : 1;
+}
+
+void StepCpuBlock( Cpu8080 & chip8 )
+{
+	const address pc = chip8.Cpu.Regs.pc;
+	const Uint32 length = GetCpuBlockLength( chip8 );
+
+	if ( length == 1 || ! CanRunUninterrupted( chip8, length ) || ( chip8.HleEnabled && g_HleRoutines[ pc ] ) )
+	{
+		StepCpu( chip8 );
+		return;
+	}
+
+	address instructionPc = pc;
+	for ( Uint32 ix = 0; ix < length; ++ix )
+	{
+		instructionPc = chip8.Cpu.Regs.pc;
+		ExecuteInstruction< true >( chip8, chip8.Memory.Rom[ instructionPc ] );
+	}
+	chip8.InstructionsSinceInterrupt += length;
+
+	// Only the last instruction can close a loop, and the block can only have left one at its end.
+	SkipIdleLoop( chip8, instructionPc, chip8.Memory.Rom[ instructionPc ] );
+}
+
+bool RaiseInterrupt( Cpu8080 & chip8 )
+{
+	bool endOfFrame = chip8.NextInterrupt == Cpu8080::Interrupt::VBlankEnd;
+
+	chip8.InterruptWaiting[ chip8.NextInterrupt ] = true;
+	chip8.NextInterrupt ^= 1;
+
+	chip8.InstructionsSinceInterrupt = 0;
+
+	if ( endOfFrame )
+	{
+		chip8.Frame++;
+
+		// Catches a write that bypassed MachineMemory::Write8.
+		assert( chip8.Memory.Hash == HashRam( chip8.Memory ) );
+	}
+
+	return endOfFrame;
+}
+
+void ( * g_StepCpuEngine )( Cpu8080 & chip8 ) = StepCpuBlock;
+
+void RunFrame( Cpu8080 & chip8 )
+{
+	for ( ; ; )
+	{
+		if ( IsInterruptDue( chip8 ) && RaiseInterrupt( chip8 ) )
+			break;
+
+		g_StepCpuEngine( chip8 );
+	}
+}
+
+Uint32 HashBytes( Uint32 hash, const void * data, size_t size )
+{
+	const Uint8 * bytes = ( const Uint8 * )data;
+	for ( size_t ix = 0; ix < size; ++ix )
+	{
+		hash = ( hash ^ bytes[ ix ] ) * 16777619u;
+	}
+	return hash;
+}
+
+Uint64 HashRam( const MachineMemory & memory )
+{
+	Uint64 hash = 0;
+	for ( size_t ix = 0; ix < sizeof( memory.Ram ); ++ix )
+	{
+		if ( memory.Ram[ ix ] )
+		{
+			hash ^= RamByteKey( 0x2000 + ix, memory.Ram[ ix ] ) ^ RamByteKey( 0x2000 + ix, 0 );
+		}
+	}
+	return hash;
+}
+
+Uint64 HashMachineState( const Cpu8080 & chip8 )
+{
+	const Cpu8080::CommandProcessingUnit::Registers & regs = chip8.Cpu.Regs;
+
+	// Field by field, so padding never makes it into the hash.
+	Uint8 state[ 32 ] = { 0 };
+	memcpy( &state[ 0 ], regs.gpr, 6 );
+	state[ 6 ] = regs.flags.u8;
+	state[ 7 ] = regs.accumulator;
+	memcpy( &state[ 8 ], &regs.sp, 2 );
+	memcpy( &state[ 10 ], &regs.pc, 2 );
+	state[ 12 ] = chip8.InterruptsEnabled;
+	state[ 13 ] = chip8.InterruptsDelayed;
+	state[ 15 ] = chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ];
+	state[ 16 ] = chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ];
+	state[ 17 ] = ( Uint8 )chip8.NextInterrupt;
+	state[ 18 ] = chip8.Io.Shifter.Offset;
+	state[ 19 ] = chip8.Io.Watchdog;
+	memcpy( &state[ 20 ], &chip8.InstructionsSinceInterrupt, 4 );
+	memcpy( &state[ 24 ], &chip8.Io.Shifter.Value, 2 );
+	memcpy( &state[ 26 ], chip8.Io.Inputs, 3 );
+	memcpy( &state[ 29 ], chip8.Io.Sound, 2 );
+
+	// Chain the four words onto the RAM's hash.
+	Uint64 hash = chip8.Memory.Hash;
+	for ( size_t ix = 0; ix < sizeof( state ); ix += 8 )
+	{
+		Uint64 word;
+		memcpy( &word, &state[ ix ], 8 );
+		hash = Mix64( hash ^ word );
+	}
+	return hash;
+}
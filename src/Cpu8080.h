@@ -0,0 +1,418 @@
+#pragma once
+
+#include <assert.h>
+#include <string.h>
+#include <SDL.h>
+
+#include "IoBus.h"
+
+static inline int RegIndex( int ix )
+{
+	assert( ( ix >= 0 && ix < 6 ) || ix == 7 );
+
+	if ( ix == 7 )
+		return ix;
+	else
+		return ix ^ 1;
+}
+
+typedef Uint16 address;
+typedef Uint8 instruction;
+
+// True for an even number of set bits (the 8080's P flag).
+static const bool ParityTable256[ 256 ] = 
+{
+#   define ParityTable256_2(n) n, n^1, n^1, n
+#   define ParityTable256_4(n) ParityTable256_2(n), ParityTable256_2(n^1), ParityTable256_2(n^1), ParityTable256_2(n)
+#   define ParityTable256_6(n) ParityTable256_4(n), ParityTable256_4(n^1), ParityTable256_4(n^1), ParityTable256_4(n)
+	ParityTable256_6(1), ParityTable256_6(0), ParityTable256_6(0), ParityTable256_6(1)
+#	undef ParityTable256_6
+#	undef ParityTable256_4
+#	undef ParityTable256_2
+};
+
+// Size of every ROM image a machine points at: the ROM plus two bytes of zeros, so the immediates of an instruction at
+// its end can be fetched without checking (as Flat is padded).
+static const size_t kRomImageSize = 0x2000 + 2;
+
+// ROM that machines point at until they are given one (all zeros).
+extern const Uint8 kNoRom[ kRomImageSize ];
+
+// 64 bit finalizer (splitmix64), spreads every input bit over the whole result.
+inline Uint64 Mix64( Uint64 x )
+{
+	x ^= x >> 30;
+	x *= 0xbf58476d1ce4e5b9ULL;
+	x ^= x >> 27;
+	x *= 0x94d049bb133111ebULL;
+	x ^= x >> 31;
+	return x;
+}
+
+// Zobrist key of a byte of RAM holding a value.
+inline Uint64 RamByteKey( size_t addr, Uint8 value )
+{
+	return Mix64( ( ( Uint64 )addr << 8 ) | value );
+}
+
+// The 16K address space. The ROM is shared by every machine running it (see InternRom),
+// so a machine only owns its 8K of RAM/VRAM.
+//
+// Every write goes through Write8/Write16, which keep Hash up to date: it is the XOR of
+// RamByteKey( addr, value ) ^ RamByteKey( addr, 0 ) over every byte, so all-zero RAM hashes to 0
+// and a write only has to swap the old value's key for the new one.
+//
+// Flat replaces all of that with 64K of RAM (see Cpm.h), no mirrors, no ROM and no Hash; Rom points
+// at it too, for instruction fetches. It isn't owned, so copies of the machine share it.
+struct MachineMemory
+{
+	const Uint8 *	Rom;			// 0x0000-0x1fff (kRomImageSize bytes)
+	Uint8			Ram[ 0x2000 ];	// 0x2000-0x3fff
+	Uint64			Hash;
+	Uint8 *			Flat;			// 0x0000-0xffff (plus two bytes so reads at 0xffff stay inside it), or NULL.
+
+	const Uint8 & operator[]( size_t addr ) const
+	{
+		if ( Flat )
+			return Flat[ addr ];
+
+		assert( addr < 0x4000 );
+		return addr < 0x2000 ? Rom[ addr ] : Ram[ addr - 0x2000 ];
+	}
+
+	// Address of the byte after addr: into the mirror of RAM after 0x3fff, round to 0x0000 in flat memory.
+	size_t NextAddress( size_t addr ) const
+	{
+		if ( Flat )
+			return ( addr + 1 ) & 0xffff;
+
+		return addr + 1 == 0x4000 ? 0x2000 : addr + 1;
+	}
+
+	// Little endian, the second byte at NextAddress( addr ).
+	Uint16 Read16( size_t addr ) const
+	{
+		return ( Uint16 )( ( *this )[ addr ] | ( ( *this )[ NextAddress( addr ) ] << 8 ) );
+	}
+
+	// Writes to ROM are dropped, as on the board (sprites clipped off the bottom of the screen wrap HL round to 0x0000).
+	void Write8( size_t addr, Uint8 value )
+	{
+		if ( Flat )
+		{
+			Flat[ addr & 0xffff ] = value;
+			return;
+		}
+
+		assert( addr < 0x4000 );
+		if ( addr < 0x2000 )
+			return;
+
+		Uint8 & byte = Ram[ addr - 0x2000 ];
+		if ( byte != value )
+		{
+			Hash ^= RamByteKey( addr, byte ) ^ RamByteKey( addr, value );
+			byte = value;
+		}
+	}
+
+	// Same byte order as Read16.
+	void Write16( size_t addr, Uint16 value )
+	{
+		Write8( addr, ( Uint8 )value );
+		Write8( NextAddress( addr ), ( Uint8 )( value >> 8 ) );
+	}
+};
+
+// Hash of the RAM computed from scratch (what MachineMemory::Hash should be).
+Uint64 HashRam( const MachineMemory & memory );
+
+struct Cpu8080
+{
+	Cpu8080( )
+	: InterruptsEnabled( true )
+	, InterruptsDelayed( false )
+	, NextInterrupt( Interrupt::VBlankStart )
+	, InstructionsSinceInterrupt( 0 )
+	, Frame( 0 )
+	, HleEnabled( true )
+	, AluTablesEnabled( false )
+	{
+		Memory.Rom = kNoRom;
+		memset( Memory.Ram, 0, sizeof( Memory.Ram ) );
+		Memory.Hash = 0;
+		Memory.Flat = NULL;
+		memset( &Io, 0, sizeof( Io ) );
+		InterruptWaiting[ Interrupt::VBlankStart] = false;
+		InterruptWaiting[ Interrupt::VBlankEnd ] = false;
+		Idle.Active = false;
+		Idle.Start = 0;
+		Idle.End = 0;
+		Idle.Clock = 0;
+		Idle.Skipped = 0;
+	}
+
+	struct CommandProcessingUnit
+	{
+		struct Registers
+		{
+			Registers( )
+			{
+				for ( size_t ix = 0; ix < Gpr::Num; ++ix )
+				{
+					gpr[ ix ] = 0;
+				}
+				flags.u8 = 0;
+				sp = 0;
+				accumulator = 0;
+				pc          = 0x0;
+
+				// Double check...
+				assert( sizeof( Flags ) == 1 );
+				assert( sizeof( __int8 ) == 1 );
+				assert( sizeof( __int16 ) == 2 );
+				assert( sizeof( Sint8 ) == 1 );
+				assert( sizeof( Sint16 ) == 2 );
+				assert( sizeof( Uint8 ) == 1 );
+				assert( sizeof( Uint16 ) == 2 );
+			}
+			// B, C, D, E, H, L (accessible as pairs AB, DE, HL).
+			struct Gpr
+			{
+				enum T
+				{
+					B = 0,
+					C,
+					D,
+					E,
+					H,
+					L,
+					___MEMORY,		// Not a register, 0x6 as a register destination means a memory address
+					___ACCUMULATOR,	// Convenient, as 0x7 as a register destination actually means accumulator
+					Num
+				};
+			};
+
+			// BC, DE, HL pairs.
+			struct GprPair
+			{
+				enum T
+				{
+					BC,
+					DE,
+					HL,
+					Num
+				};
+			};
+
+			// CPU flags.
+			union Flags
+			{
+				struct  
+				{
+					unsigned __int8  s:1;
+					unsigned __int8  z:1;
+					unsigned __int8  pad:1;
+					unsigned __int8  ac:1;
+					unsigned __int8  pad2:1;
+					unsigned __int8  p:1;
+					unsigned __int8  pad3:1;
+					unsigned __int8  cy:1;
+				};
+				unsigned __int8  u8;
+			};
+
+			union
+			{
+				struct 
+				{
+					unsigned __int8  gpr[ 6 ];
+					Flags			 flags;
+					unsigned __int8  accumulator;
+				};
+
+				struct  
+				{
+					unsigned __int16 gprPair[ GprPair::Num ];
+					unsigned __int16 pad[ 1 ];
+				};
+			};
+
+			unsigned __int16 sp;
+			unsigned __int16 pc;
+		};
+
+		Registers			Regs;
+	};
+
+	CommandProcessingUnit Cpu;
+
+	MachineMemory	Memory;
+
+	IoDevices	Io;
+	bool	InterruptsEnabled;
+	// Set by EI (when interrupts were disabled), they are enabled as the next instruction starts, but none is taken until
+	// it has run.
+	bool	InterruptsDelayed;
+	struct Interrupt
+	{
+		enum T
+		{
+			VBlankStart = 0,
+			VBlankEnd,
+			Num
+		};
+	};
+	bool	InterruptWaiting[ Interrupt::Num ];
+	int		NextInterrupt;
+	// Instructions processed since the last interrupt was raised (our clock).
+	Uint32	InstructionsSinceInterrupt;
+	// Frames completed (VBlankEnd interrupts raised).
+	Uint32	Frame;
+
+	// Loop being watched by the idle loop detection (see StepCpu).
+	struct IdleLoop
+	{
+		bool	Active;
+		address	Start;
+		address	End;
+		CommandProcessingUnit::Registers Regs;
+		Uint32	Clock;		// InstructionsSinceInterrupt the last time round the loop.
+		Uint32	Skipped;
+	};
+	IdleLoop	Idle;
+
+	// Allow native replacements of ROM routines (see Hle.h).
+	bool	HleEnabled;
+
+	// Take 8 bit ALU results and flags from the precomputed tables (see Alu.h) rather than working them out.
+	bool	AluTablesEnabled;
+};
+
+// Number of instructions processed before each interrupt is raised (indexed by Cpu8080::Interrupt).
+static const Uint32 kInstructionsBeforeInterrupt[ Cpu8080::Interrupt::Num ] =
+{
+	968,	// VBlankStart
+	5705,	// VBlankEnd
+};
+
+// Emulated position within the current frame (instructions since VBlankEnd was raised).
+inline Uint32 FrameCycle( const Cpu8080 & chip8 )
+{
+	if ( chip8.NextInterrupt == Cpu8080::Interrupt::VBlankEnd )
+		return kInstructionsBeforeInterrupt[ Cpu8080::Interrupt::VBlankStart ] + chip8.InstructionsSinceInterrupt;
+	else
+		return chip8.InstructionsSinceInterrupt;
+}
+
+inline bool IsInterruptDue( const Cpu8080 & chip8 )
+{
+	return chip8.InstructionsSinceInterrupt >= kInstructionsBeforeInterrupt[ chip8.NextInterrupt ];
+}
+
+// True if the next instructions can all run without checking for interrupts in between (engines running several at a
+// time): they end before the next interrupt is raised, none is waiting to be taken and no EI is about to take effect.
+inline bool CanRunUninterrupted( const Cpu8080 & chip8, Uint32 instructions )
+{
+	return chip8.InstructionsSinceInterrupt + instructions <= kInstructionsBeforeInterrupt[ chip8.NextInterrupt ]
+		&& ! chip8.InterruptsDelayed
+		&& ! ( chip8.InterruptsEnabled && ( chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] || chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] ) );
+}
+
+// Size in bytes of each instruction (opcode plus immediates).
+static const Uint8 InstructionSize[ 256 ] =
+{
+//	0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f
+	1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,	// 0x00
+	1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,	// 0x10
+	1, 3, 3, 1, 1, 1, 2, 1, 1, 1, 3, 1, 1, 1, 2, 1,	// 0x20
+	1, 3, 3, 1, 1, 1, 2, 1, 1, 1, 3, 1, 1, 1, 2, 1,	// 0x30
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	// 0x40
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	// 0x50
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	// 0x60
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	// 0x70
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	// 0x80
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	// 0x90
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	// 0xa0
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,	// 0xb0
+	1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 3, 3, 3, 2, 1,	// 0xc0
+	1, 1, 3, 2, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1,	// 0xd0
+	1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 3, 2, 1,	// 0xe0
+	1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 3, 2, 1,	// 0xf0
+};
+
+inline Uint16 CheckAddress( Uint16 addr, bool write = false )
+{
+	if ( write )
+		assert( addr >= 0x2000 );
+	
+	assert( addr < 64 * 1024 );
+
+	while ( addr >= 0x4000 )
+		addr -= 0x2000;
+
+	if ( write )
+		assert( addr >= 0x2000 );
+
+	assert( addr < 64 * 1024 );
+
+	return addr;
+}
+
+inline Uint16 CheckProgramCounter( Uint16 addr )
+{
+	assert( addr >= 0 && addr < 0x2000 );
+
+	return addr;
+}
+
+// Returns a copy of the 8K ROM (padded to kRomImageSize) shared by every caller passing the same contents (never freed).
+const Uint8 * InternRom( const Uint8 * rom );
+
+// Executes a single instruction (or takes a waiting interrupt) and advances the instruction clock.
+void StepCpu( Cpu8080 & chip8 );
+
+// As StepCpu, decoding every opcode in the switch rather than taking those it covers from kOpcodeHandlers (slower, kept
+// as an independent check on the table).
+void StepCpuReference( Cpu8080 & chip8 );
+
+// Executes the straight-line block at pc when nothing can happen part way through it, otherwise steps as StepCpu
+// (the same machine either way, only checked less often).
+void StepCpuBlock( Cpu8080 & chip8 );
+
+// Instructions in the block StepCpuBlock would run from pc if nothing stopped it (1 where it only ever steps).
+Uint32 GetCpuBlockLength( const Cpu8080 & chip8 );
+
+// Finds the blocks StepCpuBlock runs and the loops the idle loop detection may skip in a ROM, once its HLE routines are
+// installed (blocks stop short of them). Call before starting any threads, and again after rewriting the ROM in place or
+// changing its HLE routines; machines running any other ROM work them out as they go.
+void InitCpuCaches( const Uint8 * rom );
+
+// Raises the next interrupt and restarts the instruction clock, returns true if it ended a frame (VBlankEnd).
+bool RaiseInterrupt( Cpu8080 & chip8 );
+
+// Steps the machine for RunFrame, movie playback and the game loop: StepCpuBlock unless another CPU engine was picked
+// (-engine, and the Release AOT build runs the compiled blocks). Set before any threads are started.
+extern void ( * g_StepCpuEngine )( Cpu8080 & chip8 );
+
+// Runs the machine until the end of the current frame (the next VBlankEnd interrupt is raised).
+void RunFrame( Cpu8080 & chip8 );
+
+// FNV-1a, start with kHashSeed and chain calls to hash several blocks.
+static const Uint32 kHashSeed = 2166136261u;
+Uint32 HashBytes( Uint32 hash, const void * data, size_t size );
+
+// Hash of the emulated machine (registers, interrupt state, RAM and devices), used to detect desyncs
+// and duplicate states. O(1), the RAM's share is kept up to date by every write (MachineMemory::Hash).
+Uint64 HashMachineState( const Cpu8080 & chip8 );
+
+// Returns true if the instruction can only read memory and update registers/flags (no memory writes, stack, I/O or interrupt changes).
+bool IsSideEffectFreeInstruction( Uint8 op );
+
+// Set to false to execute every iteration of idle loops (e.g. when debugging timing).
+extern bool g_SkipIdleLoops;
+
+// For engines that run a straight line of ROM instructions in one go, from firstPc to lastPc: call once the clock has
+// counted them to notice leaving the idle loop being watched, or find and skip one as StepCpu would have (only the last
+// instruction can close a loop).
+void CheckIdleLoop( Cpu8080 & chip8, address firstPc, address lastPc );
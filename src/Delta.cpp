@@ -0,0 +1,85 @@
+#include <assert.h>
+
+#include "Delta.h"
+
+// Equal bytes needed to end a run of differing bytes (shorter gaps cost less left in).
+static const size_t kMinEqualRun = 4;
+
+static void PutUint16( std::vector< Uint8 > & out, size_t value )
+{
+	out.push_back( ( Uint8 )( value & 0xff ) );
+	out.push_back( ( Uint8 )( value >> 8 ) );
+}
+
+static size_t GetUint16( const Uint8 * in )
+{
+	return in[ 0 ] | ( in[ 1 ] << 8 );
+}
+
+void EncodeDelta( const Uint8 * state, const Uint8 * reference, size_t size, std::vector< Uint8 > & delta )
+{
+	assert( size < 0x10000 );
+
+	delta.clear( );
+
+	size_t ix = 0;
+	for ( ; ; )
+	{
+		size_t equalStart = ix;
+		while ( ix < size && state[ ix ] == reference[ ix ] )
+		{
+			ix++;
+		}
+
+		if ( ix == size )
+			break;
+
+		size_t differentStart = ix;
+		size_t differentEnd = ix;
+		while ( ix < size )
+		{
+			if ( state[ ix ] != reference[ ix ] )
+			{
+				differentEnd = ++ix;
+			}
+			else if ( ix - differentEnd < kMinEqualRun )
+			{
+				ix++;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		PutUint16( delta, differentStart - equalStart );
+		PutUint16( delta, differentEnd - differentStart );
+		for ( size_t jx = differentStart; jx < differentEnd; ++jx )
+		{
+			delta.push_back( state[ jx ] ^ reference[ jx ] );
+		}
+		ix = differentEnd;
+	}
+}
+
+bool ApplyDelta( const Uint8 * delta, size_t deltaSize, size_t size, Uint8 * state )
+{
+	size_t ix = 0;
+	size_t in = 0;
+	while ( in + 4 <= deltaSize )
+	{
+		ix += GetUint16( &delta[ in ] );
+		size_t different = GetUint16( &delta[ in + 2 ] );
+		in += 4;
+
+		if ( ix + different > size || in + different > deltaSize )
+		{
+			return false;
+		}
+		for ( size_t jx = 0; jx < different; ++jx )
+		{
+			state[ ix++ ] ^= delta[ in++ ];
+		}
+	}
+	return in == deltaSize;
+}
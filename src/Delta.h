@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+
+// ------------------------------------------------------------
+// Deltas.
+//
+// A delta is a list of runs, each a Uint16 count of bytes equal to the
+// reference, a Uint16 count of bytes that differ, then those bytes XORed with
+// the reference. Trailing equal bytes are left off. Against a keyframe they
+// store a frame's changes in a few hundred bytes; against zeros they run
+// length encode a whole state.
+// ------------------------------------------------------------
+
+// size must be under 64K.
+void EncodeDelta( const Uint8 * state, const Uint8 * reference, size_t size, std::vector< Uint8 > & delta );
+
+// Applies a delta to a copy of its reference (state), returns false if it does not fit in size bytes.
+bool ApplyDelta( const Uint8 * delta, size_t deltaSize, size_t size, Uint8 * state );
+
+inline bool ApplyDelta( const std::vector< Uint8 > & delta, size_t size, Uint8 * state )
+{
+	return delta.empty( ) || ApplyDelta( &delta[ 0 ], delta.size( ), size, state );
+}
@@ -0,0 +1,187 @@
+#include "Env.h"
+#include "Cpu8080.h"
+#include "Hle.h"
+#include "Observation.h"
+#include "RamProbe.h"
+#include "Search.h"
+
+// IN 1 for each InvadersAction.
+static const Uint8 kActionInputs[ InvadersActionNum ] =
+{
+	0,							// InvadersActionNoop
+	kInputFire,					// InvadersActionFire
+	kInputLeft,					// InvadersActionLeft
+	kInputRight,				// InvadersActionRight
+	kInputLeft | kInputFire,	// InvadersActionLeftFire
+	kInputRight | kInputFire,	// InvadersActionRightFire
+};
+
+Uint8 InvadersActionToInputs( Uint32 action )
+{
+	assert( action < InvadersActionNum );
+	return kActionInputs[ action ];
+}
+
+struct InvadersEnv
+{
+	Cpu8080	Machine;
+	Cpu8080	Start;		// Machine as a new game begins, episodes restart from here.
+	Uint32	FrameSkip;
+	bool	EndOnLifeLost;
+	bool	Done;
+
+	// Game state at the end of the last step (rewards and done come from this, not the screen).
+	InvadersRamState	Ram;
+
+	// Observations.
+	Uint32				Observation;	// InvadersObservationMode
+	ObservationFormat	Format;
+	Uint8				PreviousVram[ kInvadersObservationSize ];
+};
+
+static void WriteObservation( const InvadersEnv & env, Uint8 * obs )
+{
+	if ( ! obs )
+		return;
+
+	const Uint8 * vram = &env.Machine.Memory[ 0x2400 ];
+	switch ( env.Observation )
+	{
+		case InvadersObservationVram:
+		{
+			memcpy( obs, vram, kInvadersObservationSize );
+		}
+		break;
+		case InvadersObservationRam:
+		{
+			// The buffer need not be aligned for floats.
+			float features[ 128 ];
+			assert( kNumInvadersRamFeatures <= sizeof( features ) / sizeof( features[ 0 ] ) );
+			ReadRamFeatures( env.Machine, features );
+			memcpy( obs, features, kNumInvadersRamFeatures * sizeof( float ) );
+		}
+		break;
+		default:
+		{
+			BuildObservation( env.Format, vram, env.PreviousVram, obs );
+		}
+		break;
+	}
+}
+
+InvadersEnv * InvadersEnvCreate( const Uint8 * rom, Uint32 frameSkip )
+{
+	InvadersEnv * env = new InvadersEnv;
+	env->Machine.Memory.Rom = InternRom( rom );
+	env->FrameSkip = frameSkip ? frameSkip : 1;
+	env->EndOnLifeLost = false;
+	env->Observation = InvadersObservationVram;
+
+	InstallHleRoutines( env->Machine.Memory.Rom );
+	InitCpuCaches( env->Machine.Memory.Rom );
+
+	StartOnePlayerGame( env->Machine, NULL );
+	env->Start = env->Machine;
+
+	InvadersEnvReset( env, NULL );
+	return env;
+}
+
+void InvadersEnvDestroy( InvadersEnv * env )
+{
+	delete env;
+}
+
+Uint8 InvadersEnvSetObservation( InvadersEnv * env, const InvadersObservationFormat * format )
+{
+	const Uint32 observation = format ? format->Mode : InvadersObservationVram;
+	if ( observation > InvadersObservationRam )
+		return 0;
+
+	if ( observation >= InvadersObservationMaxPool && observation <= InvadersObservationPacked )
+	{
+		static const ObservationFormat::Mode kModes[] = { ObservationFormat::MaxPool, ObservationFormat::MaxPool, ObservationFormat::Average, ObservationFormat::Packed };
+
+		ObservationFormat downsampled;
+		downsampled.OutputMode = kModes[ observation ];
+		downsampled.Width = format->Width;
+		downsampled.Height = format->Height;
+		downsampled.Upright = format->Upright != 0;
+		downsampled.MaxOfLastTwoFrames = format->MaxOfLastTwoFrames != 0;
+		if ( ! IsValidObservationFormat( downsampled ) )
+			return 0;
+
+		env->Format = downsampled;
+	}
+
+	env->Observation = observation;
+	return 1;
+}
+
+size_t InvadersEnvObservationSize( const InvadersEnv * env )
+{
+	switch ( env->Observation )
+	{
+		case InvadersObservationVram:
+		{
+			return kInvadersObservationSize;
+		}
+		break;
+		case InvadersObservationRam:
+		{
+			return kNumInvadersRamFeatures * sizeof( float );
+		}
+		break;
+	}
+
+	return ObservationSize( env->Format );
+}
+
+void InvadersEnvSetEndOnLifeLost( InvadersEnv * env, Uint8 endOnLifeLost )
+{
+	env->EndOnLifeLost = endOnLifeLost != 0;
+}
+
+void InvadersEnvReset( InvadersEnv * env, Uint8 * obs )
+{
+	env->Machine = env->Start;
+	ProbeInvadersRam( env->Machine, env->Ram );
+	env->Done = false;
+	memcpy( env->PreviousVram, &env->Machine.Memory[ 0x2400 ], kInvadersObservationSize );
+
+	WriteObservation( *env, obs );
+}
+
+void StepBatch( InvadersEnv ** envs, size_t count, const Uint8 * actions, Uint8 * obsOut, float * rewardsOut, Uint8 * doneOut )
+{
+	for ( size_t ix = 0; ix < count; ++ix )
+	{
+		InvadersEnv & env = *envs[ ix ];
+		Cpu8080 & chip8 = env.Machine;
+
+		chip8.Io.Inputs[ 1 ] = InvadersActionToInputs( actions[ ix ] );
+
+		Uint32 points = 0;
+		for ( Uint32 frame = 0; frame < env.FrameSkip && ! env.Done; ++frame )
+		{
+			if ( env.Format.MaxOfLastTwoFrames )
+			{
+				memcpy( env.PreviousVram, &chip8.Memory[ 0x2400 ], kInvadersObservationSize );
+			}
+
+			RunFrame( chip8 );
+
+			InvadersRamState ram;
+			ProbeInvadersRam( chip8, ram );
+			points += PointsScored( env.Ram, ram );
+			env.Done = ! ram.Playing || ( env.EndOnLifeLost && LostLife( env.Ram, ram ) );
+			env.Ram = ram;
+		}
+
+		rewardsOut[ ix ] = ( float )points;
+		doneOut[ ix ] = env.Done;
+
+		WriteObservation( env, obsOut );
+		obsOut += InvadersEnvObservationSize( &env );
+	}
+}
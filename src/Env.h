@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stddef.h>
+#include <SDL.h>
+
+// ------------------------------------------------------------
+// Environment API for agents (C linkage, so trainers can load it directly).
+//
+// Each environment is a headless machine that starts every episode at the
+// beginning of a one player game. An agent step holds one action on the
+// controls for FrameSkip frames, then reports an observation, the points
+// scored and whether the game is over (the last two read straight from the
+// game's RAM). Nothing is drawn and nothing is throttled.
+// ------------------------------------------------------------
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct InvadersEnv InvadersEnv;
+
+// Actions, mapped onto IN 1 (see InvadersActionToInputs).
+enum InvadersAction
+{
+	InvadersActionNoop = 0,
+	InvadersActionFire,
+	InvadersActionLeft,
+	InvadersActionRight,
+	InvadersActionLeftFire,
+	InvadersActionRightFire,
+	InvadersActionNum
+};
+
+// The IN 1 bits an action holds down.
+Uint8 InvadersActionToInputs( Uint32 action );
+
+// Observations default to the packed 1bpp VRAM (0x2400-0x3fff) as the machine has it, 224 rows of 32 bytes.
+enum
+{
+	kInvadersObservationSize = 0x1c00
+};
+
+// Or can be downsampled from it (see Observation.h), or be the decoded game state.
+enum InvadersObservationMode
+{
+	InvadersObservationVram = 0,
+	InvadersObservationMaxPool,
+	InvadersObservationAverage,
+	InvadersObservationPacked,
+	InvadersObservationRam			// The RAM probe's features (kNumInvadersRamFeatures floats, see RamProbe.h), Width and Height are ignored.
+};
+
+typedef struct InvadersObservationFormat
+{
+	Uint32	Mode;				// InvadersObservationMode
+	Uint32	Width;
+	Uint32	Height;
+	Uint8	Upright;
+	Uint8	MaxOfLastTwoFrames;
+} InvadersObservationFormat;
+
+// rom is the 8K of invaders.h, invaders.g, invaders.f and invaders.e; frameSkip is the frames per agent step (at least 1).
+// Create every environment before stepping any on other threads (this sets up what all of them share for the ROM).
+InvadersEnv * InvadersEnvCreate( const Uint8 * rom, Uint32 frameSkip );
+void InvadersEnvDestroy( InvadersEnv * env );
+
+// Sets the observations written (NULL for raw VRAM). Every environment in a batch must use the same format.
+// The downsampled modes take a Width and Height from 1 up to the VRAM's, 224 x 256 when Upright and 256 x 224
+// otherwise. Returns 0, leaving the observations as they were, for an unknown Mode or a size outside that.
+Uint8 InvadersEnvSetObservation( InvadersEnv * env, const InvadersObservationFormat * format );
+size_t InvadersEnvObservationSize( const InvadersEnv * env );
+
+// End episodes when the player's ship is destroyed, not just when the game is over.
+void InvadersEnvSetEndOnLifeLost( InvadersEnv * env, Uint8 endOnLifeLost );
+
+// Starts a new episode, writing its first observation to obs (if not NULL).
+void InvadersEnvReset( InvadersEnv * env, Uint8 * obs );
+
+// Advances count environments by one agent step each. actions holds one InvadersAction per environment;
+// obsOut receives count * InvadersEnvObservationSize bytes, rewardsOut and doneOut one entry per environment.
+// Environments that are done stay done (and are not stepped) until they are reset.
+void StepBatch( InvadersEnv ** envs, size_t count, const Uint8 * actions, Uint8 * obsOut, float * rewardsOut, Uint8 * doneOut );
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,594 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+
+#include "Fuse.h"
+#include "Alu.h"
+#include "Aot.h"
+
+static const Uint32 kRomSize = 0x2000;
+
+// ------------------------------------------------------------
+// Fused handlers.
+//
+// Picked from -fuseprofile over the attract mode and a few games. Each is
+// given the ROM at the first instruction and leaves pc where the last one
+// goes, the instruction clock is advanced by StepFused. IN and OUT aren't
+// fused (the devices need the clock up to date) and nor are EI, DI and
+// HLT.
+// ------------------------------------------------------------
+
+typedef void ( * FusedFunction )( Cpu8080 & chip8, const Uint8 * code );
+
+struct FusedHandler
+{
+	Uint8			Opcodes[ kMaxFusedInstructions ];
+	Uint8			Length;
+	FusedFunction	Run;
+};
+
+static inline Uint8 & Reg( AotRegisters & regs, AotRegisters::Gpr::T r )
+{
+	return regs.gpr[ RegIndex( r ) ];
+}
+
+static inline address Immediate16( const Uint8 * code )
+{
+	return ( address )( code[ 0 ] | ( code[ 1 ] << 8 ) );
+}
+
+// DCR B / JNZ.
+static void FusedDcrBJnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	Uint8 & b = Reg( regs, AotRegisters::Gpr::B );
+	b = AluDecrement( regs, b );
+	regs.pc = ! regs.flags.z ? Immediate16( code + 2 ) : regs.pc + 4;
+}
+
+// INX H / DCR B / JNZ.
+static void FusedInxHDcrBJnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.gprPair[ AotRegisters::GprPair::HL ]++;
+	Uint8 & b = Reg( regs, AotRegisters::Gpr::B );
+	b = AluDecrement( regs, b );
+	regs.pc = ! regs.flags.z ? Immediate16( code + 3 ) : regs.pc + 5;
+}
+
+// MOV A,M / ANA A / JNZ.
+static void FusedMovAMAnaAJnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	AluAnd( regs, regs.accumulator );
+	regs.pc = ! regs.flags.z ? Immediate16( code + 3 ) : regs.pc + 5;
+}
+
+// LDA / ANA A.
+static void FusedLdaAnaA( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, Immediate16( code + 1 ) );
+	AluAnd( regs, regs.accumulator );
+	regs.pc += 4;
+}
+
+// LDA / ANA A / JZ.
+static void FusedLdaAnaAJz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, Immediate16( code + 1 ) );
+	AluAnd( regs, regs.accumulator );
+	regs.pc = regs.flags.z ? Immediate16( code + 5 ) : regs.pc + 7;
+}
+
+// LDA / ANA A / JNZ.
+static void FusedLdaAnaAJnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, Immediate16( code + 1 ) );
+	AluAnd( regs, regs.accumulator );
+	regs.pc = ! regs.flags.z ? Immediate16( code + 5 ) : regs.pc + 7;
+}
+
+// LDA / ANA A / RZ.
+static void FusedLdaAnaARz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, Immediate16( code + 1 ) );
+	AluAnd( regs, regs.accumulator );
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : regs.pc + 5;
+}
+
+// LDA / ANA A / RNZ.
+static void FusedLdaAnaARnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, Immediate16( code + 1 ) );
+	AluAnd( regs, regs.accumulator );
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : regs.pc + 5;
+}
+
+// ANA A / JZ.
+static void FusedAnaAJz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AluAnd( regs, regs.accumulator );
+	regs.pc = regs.flags.z ? Immediate16( code + 2 ) : regs.pc + 4;
+}
+
+// ANA A / JNZ.
+static void FusedAnaAJnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AluAnd( regs, regs.accumulator );
+	regs.pc = ! regs.flags.z ? Immediate16( code + 2 ) : regs.pc + 4;
+}
+
+// LDA / CPI.
+static void FusedLdaCpi( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, Immediate16( code + 1 ) );
+	AluSubtract( regs, code[ 4 ], 0 );
+	regs.pc += 5;
+}
+
+// LDA / CPI / RET.
+static void FusedLdaCpiRet( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, Immediate16( code + 1 ) );
+	AluSubtract( regs, code[ 4 ], 0 );
+	regs.pc = AotPop16( chip8 );
+}
+
+// LDA / CPI / RZ.
+static void FusedLdaCpiRz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, Immediate16( code + 1 ) );
+	AluSubtract( regs, code[ 4 ], 0 );
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : regs.pc + 6;
+}
+
+// LDA / CPI / RNZ.
+static void FusedLdaCpiRnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, Immediate16( code + 1 ) );
+	AluSubtract( regs, code[ 4 ], 0 );
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : regs.pc + 6;
+}
+
+// CPI / RZ.
+static void FusedCpiRz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AluSubtract( regs, code[ 1 ], 0 );
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : regs.pc + 3;
+}
+
+// CPI / RNZ.
+static void FusedCpiRnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AluSubtract( regs, code[ 1 ], 0 );
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : regs.pc + 3;
+}
+
+// CPI / JZ.
+static void FusedCpiJz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AluSubtract( regs, code[ 1 ], 0 );
+	regs.pc = regs.flags.z ? Immediate16( code + 3 ) : regs.pc + 5;
+}
+
+// CPI / JC.
+static void FusedCpiJc( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AluSubtract( regs, code[ 1 ], 0 );
+	regs.pc = regs.flags.cy ? Immediate16( code + 3 ) : regs.pc + 5;
+}
+
+// ANI / SUI / RNZ, the ANI's flags are all written again by the SUI.
+static void FusedAniSuiRnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator &= code[ 1 ];
+	regs.accumulator = AluSubtract( regs, code[ 3 ], 0 );
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : regs.pc + 5;
+}
+
+// MOV A,L / ANI / CPI / JC, the ANI's flags are all written again by the CPI.
+static void FusedMovALAniCpiJc( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = Reg( regs, AotRegisters::Gpr::L ) & code[ 2 ];
+	AluSubtract( regs, code[ 4 ], 0 );
+	regs.pc = regs.flags.cy ? Immediate16( code + 6 ) : regs.pc + 8;
+}
+
+// LDAX D / MOV M,A / INX H / INX D.
+static void FusedLdaxDMovMAInxHInxD( Cpu8080 & chip8, const Uint8 * code )
+{
+	( void )code;
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	regs.gprPair[ AotRegisters::GprPair::HL ]++;
+	regs.gprPair[ AotRegisters::GprPair::DE ]++;
+	regs.pc += 4;
+}
+
+// MOV M,A / INX H / INX D.
+static void FusedMovMAInxHInxD( Cpu8080 & chip8, const Uint8 * code )
+{
+	( void )code;
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	regs.gprPair[ AotRegisters::GprPair::HL ]++;
+	regs.gprPair[ AotRegisters::GprPair::DE ]++;
+	regs.pc += 3;
+}
+
+// MOV M,A / INX H.
+static void FusedMovMAInxH( Cpu8080 & chip8, const Uint8 * code )
+{
+	( void )code;
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	regs.gprPair[ AotRegisters::GprPair::HL ]++;
+	regs.pc += 2;
+}
+
+// MVI M / INX H.
+static void FusedMviMInxH( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], code[ 1 ] );
+	regs.gprPair[ AotRegisters::GprPair::HL ]++;
+	regs.pc += 3;
+}
+
+// MOV A,M / INX H.
+static void FusedMovAMInxH( Cpu8080 & chip8, const Uint8 * code )
+{
+	( void )code;
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	regs.gprPair[ AotRegisters::GprPair::HL ]++;
+	regs.pc += 2;
+}
+
+// MOV E,M / INX H / MOV D,M.
+static void FusedMovEMInxHMovDM( Cpu8080 & chip8, const Uint8 * code )
+{
+	( void )code;
+	AotRegisters & regs = chip8.Cpu.Regs;
+	Reg( regs, AotRegisters::Gpr::E ) = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	regs.gprPair[ AotRegisters::GprPair::HL ]++;
+	Reg( regs, AotRegisters::Gpr::D ) = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	regs.pc += 3;
+}
+
+// LXI H / MOV A,M / INX H / MOV B,M.
+static void FusedLxiHMovAMInxHMovBM( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	const address hl = Immediate16( code + 1 );
+	regs.accumulator = AotRead8( chip8, hl );
+	Reg( regs, AotRegisters::Gpr::B ) = AotRead8( chip8, hl + 1 );
+	regs.gprPair[ AotRegisters::GprPair::HL ] = hl + 1;
+	regs.pc += 6;
+}
+
+// ORA B / RNZ.
+static void FusedOraBRnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	( void )code;
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AluOr( regs, Reg( regs, AotRegisters::Gpr::B ) );
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : regs.pc + 2;
+}
+
+// MOV C,A / ORA B / MOV A,C / JNZ.
+static void FusedMovCAOraBMovACJnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	Reg( regs, AotRegisters::Gpr::C ) = regs.accumulator;
+	AluOr( regs, Reg( regs, AotRegisters::Gpr::B ) );
+	regs.accumulator = Reg( regs, AotRegisters::Gpr::C );
+	regs.pc = ! regs.flags.z ? Immediate16( code + 4 ) : regs.pc + 6;
+}
+
+// LXI B / DAD B.
+static void FusedLxiBDadB( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.gprPair[ AotRegisters::GprPair::BC ] = Immediate16( code + 1 );
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	regs.pc += 4;
+}
+
+// DAD B / POP B / DCR B / JNZ.
+static void FusedDadBPopBDcrBJnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	Uint8 & b = Reg( regs, AotRegisters::Gpr::B );
+	b = AluDecrement( regs, b );
+	regs.pc = ! regs.flags.z ? Immediate16( code + 4 ) : regs.pc + 6;
+}
+
+// MOV A,H / RAR / MOV H,A / MOV A,L (the first half of shifting HL right).
+static void FusedMovAHRarMovHAMovAL( Cpu8080 & chip8, const Uint8 * code )
+{
+	( void )code;
+	AotRegisters & regs = chip8.Cpu.Regs;
+	Uint8 & h = Reg( regs, AotRegisters::Gpr::H );
+	const Uint8 carry = h & 1;
+	h = ( Uint8 )( ( h >> 1 ) | ( regs.flags.cy << 7 ) );
+	regs.flags.cy = carry;
+	regs.accumulator = Reg( regs, AotRegisters::Gpr::L );
+	regs.pc += 4;
+}
+
+// RAR / MOV L,A / DCR B / JNZ (the second half).
+static void FusedRarMovLADcrBJnz( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	const Uint8 carry = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	regs.flags.cy = carry;
+	Reg( regs, AotRegisters::Gpr::L ) = regs.accumulator;
+	Uint8 & b = Reg( regs, AotRegisters::Gpr::B );
+	b = AluDecrement( regs, b );
+	regs.pc = ! regs.flags.z ? Immediate16( code + 4 ) : regs.pc + 6;
+}
+
+// RRC / JC.
+static void FusedRrcJc( Cpu8080 & chip8, const Uint8 * code )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.accumulator << 7 ) );
+	regs.pc = regs.flags.cy ? Immediate16( code + 2 ) : regs.pc + 4;
+}
+
+static const FusedHandler kFusedHandlers[ ] =
+{
+	{ { 0x05, 0xc2 },				2,	FusedDcrBJnz },
+	{ { 0x23, 0x05, 0xc2 },			3,	FusedInxHDcrBJnz },
+	{ { 0x7e, 0xa7, 0xc2 },			3,	FusedMovAMAnaAJnz },
+	{ { 0x3a, 0xa7 },				2,	FusedLdaAnaA },
+	{ { 0x3a, 0xa7, 0xca },			3,	FusedLdaAnaAJz },
+	{ { 0x3a, 0xa7, 0xc2 },			3,	FusedLdaAnaAJnz },
+	{ { 0x3a, 0xa7, 0xc8 },			3,	FusedLdaAnaARz },
+	{ { 0x3a, 0xa7, 0xc0 },			3,	FusedLdaAnaARnz },
+	{ { 0xa7, 0xca },				2,	FusedAnaAJz },
+	{ { 0xa7, 0xc2 },				2,	FusedAnaAJnz },
+	{ { 0x3a, 0xfe },				2,	FusedLdaCpi },
+	{ { 0x3a, 0xfe, 0xc9 },			3,	FusedLdaCpiRet },
+	{ { 0x3a, 0xfe, 0xc8 },			3,	FusedLdaCpiRz },
+	{ { 0x3a, 0xfe, 0xc0 },			3,	FusedLdaCpiRnz },
+	{ { 0xfe, 0xc8 },				2,	FusedCpiRz },
+	{ { 0xfe, 0xc0 },				2,	FusedCpiRnz },
+	{ { 0xfe, 0xca },				2,	FusedCpiJz },
+	{ { 0xfe, 0xda },				2,	FusedCpiJc },
+	{ { 0xe6, 0xd6, 0xc0 },			3,	FusedAniSuiRnz },
+	{ { 0x7d, 0xe6, 0xfe, 0xda },	4,	FusedMovALAniCpiJc },
+	{ { 0x1a, 0x77, 0x23, 0x13 },	4,	FusedLdaxDMovMAInxHInxD },
+	{ { 0x77, 0x23, 0x13 },			3,	FusedMovMAInxHInxD },
+	{ { 0x77, 0x23 },				2,	FusedMovMAInxH },
+	{ { 0x36, 0x23 },				2,	FusedMviMInxH },
+	{ { 0x7e, 0x23 },				2,	FusedMovAMInxH },
+	{ { 0x5e, 0x23, 0x56 },			3,	FusedMovEMInxHMovDM },
+	{ { 0x21, 0x7e, 0x23, 0x46 },	4,	FusedLxiHMovAMInxHMovBM },
+	{ { 0xb0, 0xc0 },				2,	FusedOraBRnz },
+	{ { 0x4f, 0xb0, 0x79, 0xc2 },	4,	FusedMovCAOraBMovACJnz },
+	{ { 0x01, 0x09 },				2,	FusedLxiBDadB },
+	{ { 0x09, 0xc1, 0x05, 0xc2 },	4,	FusedDadBPopBDcrBJnz },
+	{ { 0x7c, 0x1f, 0x67, 0x7d },	4,	FusedMovAHRarMovHAMovAL },
+	{ { 0x1f, 0x6f, 0x05, 0xc2 },	4,	FusedRarMovLADcrBJnz },
+	{ { 0x0f, 0xda },				2,	FusedRrcJc },
+};
+
+static const size_t kNumFusedHandlers = sizeof( kFusedHandlers ) / sizeof( kFusedHandlers[ 0 ] );
+
+static bool IsFusedSequence( const FusedHandler & handler, const Uint8 * opcodes, Uint8 length )
+{
+	return handler.Length == length && memcmp( handler.Opcodes, opcodes, length ) == 0;
+}
+
+// ------------------------------------------------------------
+// Profile.
+// ------------------------------------------------------------
+
+static bool IsSameSequence( const OpcodeSequence & a, const OpcodeSequence & b )
+{
+	return a.Length == b.Length && memcmp( a.Opcodes, b.Opcodes, a.Length ) == 0;
+}
+
+// Groups the same sequences together.
+static bool SequenceOrder( const OpcodeSequence & a, const OpcodeSequence & b )
+{
+	if ( a.Length != b.Length )
+		return a.Length < b.Length;
+	return memcmp( a.Opcodes, b.Opcodes, a.Length ) < 0;
+}
+
+static bool MostExecuted( const OpcodeSequence & a, const OpcodeSequence & b )
+{
+	if ( a.Executions != b.Executions )
+		return a.Executions > b.Executions;
+	return SequenceOrder( a, b );
+}
+
+void ProfileOpcodeSequences( const Cpu8080 & start, const RomCfg & cfg, Uint32 frames, std::vector< OpcodeSequence > & sequences )
+{
+	// How often each instruction ran (not counting interrupts taken in its place).
+	Cpu8080 * chip8 = new Cpu8080( start );
+	chip8->HleEnabled = false;
+
+	std::vector< Uint64 > executions( kRomSize, 0 );
+	const Uint32 endFrame = start.Frame + frames;
+	while ( chip8->Frame < endFrame )
+	{
+		if ( IsInterruptDue( *chip8 ) )
+		{
+			RaiseInterrupt( *chip8 );
+			continue;
+		}
+
+		const address pc = chip8->Cpu.Regs.pc;
+		const bool interrupting = chip8->InterruptsEnabled && ( chip8->InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] || chip8->InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] );
+		if ( ! interrupting && pc < kRomSize )
+		{
+			++executions[ pc ];
+		}
+
+		StepCpu( *chip8 );
+	}
+	delete chip8;
+
+	// Every run inside a block, by where it starts.
+	const Uint8 * rom = start.Memory.Rom;
+	std::vector< OpcodeSequence > sites;
+	for ( size_t ix = 0; ix < cfg.Blocks.size( ); ++ix )
+	{
+		const CfgBlock & block = cfg.Blocks[ ix ];
+		for ( address pc = block.Start; pc < block.End; pc += InstructionSize[ rom[ pc ] ] )
+		{
+			if ( ! executions[ pc ] )
+				continue;
+
+			OpcodeSequence sequence;
+			memset( &sequence, 0, sizeof( sequence ) );
+			sequence.Sites = 1;
+			sequence.Executions = executions[ pc ];
+
+			address next = pc;
+			for ( Uint32 length = 1; length <= kMaxFusedInstructions && next < block.End; ++length )
+			{
+				sequence.Opcodes[ length - 1 ] = rom[ next ];
+				sequence.Length = ( Uint8 )length;
+				next += InstructionSize[ rom[ next ] ];
+				if ( length > 1 )
+				{
+					sites.push_back( sequence );
+				}
+			}
+		}
+	}
+
+	// Add up the sites of each sequence.
+	std::sort( sites.begin( ), sites.end( ), SequenceOrder );
+	sequences.clear( );
+	for ( size_t ix = 0; ix < sites.size( ); ++ix )
+	{
+		if ( ! sequences.empty( ) && IsSameSequence( sequences.back( ), sites[ ix ] ) )
+		{
+			sequences.back( ).Sites += 1;
+			sequences.back( ).Executions += sites[ ix ].Executions;
+		}
+		else
+		{
+			sequences.push_back( sites[ ix ] );
+			sequences.back( ).Fused = false;
+			for ( size_t handler = 0; handler < kNumFusedHandlers; ++handler )
+			{
+				sequences.back( ).Fused |= IsFusedSequence( kFusedHandlers[ handler ], sites[ ix ].Opcodes, sites[ ix ].Length );
+			}
+		}
+	}
+	std::sort( sequences.begin( ), sequences.end( ), MostExecuted );
+}
+
+void FormatOpcodeSequence( const OpcodeSequence & sequence, char * text, size_t size )
+{
+	assert( size );
+	text[ 0 ] = 0;
+	for ( Uint32 ix = 0; ix < sequence.Length; ++ix )
+	{
+		char mnemonic[ 32 ];
+		sprintf_s( mnemonic, sizeof( mnemonic ), GetCfgMnemonic( sequence.Opcodes[ ix ] ), "n" );
+		const size_t used = strlen( text );
+		sprintf_s( text + used, size - used, ix ? " / %s" : "%s", mnemonic );
+	}
+}
+
+// ------------------------------------------------------------
+// Engine.
+// ------------------------------------------------------------
+
+// The handler for each ROM address (the one fusing the most instructions), and the ROM they are for.
+static const FusedHandler * s_FusedHandlers[ kRomSize ];
+static const Uint8 * s_FusedRom = NULL;
+
+// Returns true if the instructions at pc are the handler's (all inside the ROM).
+static bool MatchesFusedHandler( const Uint8 * rom, address pc, const FusedHandler & handler )
+{
+	Uint32 addr = pc;
+	for ( Uint32 ix = 0; ix < handler.Length; ++ix )
+	{
+		if ( addr >= kRomSize || rom[ addr ] != handler.Opcodes[ ix ] )
+			return false;
+
+		addr += InstructionSize[ rom[ addr ] ];
+	}
+	return addr <= kRomSize;
+}
+
+Uint32 InitFusedEngine( const Uint8 * rom )
+{
+	Uint32 sites = 0;
+	for ( Uint32 pc = 0; pc < kRomSize; ++pc )
+	{
+		s_FusedHandlers[ pc ] = NULL;
+		for ( size_t ix = 0; ix < kNumFusedHandlers; ++ix )
+		{
+			const FusedHandler & handler = kFusedHandlers[ ix ];
+			if ( MatchesFusedHandler( rom, ( address )pc, handler ) && ( ! s_FusedHandlers[ pc ] || handler.Length > s_FusedHandlers[ pc ]->Length ) )
+			{
+				s_FusedHandlers[ pc ] = &handler;
+			}
+		}
+		sites += s_FusedHandlers[ pc ] ? 1 : 0;
+	}
+	s_FusedRom = rom;
+	return sites;
+}
+
+void StepFused( Cpu8080 & chip8 )
+{
+	const address pc = chip8.Cpu.Regs.pc;
+	const FusedHandler * handler = chip8.Memory.Rom == s_FusedRom && pc < kRomSize ? s_FusedHandlers[ pc ] : NULL;
+
+	if ( handler && CanRunUninterrupted( chip8, handler->Length ) )
+	{
+		handler->Run( chip8, s_FusedRom + pc );
+		chip8.InstructionsSinceInterrupt += handler->Length;
+
+		// The interpreter didn't see these go by, so look for an idle loop as it would have (e.g. FusedLdaAnaAJnz is the
+		// whole of the 0x0ada poll loop).
+		address lastPc = pc;
+		for ( Uint8 ix = 0; ix + 1 < handler->Length; ++ix )
+		{
+			lastPc = ( address )( lastPc + InstructionSize[ handler->Opcodes[ ix ] ] );
+		}
+		CheckIdleLoop( chip8, pc, lastPc );
+		return;
+	}
+
+	// The handlers stand in for the ROM, so HLE routines don't.
+	const bool hleEnabled = chip8.HleEnabled;
+	chip8.HleEnabled = false;
+	StepCpu( chip8 );
+	chip8.HleEnabled = hleEnabled;
+}
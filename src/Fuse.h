@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+
+#include "Cpu8080.h"
+#include "Cfg.h"
+
+// ------------------------------------------------------------
+// Superinstructions.
+//
+// ProfileOpcodeSequences runs the game and counts how often each run of 2
+// to 4 instructions inside a basic block executes (a run inside a block
+// always executes whole, so this is just how often its first instruction
+// did). The hottest ones have fused handlers here, each executing the whole
+// run with one dispatch and only working out the flags something can still
+// read (a flag written again later in the run is dead where it was first
+// written).
+//
+// The "fused" CPU engine installs a handler at every ROM address whose
+// bytes match one (the longest if several do) and runs it when all of it
+// fits before the next interrupt, with no EI/DI pending and no interrupt
+// waiting, otherwise it steps the interpreter, as the "aot" engine does.
+// Idle loops closed by a handler's last instruction are skipped as under
+// the interpreter.
+// ------------------------------------------------------------
+
+static const Uint32 kMaxFusedInstructions = 4;
+
+struct OpcodeSequence
+{
+	Uint8	Opcodes[ kMaxFusedInstructions ];
+	Uint8	Length;
+	Uint32	Sites;			// ROM addresses it ran at.
+	Uint64	Executions;
+	bool	Fused;			// There is a handler for it.
+};
+
+// Runs the interpreter from start for frames, then fills in sequences with every run of 2 to kMaxFusedInstructions
+// instructions inside one of the cfg's blocks that executed, most executions first.
+void ProfileOpcodeSequences( const Cpu8080 & start, const RomCfg & cfg, Uint32 frames, std::vector< OpcodeSequence > & sequences );
+
+// Mnemonics separated by slashes ("ldax d / mov m,a"), immediate operands as n.
+void FormatOpcodeSequence( const OpcodeSequence & sequence, char * text, size_t size );
+
+// Installs the fused handlers at every address of the ROM that matches one (once, before any threads are started).
+// Returns the number of addresses.
+Uint32 InitFusedEngine( const Uint8 * rom );
+
+// Runs a fused handler, or one instruction (or a waiting interrupt) on the interpreter.
+void StepFused( Cpu8080 & chip8 );
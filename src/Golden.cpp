@@ -0,0 +1,533 @@
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+#include <SDL_thread.h>
+
+#include "Golden.h"
+#include "IoBus.h"
+#include "RamProbe.h"
+#include "Search.h"
+
+// ------------------------------------------------------------
+// Scripts.
+// ------------------------------------------------------------
+
+// Frames run once a script has seen what it is after, so the checkpoints cover what follows it too.
+static const Uint32 kScenarioTailFrames = 120;
+
+// Games of seeded random inputs that follow the scripted scenarios.
+static const Uint32 kRandomScenarios = 200;
+static const Uint32 kRandomScenarioFrames = 300;
+
+struct ScenarioState
+{
+	const Cpu8080 *		Machine;
+	Uint32				Frame;		// Since the scenario started.
+	Uint32				Random;		// Seeded with the scenario's number.
+	InvadersRamState	Previous;	// Last frame's.
+	InvadersRamState	Ram;
+	bool				Finished;	// Set by the script once it has seen what it is after.
+};
+
+// Returns the IN 1 bits to hold for the next frame.
+typedef Uint8 ( *ScenarioScript )( ScenarioState & state );
+
+// Fire only registers when it was let go since the last shot.
+static Uint8 FireEveryOtherFrame( const ScenarioState & state )
+{
+	return ( state.Frame & 1 ) ? kInputFire : 0;
+}
+
+// The VRAM row for an x in the game's coordinates, which count from 0x2000 (so the screen starts at 32).
+static address VramRowAt( int x )
+{
+	return ( address )( 0x2000 + x * 32 );
+}
+
+// True if an alien's shot is coming down on x0-x1. They show up as lit pixels just above the ship (y 40-47,
+// VRAM byte 5 of the rows for those x) or between the shields (bytes 6-7) and the aliens.
+static bool IsShotComing( const ScenarioState & state, int x0, int x1 )
+{
+	const Cpu8080 & chip8 = *state.Machine;
+	const int top = std::min( 11, state.Ram.RackY / 8 - 1 );
+	for ( int x = std::max( x0, 32 ); x <= std::min( x1, 255 ); ++x )
+	{
+		// The player's own shot is in there too.
+		if ( state.Ram.ShotStatus != 0 && abs( x - state.Ram.ShotX ) <= 1 )
+			continue;
+
+		const address row = VramRowAt( x );
+		for ( int y = 5; y <= top; ++y )
+		{
+			if ( ( y < 6 || y > 7 ) && chip8.Memory[ row + y ] )
+				return true;
+		}
+	}
+	return false;
+}
+
+// Moves so the player's shot (from the middle of the ship) will go up at x, getting out of the way of the aliens' shots first.
+static Uint8 MoveToFireAt( const ScenarioState & state, int x )
+{
+	const int shotX = state.Ram.PlayerX + 8;
+	if ( IsShotComing( state, shotX - 10, shotX + 10 ) )
+	{
+		const bool leftClear = ! IsShotComing( state, shotX - 26, shotX - 11 );
+		return ( leftClear && shotX > 64 ) || shotX > 220 ? kInputLeft : kInputRight;
+	}
+
+	if ( shotX < x - 1 )
+		return kInputRight;
+	if ( shotX > x + 1 )
+		return kInputLeft;
+
+	return state.Ram.ShotStatus == 0 ? FireEveryOtherFrame( state ) : 0;
+}
+
+static Uint8 AttractScript( ScenarioState & state )
+{
+	return 0;
+}
+
+static Uint8 StartGameScript( ScenarioState & state )
+{
+	state.Finished = state.Finished || state.Ram.Playing;
+
+	// Held for a few frames each, as the ROM debounces them.
+	if ( state.Frame >= 10 && state.Frame < 14 )
+		return kInputCoin;
+	if ( state.Frame >= 30 && state.Frame < 34 )
+		return kInputOnePlayerStart;
+
+	return 0;
+}
+
+static Uint8 LoseLifeScript( ScenarioState & state )
+{
+	// Sit still and wait to be shot.
+	state.Finished = state.Finished || LostLife( state.Previous, state.Ram );
+	return 0;
+}
+
+static Uint8 ShootSaucerScript( ScenarioState & state )
+{
+	const Cpu8080 & chip8 = *state.Machine;
+
+	// X2085 is set while the saucer is blowing up.
+	state.Finished = state.Finished || chip8.Memory[ 0x2085 ];
+
+	// Wait in the middle, then shoot where the saucer will be by the time the shot gets up there
+	// (X208A is its x, X208C how far it moves each time, the shot climbs 4 pixels a frame).
+	int target = 112;
+	if ( state.Ram.SaucerActive )
+	{
+		const int saucerX = chip8.Memory[ 0x208a ];
+		const int lead = ( Sint8 )chip8.Memory[ 0x208c ] > 0 ? 28 : -28;
+		target = saucerX + 12 + lead;
+	}
+	return MoveToFireAt( state, target );
+}
+
+static Uint8 ClearWaveScript( ScenarioState & state )
+{
+	if ( ! state.Ram.Playing )
+		return StartGameScript( state );
+
+	state.Finished = state.Finished || state.Ram.AliensRemaining == 0;
+
+	// Shoot up the nearest x under a live alien that the shields (VRAM bytes 6-7, y 48-63) don't cover. Each column
+	// of aliens is 16 pixels wide with the alien in the middle of it, and one alien moves 2 pixels a frame, so the
+	// rack moves 2 / AliensRemaining a frame while the shot climbs 4 pixels a frame up to the lowest alien.
+	const Cpu8080 & chip8 = *state.Machine;
+	const int shotX = state.Ram.PlayerX + 8;
+	const int aliens = std::max< int >( state.Ram.AliensRemaining, 1 );
+	int target = -1;
+	for ( int column = 0; column < 11; ++column )
+	{
+		int lowest = -1;
+		for ( int row = 4; row >= 0; --row )
+		{
+			lowest = state.Ram.Aliens[ row * 11 + column ] ? row : lowest;
+		}
+		if ( lowest < 0 )
+			continue;
+
+		const int climb = std::max( state.Ram.RackY + lowest * 16 - 40, 0 ) / 4;
+		const int lead = ( state.Ram.RackDirection ? -2 : 2 ) * climb / aliens;
+		const int left = state.Ram.RackX + column * 16 + lead;
+		for ( int x = left + 3; x <= left + 10; ++x )
+		{
+			const address row = VramRowAt( x );
+			if ( x >= 32 && x < 256 && ! ( chip8.Memory[ row + 6 ] | chip8.Memory[ row + 7 ] ) && ( target < 0 || abs( x - shotX ) < abs( target - shotX ) ) )
+			{
+				target = x;
+			}
+		}
+	}
+	return target < 0 ? 0 : MoveToFireAt( state, target );
+}
+
+static Uint8 RandomScript( ScenarioState & state )
+{
+	state.Random = state.Random * 1103515245 + 12345;
+	return ( Uint8 )( ( state.Random >> 16 ) & ( kInputFire | kInputLeft | kInputRight ) );
+}
+
+struct GoldenScenario
+{
+	const char *	Name;
+	ScenarioScript	Script;
+	bool			FromGameStart;	// Or from reset.
+	Uint8			DipSwitches;	// IN 2 from reset (bits 0-1 are the ships per game less 3).
+	Uint32			MaxFrames;
+};
+
+static const GoldenScenario kGoldenScenarios[] =
+{
+	{ "Attract",		AttractScript,		false,	0,	2400 },
+	{ "StartGame",		StartGameScript,	false,	0,	600 },
+	{ "LoseLife",		LoseLifeScript,		true,	0,	3600 },
+	{ "ShootSaucer",	ShootSaucerScript,	true,	0,	7200 },
+	{ "ClearWave",		ClearWaveScript,	false,	3,	9000 },
+};
+
+static const size_t kNumScriptedScenarios = sizeof( kGoldenScenarios ) / sizeof( kGoldenScenarios[ 0 ] );
+
+static GoldenScenario GetScenario( size_t scenario )
+{
+	if ( scenario < kNumScriptedScenarios )
+		return kGoldenScenarios[ scenario ];
+
+	GoldenScenario random = { "Random", RandomScript, true, 0, kRandomScenarioFrames };
+	return random;
+}
+
+size_t GetNumGoldenScenarios( )
+{
+	return kNumScriptedScenarios + kRandomScenarios;
+}
+
+void GetGoldenScenarioName( size_t scenario, char * name )
+{
+	if ( scenario < kNumScriptedScenarios )
+	{
+		sprintf_s( name, 32, "%s", kGoldenScenarios[ scenario ].Name );
+	}
+	else
+	{
+		sprintf_s( name, 32, "Random%03u", ( Uint32 )( scenario - kNumScriptedScenarios ) );
+	}
+}
+
+// ------------------------------------------------------------
+// Files.
+// ------------------------------------------------------------
+
+bool LoadGoldenHashes( const char * file, GoldenHashes & hashes, Uint32 & flags )
+{
+	hashes.clear( );
+	hashes.resize( GetNumGoldenScenarios( ) );
+	flags = kGoldenDefaultFlags;
+
+	FILE * fh = NULL;
+	if ( fopen_s( &fh, file, "r" ) != 0 )
+	{
+		return false;
+	}
+
+	// "<name> <frame> <vram hash> <ram hash>", lines for the same scenario in frame order.
+	char line[ 128 ];
+	char name[ 32 ];
+	size_t scenario = 0;
+	while ( fgets( line, sizeof( line ), fh ) )
+	{
+		// "# flags <kMovieFlag...>", the options the hashes were made with.
+		if ( sscanf_s( line, "# flags %x", &flags ) == 1 )
+			continue;
+
+		const char * space = strchr( line, ' ' );
+		if ( line[ 0 ] == '#' || ! space || space - line >= ( int )sizeof( name ) )
+			continue;
+
+		GoldenCheckpoint checkpoint;
+		if ( sscanf_s( space, "%u %x %x", &checkpoint.Frame, &checkpoint.VramHash, &checkpoint.RamHash ) != 3 )
+			continue;
+
+		// Usually the same scenario as the line before.
+		GetGoldenScenarioName( scenario, name );
+		if ( strncmp( line, name, space - line ) != 0 || name[ space - line ] != 0 )
+		{
+			for ( scenario = 0; scenario < hashes.size( ); ++scenario )
+			{
+				GetGoldenScenarioName( scenario, name );
+				if ( strncmp( line, name, space - line ) == 0 && name[ space - line ] == 0 )
+					break;
+			}
+		}
+
+		if ( scenario < hashes.size( ) )
+		{
+			hashes[ scenario ].push_back( checkpoint );
+		}
+		else
+		{
+			printf( "Warning: unknown golden scenario in %s: %s", file, line );
+			scenario = 0;
+		}
+	}
+
+	fclose( fh );
+	return true;
+}
+
+bool SaveGoldenHashes( const char * file, const GoldenHashes & hashes, Uint32 flags )
+{
+	FILE * fh = NULL;
+	if ( fopen_s( &fh, file, "w" ) != 0 )
+	{
+		return false;
+	}
+
+	fprintf( fh, "# flags %x\n", flags );
+	fprintf( fh, "# scenario frame vram ram\n" );
+	char name[ 32 ];
+	for ( size_t ix = 0; ix < hashes.size( ); ++ix )
+	{
+		GetGoldenScenarioName( ix, name );
+		for ( size_t jx = 0; jx < hashes[ ix ].size( ); ++jx )
+		{
+			const GoldenCheckpoint & checkpoint = hashes[ ix ][ jx ];
+			fprintf( fh, "%s %u %08x %08x\n", name, checkpoint.Frame, checkpoint.VramHash, checkpoint.RamHash );
+		}
+	}
+
+	fclose( fh );
+	return true;
+}
+
+static void PutLittleEndian( Uint8 * out, Uint32 value, size_t size )
+{
+	for ( size_t ix = 0; ix < size; ++ix )
+	{
+		out[ ix ] = ( Uint8 )( value >> ( ix * 8 ) );
+	}
+}
+
+// Saves the picture the player would see (224 x 256 upright) as a 1bpp bitmap.
+static bool SaveVramBitmap( const char * file, const Uint8 * vram )
+{
+	const Uint32 width = 224;
+	const Uint32 height = 256;
+	const Uint32 pitch = width / 8;		// Already a multiple of 4.
+
+	Uint8 header[ 62 ] = { 'B', 'M' };
+	PutLittleEndian( &header[ 2 ], sizeof( header ) + pitch * height, 4 );
+	PutLittleEndian( &header[ 10 ], sizeof( header ), 4 );
+	PutLittleEndian( &header[ 14 ], 40, 4 );
+	PutLittleEndian( &header[ 18 ], width, 4 );
+	PutLittleEndian( &header[ 22 ], height, 4 );
+	PutLittleEndian( &header[ 26 ], 1, 2 );
+	PutLittleEndian( &header[ 28 ], 1, 2 );
+	PutLittleEndian( &header[ 34 ], pitch * height, 4 );
+	PutLittleEndian( &header[ 46 ], 2, 4 );
+	PutLittleEndian( &header[ 58 ], 0xffffff, 3 );		// Palette is black then white.
+
+	// Bitmaps go bottom up, which is VRAM's bit order; each VRAM row is a column of the picture.
+	Uint8 pixels[ pitch * height ] = { 0 };
+	for ( Uint32 y = 0; y < height; ++y )
+	{
+		for ( Uint32 x = 0; x < width; ++x )
+		{
+			if ( ( vram[ x * 32 + y / 8 ] >> ( y % 8 ) ) & 1 )
+			{
+				pixels[ y * pitch + x / 8 ] |= 0x80 >> ( x % 8 );
+			}
+		}
+	}
+
+	FILE * fh = NULL;
+	if ( fopen_s( &fh, file, "wb" ) != 0 )
+	{
+		return false;
+	}
+	fwrite( header, sizeof( header ), 1, fh );
+	fwrite( pixels, sizeof( pixels ), 1, fh );
+	fclose( fh );
+	return true;
+}
+
+// ------------------------------------------------------------
+// Running.
+// ------------------------------------------------------------
+
+struct GoldenJob
+{
+	const Cpu8080 *			Reset;
+	const Cpu8080 *			GameStart;
+	const GoldenHashes *	Golden;
+	GoldenHashes *			Results;
+	SDL_mutex *				Lock;
+	size_t					NextScenario;	// Guarded by Lock.
+	GoldenReport *			Report;			// Guarded by Lock.
+};
+
+static GoldenCheckpoint MakeCheckpoint( const Cpu8080 & chip8, Uint32 frame )
+{
+	GoldenCheckpoint checkpoint;
+	checkpoint.Frame = frame;
+	checkpoint.VramHash = HashBytes( kHashSeed, &chip8.Memory[ 0x2400 ], 0x1c00 );
+	checkpoint.RamHash = HashBytes( kHashSeed, &chip8.Memory[ 0x2000 ], 0x400 );
+	return checkpoint;
+}
+
+// Runs a scenario, returns false if it differed from golden (saving the first frame that did). Scenarios golden has nothing for are only run.
+static bool RunScenario( GoldenJob & shared, size_t scenario, Cpu8080 & chip8, bool & finished )
+{
+	const GoldenScenario script = GetScenario( scenario );
+	const std::vector< GoldenCheckpoint > * golden = shared.Golden && ! ( *shared.Golden )[ scenario ].empty( ) ? &( *shared.Golden )[ scenario ] : NULL;
+	std::vector< GoldenCheckpoint > & results = ( *shared.Results )[ scenario ];
+	results.clear( );
+
+	chip8 = script.FromGameStart ? *shared.GameStart : *shared.Reset;
+	if ( ! script.FromGameStart )
+	{
+		chip8.Io.Inputs[ 2 ] = script.DipSwitches;
+	}
+
+	ScenarioState state;
+	state.Machine = &chip8;
+	state.Frame = 0;
+	state.Random = ( Uint32 )scenario;
+	state.Finished = false;
+	ProbeInvadersRam( chip8, state.Ram );
+	state.Previous = state.Ram;
+
+	bool matched = true;
+	Uint32 endFrame = script.MaxFrames;
+	for ( ; ; )
+	{
+		state.Previous = state.Ram;
+		ProbeInvadersRam( chip8, state.Ram );
+
+		const bool last = state.Frame == endFrame;
+		if ( state.Frame % kGoldenCheckInterval == 0 || last )
+		{
+			results.push_back( MakeCheckpoint( chip8, state.Frame ) );
+
+			const size_t ix = results.size( ) - 1;
+			if ( matched && golden && ( ix >= golden->size( ) || memcmp( &results[ ix ], &( *golden )[ ix ], sizeof( results[ ix ] ) ) != 0 ) )
+			{
+				char name[ 32 ];
+				char file[ 64 ];
+				GetGoldenScenarioName( scenario, name );
+				sprintf_s( file, sizeof( file ), "%s_%u.bmp", name, state.Frame );
+				SaveVramBitmap( file, &chip8.Memory[ 0x2400 ] );
+
+				SDL_LockMutex( shared.Lock );
+				printf( "%s differs from golden at frame %u, saved to %s\n", name, state.Frame, file );
+				SDL_UnlockMutex( shared.Lock );
+				matched = false;
+			}
+		}
+		if ( last )
+			break;
+
+		const Uint8 inputs = script.Script( state );
+		if ( state.Finished && endFrame == script.MaxFrames )
+		{
+			endFrame = std::min( state.Frame + kScenarioTailFrames, script.MaxFrames );
+		}
+
+		RunFramesWithInputs( chip8, inputs, 1, NULL );
+		state.Frame++;
+	}
+
+	// Scenarios without a goal run to MaxFrames.
+	finished = state.Finished || script.Script == AttractScript || script.Script == RandomScript;
+
+	char name[ 32 ];
+	GetGoldenScenarioName( scenario, name );
+	if ( ! finished )
+	{
+		SDL_LockMutex( shared.Lock );
+		printf( "%s didn't finish within %u frames\n", name, script.MaxFrames );
+		SDL_UnlockMutex( shared.Lock );
+	}
+
+	// Golden went on for longer?
+	if ( matched && golden && golden->size( ) != results.size( ) )
+	{
+		SDL_LockMutex( shared.Lock );
+		printf( "%s ends at frame %u, golden has %u checkpoints to our %u\n", name, state.Frame, ( Uint32 )golden->size( ), ( Uint32 )results.size( ) );
+		SDL_UnlockMutex( shared.Lock );
+		matched = false;
+	}
+	return matched;
+}
+
+static int SDLCALL GoldenThread( void * userData )
+{
+	GoldenJob & shared = *( GoldenJob * )userData;
+	Cpu8080 * chip8 = new Cpu8080;
+
+	for ( ; ; )
+	{
+		SDL_LockMutex( shared.Lock );
+		size_t scenario = shared.NextScenario++;
+		SDL_UnlockMutex( shared.Lock );
+
+		if ( scenario >= shared.Results->size( ) )
+			break;
+
+		bool finished = false;
+		const bool missing = shared.Golden && ( *shared.Golden )[ scenario ].empty( );
+		const bool matched = RunScenario( shared, scenario, *chip8, finished );
+
+		SDL_LockMutex( shared.Lock );
+		shared.Report->Checkpoints += ( Uint32 )( *shared.Results )[ scenario ].size( );
+		shared.Report->Mismatched += matched ? 0 : 1;
+		shared.Report->Missing += missing ? 1 : 0;
+		shared.Report->Unfinished += finished ? 0 : 1;
+		SDL_UnlockMutex( shared.Lock );
+	}
+
+	delete chip8;
+	return 0;
+}
+
+bool RunGoldenScenarios( const Cpu8080 & reset, const GoldenHashes * golden, Uint32 threads, GoldenHashes & results, GoldenReport & report )
+{
+	memset( &report, 0, sizeof( report ) );
+	report.Scenarios = ( Uint32 )GetNumGoldenScenarios( );
+
+	results.clear( );
+	results.resize( GetNumGoldenScenarios( ) );
+
+	// Most scenarios start from the same point of a one player game.
+	Cpu8080 * gameStart = new Cpu8080( reset );
+	StartOnePlayerGame( *gameStart, NULL );
+
+	GoldenJob shared;
+	shared.Reset = &reset;
+	shared.GameStart = gameStart;
+	shared.Golden = golden;
+	shared.Results = &results;
+	shared.Lock = SDL_CreateMutex( );
+	shared.NextScenario = 0;
+	shared.Report = &report;
+
+	std::vector< SDL_Thread * > workers( std::max( threads, 1u ) );
+	for ( size_t ix = 0; ix < workers.size( ); ++ix )
+	{
+		workers[ ix ] = SDL_CreateThread( GoldenThread, &shared );
+	}
+	for ( size_t ix = 0; ix < workers.size( ); ++ix )
+	{
+		SDL_WaitThread( workers[ ix ], NULL );
+	}
+
+	SDL_DestroyMutex( shared.Lock );
+	delete gameStart;
+
+	return report.Mismatched == 0 && report.Missing == 0;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+
+#include "Cpu8080.h"
+#include "Movie.h"
+
+// ------------------------------------------------------------
+// Golden frame regression suite.
+//
+// A catalogue of scripted scenarios (attract mode, starting a game, losing
+// a life, shooting the saucer, clearing a wave, and a couple of hundred
+// games of seeded random inputs) run headless on a pool of SDL threads.
+// Scripts read the game's RAM (see RamProbe.h) to decide their inputs, so
+// each one gets to what it is named after. Every kGoldenCheckInterval frames
+// and at the end the VRAM and the work RAM are hashed and compared against
+// golden hashes saved by a known good build. The first frame of a scenario
+// that differs is saved as a bitmap, so a change to the CPU core can be
+// checked on every build in a few seconds.
+// ------------------------------------------------------------
+
+static const Uint32 kGoldenCheckInterval = 30;
+
+struct GoldenCheckpoint
+{
+	Uint32	Frame;			// Since the scenario started.
+	Uint32	VramHash;		// HashBytes of 0x2400-0x3fff.
+	Uint32	RamHash;		// HashBytes of 0x2000-0x23ff.
+};
+
+// One list of checkpoints per scenario, in catalogue order.
+typedef std::vector< std::vector< GoldenCheckpoint > > GoldenHashes;
+
+size_t GetNumGoldenScenarios( );
+
+// Writes the scenario's name (at most 32 characters with the terminator).
+void GetGoldenScenarioName( size_t scenario, char * name );
+
+// Options (kMovieFlag...) a file without a flags line was made with.
+static const Uint32 kGoldenDefaultFlags = kMovieFlagHle | kMovieFlagIdleSkip;
+
+// Text, a line per checkpoint after the options (kMovieFlag...) the hashes were made with, which they must be checked
+// with too. Scenarios missing from the file are left empty.
+bool LoadGoldenHashes( const char * file, GoldenHashes & hashes, Uint32 & flags );
+bool SaveGoldenHashes( const char * file, const GoldenHashes & hashes, Uint32 flags );
+
+struct GoldenReport
+{
+	Uint32	Scenarios;
+	Uint32	Checkpoints;
+	Uint32	Mismatched;		// Scenarios with a checkpoint that differed from golden (or a different number of them).
+	Uint32	Missing;		// Scenarios golden has nothing for.
+	Uint32	Unfinished;		// Scripts that never saw what they were after (golden would be of the wrong thing).
+};
+
+// Runs every scenario from reset (the machine as it powers up, with the ROM and HLE set up) on up to threads
+// threads, filling results. If golden is not NULL each scenario is compared as it runs, printing the first
+// checkpoint that differs and saving that frame as <name>_<frame>.bmp. Returns true if everything matched.
+bool RunGoldenScenarios( const Cpu8080 & reset, const GoldenHashes * golden, Uint32 threads, GoldenHashes & results, GoldenReport & report );
@@ -0,0 +1,420 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "Hle.h"
+
+typedef Cpu8080::CommandProcessingUnit::Registers Registers;
+
+HleRoutine g_HleRoutines[ 0x2000 ];
+bool g_HleVerify = false;
+
+// Same addressing as the interpreter.
+static inline Uint8 Memory8( const Cpu8080 & chip8, Uint16 addr )
+{
+	return chip8.Memory[ CheckAddress( addr ) ];
+}
+
+static inline void SetMemory8( Cpu8080 & chip8, Uint16 addr, Uint8 value )
+{
+	chip8.Memory.Write8( CheckAddress( addr ), value );
+}
+
+// The word offset bytes below the stack pointer (where PUSH writes and POP reads back).
+static inline Uint16 Stack16( const Cpu8080 & chip8, Uint16 offset )
+{
+	return chip8.Memory.Read16( CheckAddress( chip8.Cpu.Regs.sp - offset ) );
+}
+
+static inline void SetStack16( Cpu8080 & chip8, Uint16 offset, Uint16 value )
+{
+	chip8.Memory.Write16( CheckAddress( chip8.Cpu.Regs.sp - offset ), value );
+}
+
+// Flags as left by DCR.
+static inline void SetDecrementFlags( Registers::Flags & flags, Uint8 v )
+{
+	flags.z = v == 0;
+	flags.s = v >> 7;
+	flags.p = ParityTable256[ v ];
+	flags.ac = ( v & 0xf ) != 0xf;
+}
+
+// LXI B, 0x20 / DAD B.
+static inline void AddRowToHl( Registers & regs )
+{
+	Uint32 r = regs.gprPair[ Registers::GprPair::HL ] + 0x20;
+	regs.gprPair[ Registers::GprPair::HL ] = ( Uint16 )r;
+	regs.flags.cy = r > 0xffff;
+}
+
+// RET, if the budget allows.
+static inline Uint32 Return( Cpu8080 & chip8, Uint32 budget )
+{
+	if ( budget == 0 )
+		return 0;
+
+	chip8.Cpu.Regs.pc = CheckProgramCounter( chip8.Memory.Read16( CheckAddress( chip8.Cpu.Regs.sp ) ) );
+	chip8.Cpu.Regs.sp += 2;
+	return 1;
+}
+
+// Leaves pc at the top of the loop, or at the RET (returning, budget allowing) once the loop has finished.
+static inline Uint32 EndLoop( Cpu8080 & chip8, Uint32 instructions, Uint32 budget, bool finished, address loopPc, address retPc )
+{
+	if ( ! finished )
+	{
+		chip8.Cpu.Regs.pc = loopPc;
+		return instructions;
+	}
+
+	chip8.Cpu.Regs.pc = retPc;
+	return instructions + Return( chip8, budget - instructions );
+}
+
+// ------------------------------------------------------------
+// Routines.
+// ------------------------------------------------------------
+
+static Uint32 DrawShiftedSprite( Cpu8080 & chip8, Uint32 budget )
+{
+	// 0x1405: PUSH B / PUSH H / LDAX D / OUT 4 / IN 3 / ORA M / MOV M, A / INX H / INX D /
+	//         XRA A / OUT 4 / IN 3 / ORA M / MOV M, A / POP H / LXI B, 0x20 / DAD B / POP B / DCR B / JNZ 0x1405 / RET
+	Registers & regs = chip8.Cpu.Regs;
+	Uint8 & b = regs.gpr[ RegIndex( Registers::Gpr::B ) ];
+	Uint16 & de = regs.gprPair[ Registers::GprPair::DE ];
+	Uint16 & hl = regs.gprPair[ Registers::GprPair::HL ];
+
+	Uint32 instructions = 0;
+	while ( budget - instructions >= 20 )
+	{
+		SetStack16( chip8, 2, regs.gprPair[ Registers::GprPair::BC ] );
+		SetStack16( chip8, 4, hl );
+
+		IoWrite( chip8, 4, Memory8( chip8, de ) );
+		regs.accumulator = IoRead( chip8, 3 ) | Memory8( chip8, hl );
+		SetMemory8( chip8, hl, regs.accumulator );
+		++hl;
+		++de;
+
+		IoWrite( chip8, 4, 0 );
+		regs.accumulator = IoRead( chip8, 3 ) | Memory8( chip8, hl );
+		SetMemory8( chip8, hl, regs.accumulator );
+
+		hl = Stack16( chip8, 4 );
+		AddRowToHl( regs );
+		regs.gprPair[ Registers::GprPair::BC ] = Stack16( chip8, 2 );
+		--b;
+
+		instructions += 20;
+		if ( b == 0 )
+			break;
+	}
+
+	if ( instructions == 0 )
+		return 0;
+
+	SetDecrementFlags( regs.flags, b );
+	return EndLoop( chip8, instructions, budget, b == 0, 0x1405, 0x1421 );
+}
+
+static Uint32 EraseSimpleSprite( Cpu8080 & chip8, Uint32 budget )
+{
+	// 0x1427: PUSH B / PUSH H / XRA A / MOV M, A / INX H / MOV M, A / INX H / POP H /
+	//         LXI B, 0x20 / DAD B / POP B / DCR B / JNZ 0x1427 / RET
+	Registers & regs = chip8.Cpu.Regs;
+	Uint8 & b = regs.gpr[ RegIndex( Registers::Gpr::B ) ];
+	Uint16 & hl = regs.gprPair[ Registers::GprPair::HL ];
+
+	Uint32 instructions = 0;
+	while ( budget - instructions >= 13 )
+	{
+		SetStack16( chip8, 2, regs.gprPair[ Registers::GprPair::BC ] );
+		SetStack16( chip8, 4, hl );
+
+		regs.accumulator = 0;
+		SetMemory8( chip8, hl, 0 );
+		++hl;
+		SetMemory8( chip8, hl, 0 );
+
+		hl = Stack16( chip8, 4 );
+		AddRowToHl( regs );
+		regs.gprPair[ Registers::GprPair::BC ] = Stack16( chip8, 2 );
+		--b;
+
+		instructions += 13;
+		if ( b == 0 )
+			break;
+	}
+
+	if ( instructions == 0 )
+		return 0;
+
+	SetDecrementFlags( regs.flags, b );
+	return EndLoop( chip8, instructions, budget, b == 0, 0x1427, 0x1438 );
+}
+
+static Uint32 DrawSimpleSprite( Cpu8080 & chip8, Uint32 budget )
+{
+	// 0x1439: PUSH B / LDAX D / MOV M, A / INX D / LXI B, 0x20 / DAD B / POP B / DCR B / JNZ 0x1439 / RET
+	Registers & regs = chip8.Cpu.Regs;
+	Uint8 & b = regs.gpr[ RegIndex( Registers::Gpr::B ) ];
+	Uint16 & de = regs.gprPair[ Registers::GprPair::DE ];
+	Uint16 & hl = regs.gprPair[ Registers::GprPair::HL ];
+
+	Uint32 instructions = 0;
+	while ( budget - instructions >= 9 )
+	{
+		SetStack16( chip8, 2, regs.gprPair[ Registers::GprPair::BC ] );
+
+		regs.accumulator = Memory8( chip8, de );
+		SetMemory8( chip8, hl, regs.accumulator );
+		++de;
+
+		AddRowToHl( regs );
+		regs.gprPair[ Registers::GprPair::BC ] = Stack16( chip8, 2 );
+		--b;
+
+		instructions += 9;
+		if ( b == 0 )
+			break;
+	}
+
+	if ( instructions == 0 )
+		return 0;
+
+	SetDecrementFlags( regs.flags, b );
+	return EndLoop( chip8, instructions, budget, b == 0, 0x1439, 0x1446 );
+}
+
+static Uint32 EraseShiftedSprite( Cpu8080 & chip8, Uint32 budget )
+{
+	// 0x1455: PUSH B / PUSH H / LDAX D / OUT 4 / IN 3 / CMA / ANA M / MOV M, A / INX H / INX D /
+	//         XRA A / OUT 4 / IN 3 / CMA / ANA M / MOV M, A / POP H / LXI B, 0x20 / DAD B / POP B / DCR B / JNZ 0x1455 / RET
+	Registers & regs = chip8.Cpu.Regs;
+	Uint8 & b = regs.gpr[ RegIndex( Registers::Gpr::B ) ];
+	Uint16 & de = regs.gprPair[ Registers::GprPair::DE ];
+	Uint16 & hl = regs.gprPair[ Registers::GprPair::HL ];
+
+	Uint32 instructions = 0;
+	while ( budget - instructions >= 22 )
+	{
+		SetStack16( chip8, 2, regs.gprPair[ Registers::GprPair::BC ] );
+		SetStack16( chip8, 4, hl );
+
+		IoWrite( chip8, 4, Memory8( chip8, de ) );
+		regs.accumulator = ~IoRead( chip8, 3 ) & Memory8( chip8, hl );
+		SetMemory8( chip8, hl, regs.accumulator );
+		++hl;
+		++de;
+
+		IoWrite( chip8, 4, 0 );
+		regs.accumulator = ~IoRead( chip8, 3 ) & Memory8( chip8, hl );
+		SetMemory8( chip8, hl, regs.accumulator );
+
+		hl = Stack16( chip8, 4 );
+		AddRowToHl( regs );
+		regs.gprPair[ Registers::GprPair::BC ] = Stack16( chip8, 2 );
+		--b;
+
+		instructions += 22;
+		if ( b == 0 )
+			break;
+	}
+
+	if ( instructions == 0 )
+		return 0;
+
+	SetDecrementFlags( regs.flags, b );
+	return EndLoop( chip8, instructions, budget, b == 0, 0x1455, 0x1473 );
+}
+
+static Uint32 ClearSmallSprite( Cpu8080 & chip8, Uint32 budget )
+{
+	// 0x14cc: PUSH B / MOV M, A / LXI B, 0x20 / DAD B / POP B / DCR B / JNZ 0x14cc / RET
+	Registers & regs = chip8.Cpu.Regs;
+	Uint8 & b = regs.gpr[ RegIndex( Registers::Gpr::B ) ];
+	Uint16 & hl = regs.gprPair[ Registers::GprPair::HL ];
+
+	Uint32 instructions = 0;
+	while ( budget - instructions >= 7 )
+	{
+		SetStack16( chip8, 2, regs.gprPair[ Registers::GprPair::BC ] );
+
+		SetMemory8( chip8, hl, regs.accumulator );
+
+		AddRowToHl( regs );
+		regs.gprPair[ Registers::GprPair::BC ] = Stack16( chip8, 2 );
+		--b;
+
+		instructions += 7;
+		if ( b == 0 )
+			break;
+	}
+
+	if ( instructions == 0 )
+		return 0;
+
+	SetDecrementFlags( regs.flags, b );
+	return EndLoop( chip8, instructions, budget, b == 0, 0x14cc, 0x14d7 );
+}
+
+static Uint32 BlockCopy( Cpu8080 & chip8, Uint32 budget )
+{
+	// 0x1a32: LDAX D / MOV M, A / INX H / INX D / DCR B / JNZ 0x1a32 / RET
+	Registers & regs = chip8.Cpu.Regs;
+	Uint8 & b = regs.gpr[ RegIndex( Registers::Gpr::B ) ];
+	Uint16 & de = regs.gprPair[ Registers::GprPair::DE ];
+	Uint16 & hl = regs.gprPair[ Registers::GprPair::HL ];
+
+	Uint32 instructions = 0;
+	while ( budget - instructions >= 6 )
+	{
+		regs.accumulator = Memory8( chip8, de );
+		SetMemory8( chip8, hl, regs.accumulator );
+		++hl;
+		++de;
+		--b;
+
+		instructions += 6;
+		if ( b == 0 )
+			break;
+	}
+
+	if ( instructions == 0 )
+		return 0;
+
+	SetDecrementFlags( regs.flags, b );
+	return EndLoop( chip8, instructions, budget, b == 0, 0x1a32, 0x1a3a );
+}
+
+static Uint32 ClearScreen( Cpu8080 & chip8, Uint32 budget )
+{
+	// 0x1a5f: MVI M, 0 / INX H / MOV A, H / CPI 0x40 / JNZ 0x1a5f / RET
+	Registers & regs = chip8.Cpu.Regs;
+	Uint16 & hl = regs.gprPair[ Registers::GprPair::HL ];
+
+	Uint32 instructions = 0;
+	bool finished = false;
+	while ( budget - instructions >= 5 )
+	{
+		SetMemory8( chip8, hl, 0 );
+		++hl;
+		regs.accumulator = regs.gpr[ RegIndex( Registers::Gpr::H ) ];
+
+		instructions += 5;
+		finished = regs.accumulator == 0x40;
+		if ( finished )
+			break;
+	}
+
+	if ( instructions == 0 )
+		return 0;
+
+	// Flags as left by CPI 0x40.
+	Uint8 r = regs.accumulator - 0x40;
+	regs.flags.z = r == 0;
+	regs.flags.s = r >> 7;
+	regs.flags.p = ParityTable256[ r ];
+	regs.flags.cy = regs.accumulator < 0x40 ? 1 : 0;
+	regs.flags.ac = 1;	// Nothing is borrowed from the low nibble of 0x40.
+
+	return EndLoop( chip8, instructions, budget, finished, 0x1a5f, 0x1a68 );
+}
+
+struct HleRoutineEntry
+{
+	address		Pc;
+	Uint8		Signature[ 4 ];		// First bytes of the ROM code replaced, so we don't patch a different ROM.
+	HleRoutine	Routine;
+};
+
+static const HleRoutineEntry kInvadersRoutines[ ] =
+{
+	{ 0x1405, { 0xc5, 0xe5, 0x1a, 0xd3 }, DrawShiftedSprite },
+	{ 0x1427, { 0xc5, 0xe5, 0xaf, 0x77 }, EraseSimpleSprite },
+	{ 0x1439, { 0xc5, 0x1a, 0x77, 0x13 }, DrawSimpleSprite },
+	{ 0x1455, { 0xc5, 0xe5, 0x1a, 0xd3 }, EraseShiftedSprite },
+	{ 0x14cc, { 0xc5, 0x77, 0x01, 0x20 }, ClearSmallSprite },
+	{ 0x1a32, { 0x1a, 0x77, 0x23, 0x13 }, BlockCopy },
+	{ 0x1a5f, { 0x36, 0x00, 0x23, 0x7c }, ClearScreen },
+};
+
+void InstallHleRoutines( const Uint8 * rom )
+{
+	for ( size_t ix = 0; ix < sizeof( kInvadersRoutines ) / sizeof( kInvadersRoutines[ 0 ] ); ++ix )
+	{
+		const HleRoutineEntry & entry = kInvadersRoutines[ ix ];
+		if ( memcmp( &rom[ entry.Pc ], entry.Signature, sizeof( entry.Signature ) ) == 0 )
+		{
+			g_HleRoutines[ entry.Pc ] = entry.Routine;
+		}
+	}
+}
+
+void RemoveHleRoutines( )
+{
+	memset( g_HleRoutines, 0, sizeof( g_HleRoutines ) );
+}
+
+Uint32 RunHleRoutine( Cpu8080 & chip8, HleRoutine routine )
+{
+	// Nothing may straddle an interrupt being raised (StepCpu doesn't come here straight after EI).
+	const Uint32 limit = kInstructionsBeforeInterrupt[ chip8.NextInterrupt ];
+	if ( chip8.InstructionsSinceInterrupt >= limit )
+		return 0;
+
+	const Uint32 budget = limit - chip8.InstructionsSinceInterrupt;
+
+	if ( ! g_HleVerify )
+	{
+		return routine( chip8, budget );
+	}
+
+	// Run the interpreter over a copy of the machine for the same number of instructions and compare.
+	Cpu8080 reference = chip8;
+	reference.HleEnabled = false;
+
+	const address pc = chip8.Cpu.Regs.pc;
+	const Uint32 instructions = routine( chip8, budget );
+
+	for ( Uint32 ix = 0; ix < instructions; ++ix )
+	{
+		StepCpu( reference );
+	}
+
+	bool regsMatch = memcmp( &reference.Cpu.Regs, &chip8.Cpu.Regs, sizeof( chip8.Cpu.Regs ) ) == 0;
+	bool busMatch = memcmp( &reference.Io, &chip8.Io, sizeof( chip8.Io ) ) == 0;
+	bool clockMatch = reference.InstructionsSinceInterrupt == chip8.InstructionsSinceInterrupt + instructions;
+
+	// Only look for the differing byte if the hashes say there is one.
+	int memoryMismatch = -1;
+	for ( size_t ix = 0x2000; ix < 0x4000 && reference.Memory.Hash != chip8.Memory.Hash; ++ix )
+	{
+		if ( reference.Memory[ ix ] != chip8.Memory[ ix ] )
+		{
+			memoryMismatch = ( int )ix;
+			break;
+		}
+	}
+
+	if ( ! regsMatch || ! busMatch || ! clockMatch || memoryMismatch >= 0 )
+	{
+		printf( "HLE routine at 0x%04x disagrees with the interpreter (%u instructions)\n", pc, instructions );
+		printf( "  expected pc %04x sp %04x a %02x f %02x bc %04x de %04x hl %04x\n", reference.Cpu.Regs.pc, reference.Cpu.Regs.sp, reference.Cpu.Regs.accumulator, reference.Cpu.Regs.flags.u8,
+			reference.Cpu.Regs.gprPair[ Registers::GprPair::BC ], reference.Cpu.Regs.gprPair[ Registers::GprPair::DE ], reference.Cpu.Regs.gprPair[ Registers::GprPair::HL ] );
+		printf( "  actual   pc %04x sp %04x a %02x f %02x bc %04x de %04x hl %04x\n", chip8.Cpu.Regs.pc, chip8.Cpu.Regs.sp, chip8.Cpu.Regs.accumulator, chip8.Cpu.Regs.flags.u8,
+			chip8.Cpu.Regs.gprPair[ Registers::GprPair::BC ], chip8.Cpu.Regs.gprPair[ Registers::GprPair::DE ], chip8.Cpu.Regs.gprPair[ Registers::GprPair::HL ] );
+		if ( memoryMismatch >= 0 )
+		{
+			printf( "  memory differs at 0x%04x: expected %02x actual %02x\n", memoryMismatch, reference.Memory[ memoryMismatch ], chip8.Memory[ memoryMismatch ] );
+		}
+		if ( ! clockMatch )
+		{
+			printf( "  instruction count differs: expected %u actual %u\n", reference.InstructionsSinceInterrupt, chip8.InstructionsSinceInterrupt + instructions );
+		}
+		assert( 0 );
+	}
+
+	return instructions;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Cpu8080.h"
+
+// ------------------------------------------------------------
+// High level emulation of hot ROM routines.
+//
+// A routine is keyed by the ROM address it starts at and checked for when
+// StepCpu fetches from that address. It must leave memory, registers, flags
+// and I/O exactly as the interpreter would have. It is given a budget (the
+// instructions left before the next interrupt is raised) and may stop part
+// way through, provided it stops on an instruction boundary the interpreter
+// could have stopped at.
+// ------------------------------------------------------------
+
+// Returns the number of instructions stood in for (0 declines, the interpreter carries on).
+typedef Uint32 ( * HleRoutine )( Cpu8080 & chip8, Uint32 budget );
+
+// Routine (if any) replacing the code at each ROM address.
+extern HleRoutine g_HleRoutines[ 0x2000 ];
+
+// Run the interpreter alongside every routine and assert they agree.
+extern bool g_HleVerify;
+
+// Install/remove the invaders ROM routines (only those whose code matches the given ROM).
+void InstallHleRoutines( const Uint8 * rom );
+void RemoveHleRoutines( );
+
+// Runs a routine with the right budget (verifying it if asked to), see HleRoutine.
+Uint32 RunHleRoutine( Cpu8080 & chip8, HleRoutine routine );
@@ -0,0 +1,11191 @@
+// Generated by 8080Emulator -aot from the invaders ROM (see Aot.h), don't edit.
+// 770 blocks of 2277 instructions found, 1 indirect jump sites.
+
+#include "Aot.h"
+
+// 4 of 4 instructions, jumps.
+static void Block_0000( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0000 nop
+	// 0001 nop
+	// 0002 nop
+	// 0003 jmp L18D4
+	regs.pc = 0x18d4;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, jumps.
+static void Block_0008( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0008 push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 0009 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 000A push d
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 000B push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 000C jmp L008C
+	regs.pc = 0x008c;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 9 of 9 instructions, calls.
+static void Block_0010( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0010 push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 0011 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 0012 push d
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 0013 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0014 mvi a,080H
+	regs.accumulator = 0x80;
+	// 0016 sta 02072H
+	AotWrite8( chip8, 0x2072, regs.accumulator );
+	// 0019 lxi h,020C0H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20c0;
+	// 001C dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 001D call L17CD
+	AotPush16( chip8, 0x0020 );
+	regs.pc = 0x17cd;
+	chip8.InstructionsSinceInterrupt += 9;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0020( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0020 in 001H
+	regs.accumulator = IoRead( chip8, 0x01 );
+	// 0022 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0023 jc L0067
+	regs.pc = regs.flags.cy ? 0x0067 : 0x0026;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0026( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0026 lda 020EAH
+	regs.accumulator = AotRead8( chip8, 0x20ea );
+	// 0029 ana a
+	AluAnd( regs, regs.accumulator );
+	// 002A jz L0042
+	regs.pc = regs.flags.z ? 0x0042 : 0x002d;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_002D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 002D lda 020EBH
+	regs.accumulator = AotRead8( chip8, 0x20eb );
+	// 0030 cpi 099H
+	AluSubtract( regs, 0x99, 0 );
+	// 0032 jz L003E
+	regs.pc = regs.flags.z ? 0x003e : 0x0035;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_0035( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0035 adi 001H
+	AluAdd( regs, 0x01, 0 );
+	// 0037 daa
+	AluDecimalAdjust( regs );
+	// 0038 sta 020EBH
+	AotWrite8( chip8, 0x20eb, regs.accumulator );
+	// 003B call L1947
+	AotPush16( chip8, 0x003e );
+	regs.pc = 0x1947;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_003E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 003E xra a
+	AluXor( regs, regs.accumulator );
+	regs.pc = 0x003f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_003F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 003F sta 020EAH
+	AotWrite8( chip8, 0x20ea, regs.accumulator );
+	regs.pc = 0x0042;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0042( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0042 lda 020E9H
+	regs.accumulator = AotRead8( chip8, 0x20e9 );
+	// 0045 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0046 jz L0082
+	regs.pc = regs.flags.z ? 0x0082 : 0x0049;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0049( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0049 lda 020EFH
+	regs.accumulator = AotRead8( chip8, 0x20ef );
+	// 004C ana a
+	AluAnd( regs, regs.accumulator );
+	// 004D jnz L006F
+	regs.pc = ! regs.flags.z ? 0x006f : 0x0050;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0050( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0050 lda 020EBH
+	regs.accumulator = AotRead8( chip8, 0x20eb );
+	// 0053 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0054 jnz L005D
+	regs.pc = ! regs.flags.z ? 0x005d : 0x0057;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0057( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0057 call L0ABF
+	AotPush16( chip8, 0x005a );
+	regs.pc = 0x0abf;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_005A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 005A jmp L0082
+	regs.pc = 0x0082;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_005D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 005D lda 02093H
+	regs.accumulator = AotRead8( chip8, 0x2093 );
+	// 0060 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0061 jnz L0082
+	regs.pc = ! regs.flags.z ? 0x0082 : 0x0064;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0064( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0064 jmp L0765
+	regs.pc = 0x0765;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_0067( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0067 mvi a,001H
+	regs.accumulator = 0x01;
+	// 0069 sta 020EAH
+	AotWrite8( chip8, 0x20ea, regs.accumulator );
+	// 006C jmp L003F
+	regs.pc = 0x003f;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_006F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 006F call L1740
+	AotPush16( chip8, 0x0072 );
+	regs.pc = 0x1740;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0072( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0072 lda 02032H
+	regs.accumulator = AotRead8( chip8, 0x2032 );
+	// 0075 sta 02080H
+	AotWrite8( chip8, 0x2080, regs.accumulator );
+	// 0078 call L0100
+	AotPush16( chip8, 0x007b );
+	regs.pc = 0x0100;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_007B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 007B call L0248
+	AotPush16( chip8, 0x007e );
+	regs.pc = 0x0248;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_007E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 007E call L0913
+	AotPush16( chip8, 0x0081 );
+	regs.pc = 0x0913;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_0081( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0081 nop
+	regs.pc = 0x0082;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 6 instructions, stops for the interpreter.
+static void Block_0082( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0082 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 0083 pop d
+	regs.gprPair[ AotRegisters::GprPair::DE ] = AotPop16( chip8 );
+	// 0084 pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 0085 pop psw
+	regs.flags.u8 = AotRead8( chip8, regs.sp );
+	regs.accumulator = AotRead8( chip8, regs.sp + 1 );
+	regs.sp += 2;
+	regs.pc = 0x0086;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_008C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 008C xra a
+	AluXor( regs, regs.accumulator );
+	// 008D sta 02072H
+	AotWrite8( chip8, 0x2072, regs.accumulator );
+	// 0090 lda 020E9H
+	regs.accumulator = AotRead8( chip8, 0x20e9 );
+	// 0093 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0094 jz L0082
+	regs.pc = regs.flags.z ? 0x0082 : 0x0097;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0097( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0097 lda 020EFH
+	regs.accumulator = AotRead8( chip8, 0x20ef );
+	// 009A ana a
+	AluAnd( regs, regs.accumulator );
+	// 009B jnz L00A5
+	regs.pc = ! regs.flags.z ? 0x00a5 : 0x009e;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_009E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 009E lda 020C1H
+	regs.accumulator = AotRead8( chip8, 0x20c1 );
+	// 00A1 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 00A2 jnc L0082
+	regs.pc = ! regs.flags.cy ? 0x0082 : 0x00a5;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_00A5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00A5 lxi h,02020H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2020;
+	// 00A8 call L024B
+	AotPush16( chip8, 0x00ab );
+	regs.pc = 0x024b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_00AB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00AB call L0141
+	AotPush16( chip8, 0x00ae );
+	regs.pc = 0x0141;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_00AE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00AE jmp L0082
+	regs.pc = 0x0082;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_00B1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00B1 call L0886
+	AotPush16( chip8, 0x00b4 );
+	regs.pc = 0x0886;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 12 of 12 instructions, branches.
+static void Block_00B4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00B4 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 00B5 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 00B6 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 00B7 mov h,m
+	regs.gpr[ 5 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 00B8 mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 00B9 shld 02009H
+	AotWrite16( chip8, 0x2009, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 00BC shld 0200BH
+	AotWrite16( chip8, 0x200b, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 00BF pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 00C0 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 00C1 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 00C2 cpi 003H
+	AluSubtract( regs, 0x03, 0 );
+	// 00C4 jnz L00C8
+	regs.pc = ! regs.flags.z ? 0x00c8 : 0x00c7;
+	chip8.InstructionsSinceInterrupt += 12;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_00C7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00C7 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	regs.pc = 0x00c8;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_00C8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00C8 sta 02008H
+	AotWrite8( chip8, 0x2008, regs.accumulator );
+	// 00CB cpi 0FEH
+	AluSubtract( regs, 0xfe, 0 );
+	// 00CD mvi a,000H
+	regs.accumulator = 0x00;
+	// 00CF jnz L00D3
+	regs.pc = ! regs.flags.z ? 0x00d3 : 0x00d2;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_00D2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00D2 inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	regs.pc = 0x00d3;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_00D3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00D3 sta 0200DH
+	AotWrite8( chip8, 0x200d, regs.accumulator );
+	// 00D6 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_00D7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 00D7 mvi a,002H
+	regs.accumulator = 0x02;
+	// 00D9 sta 021FBH
+	AotWrite8( chip8, 0x21fb, regs.accumulator );
+	// 00DC sta 022FBH
+	AotWrite8( chip8, 0x22fb, regs.accumulator );
+	// 00DF jmp L08E4
+	regs.pc = 0x08e4;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0100( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0100 lxi h,02002H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2002;
+	// 0103 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0104 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0105 jnz L1538
+	regs.pc = ! regs.flags.z ? 0x1538 : 0x0108;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 9 of 9 instructions, branches.
+static void Block_0108( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0108 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0109 lda 02006H
+	regs.accumulator = AotRead8( chip8, 0x2006 );
+	// 010C mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 010D lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 0110 mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 0111 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0112 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0113 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 0114 jz L0136
+	regs.pc = regs.flags.z ? 0x0136 : 0x0117;
+	chip8.InstructionsSinceInterrupt += 9;
+}
+
+// 17 of 17 instructions, calls.
+static void Block_0117( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0117 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0118 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0119 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 011A inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 011B mov b,m
+	regs.gpr[ 1 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 011C ani 0FEH
+	AluAnd( regs, 0xfe );
+	// 011E rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 011F rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 0120 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 0121 mov e,a
+	regs.gpr[ 2 ] = regs.accumulator;
+	// 0122 mvi d,000H
+	regs.gpr[ 3 ] = 0x00;
+	// 0124 lxi h,01C00H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x1c00;
+	// 0127 dad d
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 0128 xchg
+	{
+		const Uint16 de = regs.gprPair[ AotRegisters::GprPair::DE ];
+		regs.gprPair[ AotRegisters::GprPair::DE ] = regs.gprPair[ AotRegisters::GprPair::HL ];
+		regs.gprPair[ AotRegisters::GprPair::HL ] = de;
+	}
+	// 0129 mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 012A ana a
+	AluAnd( regs, regs.accumulator );
+	// 012B cnz L013B
+	if ( ! regs.flags.z )
+	{
+		AotPush16( chip8, 0x012e );
+		regs.pc = 0x013b;
+	}
+	else
+	{
+		regs.pc = 0x012e;
+	}
+	chip8.InstructionsSinceInterrupt += 17;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_012E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 012E lhld 0200BH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x200b );
+	// 0131 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 0133 call L15D3
+	AotPush16( chip8, 0x0136 );
+	regs.pc = 0x15d3;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_0136( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0136 xra a
+	AluXor( regs, regs.accumulator );
+	// 0137 sta 02000H
+	AotWrite8( chip8, 0x2000, regs.accumulator );
+	// 013A ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, returns.
+static void Block_013B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 013B lxi h,00030H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x0030;
+	// 013E dad d
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 013F xchg
+	{
+		const Uint16 de = regs.gprPair[ AotRegisters::GprPair::DE ];
+		regs.gprPair[ AotRegisters::GprPair::DE ] = regs.gprPair[ AotRegisters::GprPair::HL ];
+		regs.gprPair[ AotRegisters::GprPair::HL ] = de;
+	}
+	// 0140 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_0141( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0141 lda 02068H
+	regs.accumulator = AotRead8( chip8, 0x2068 );
+	// 0144 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0145 rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x0146;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_0146( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0146 lda 02000H
+	regs.accumulator = AotRead8( chip8, 0x2000 );
+	// 0149 ana a
+	AluAnd( regs, regs.accumulator );
+	// 014A rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x014b;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, falls through.
+static void Block_014B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 014B lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 014E mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 014F lda 02006H
+	regs.accumulator = AotRead8( chip8, 0x2006 );
+	// 0152 mvi d,002H
+	regs.gpr[ 3 ] = 0x02;
+	regs.pc = 0x0154;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0154( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0154 inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 0155 cpi 037H
+	AluSubtract( regs, 0x37, 0 );
+	// 0157 cz L01A1
+	if ( regs.flags.z )
+	{
+		AotPush16( chip8, 0x015a );
+		regs.pc = 0x01a1;
+	}
+	else
+	{
+		regs.pc = 0x015a;
+	}
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_015A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 015A mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 015B mov b,m
+	regs.gpr[ 1 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 015C dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 015D jnz L0154
+	regs.pc = ! regs.flags.z ? 0x0154 : 0x0160;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0160( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0160 sta 02006H
+	AotWrite8( chip8, 0x2006, regs.accumulator );
+	// 0163 call L017A
+	AotPush16( chip8, 0x0166 );
+	regs.pc = 0x017a;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_0166( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0166 mov h,c
+	regs.gpr[ 5 ] = regs.gpr[ 0 ];
+	// 0167 shld 0200BH
+	AotWrite16( chip8, 0x200b, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 016A mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 016B cpi 028H
+	AluSubtract( regs, 0x28, 0 );
+	// 016D jc L1971
+	regs.pc = regs.flags.cy ? 0x1971 : 0x0170;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 5 of 5 instructions, returns.
+static void Block_0170( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0170 mov a,d
+	regs.accumulator = regs.gpr[ 3 ];
+	// 0171 sta 02004H
+	AotWrite8( chip8, 0x2004, regs.accumulator );
+	// 0174 mvi a,001H
+	regs.accumulator = 0x01;
+	// 0176 sta 02000H
+	AotWrite8( chip8, 0x2000, regs.accumulator );
+	// 0179 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 6 of 6 instructions, falls through.
+static void Block_017A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 017A mvi d,000H
+	regs.gpr[ 3 ] = 0x00;
+	// 017C mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 017D lxi h,02009H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2009;
+	// 0180 mov b,m
+	regs.gpr[ 1 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0181 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0182 mov c,m
+	regs.gpr[ 0 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	regs.pc = 0x0183;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_0183( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0183 cpi 00BH
+	AluSubtract( regs, 0x0b, 0 );
+	// 0185 jm L0194
+	regs.pc = regs.flags.s ? 0x0194 : 0x0188;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 8 of 8 instructions, jumps.
+static void Block_0188( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0188 sbi 00BH
+	regs.accumulator = AluSubtract( regs, 0x0b, regs.flags.cy );
+	// 018A mov e,a
+	regs.gpr[ 2 ] = regs.accumulator;
+	// 018B mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 018C adi 010H
+	AluAdd( regs, 0x10, 0 );
+	// 018E mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 018F mov a,e
+	regs.accumulator = regs.gpr[ 2 ];
+	// 0190 inr d
+	regs.gpr[ 3 ] = AluIncrement( regs, regs.gpr[ 3 ] );
+	// 0191 jmp L0183
+	regs.pc = 0x0183;
+	chip8.InstructionsSinceInterrupt += 8;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_0194( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0194 mov l,b
+	regs.gpr[ 4 ] = regs.gpr[ 1 ];
+	regs.pc = 0x0195;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_0195( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0195 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0196 rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x0197;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 7 of 7 instructions, jumps.
+static void Block_0197( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0197 mov e,a
+	regs.gpr[ 2 ] = regs.accumulator;
+	// 0198 mov a,c
+	regs.accumulator = regs.gpr[ 0 ];
+	// 0199 adi 010H
+	AluAdd( regs, 0x10, 0 );
+	// 019B mov c,a
+	regs.gpr[ 0 ] = regs.accumulator;
+	// 019C mov a,e
+	regs.accumulator = regs.gpr[ 2 ];
+	// 019D dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 019E jmp L0195
+	regs.pc = 0x0195;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_01A1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01A1 dcr d
+	regs.gpr[ 3 ] = AluDecrement( regs, regs.gpr[ 3 ] );
+	// 01A2 jz L01CD
+	regs.pc = regs.flags.z ? 0x01cd : 0x01a5;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 6 of 6 instructions, calls.
+static void Block_01A5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01A5 lxi h,02006H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2006;
+	// 01A8 mvi m,000H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x00 );
+	// 01AA inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 01AB mov c,m
+	regs.gpr[ 0 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 01AC mvi m,000H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x00 );
+	// 01AE call L01D9
+	AotPush16( chip8, 0x01b1 );
+	regs.pc = 0x01d9;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 9 of 9 instructions, returns.
+static void Block_01B1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01B1 lxi h,02005H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2005;
+	// 01B4 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 01B5 inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 01B6 ani 001H
+	AluAnd( regs, 0x01 );
+	// 01B8 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 01B9 xra a
+	AluXor( regs, regs.accumulator );
+	// 01BA lxi h,02067H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2067;
+	// 01BD mov h,m
+	regs.gpr[ 5 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 01BE ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 9;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_01C0( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01C0 lxi h,02100H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2100;
+	regs.pc = 0x01c3;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_01C3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01C3 mvi b,037H
+	regs.gpr[ 1 ] = 0x37;
+	regs.pc = 0x01c5;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_01C5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01C5 mvi m,001H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x01 );
+	// 01C7 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 01C8 dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 01C9 jnz L01C5
+	regs.pc = ! regs.flags.z ? 0x01c5 : 0x01cc;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_01CC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01CC ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_01CD( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01CD pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 01CE ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_01CF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01CF mvi a,001H
+	regs.accumulator = 0x01;
+	// 01D1 mvi b,0E0H
+	regs.gpr[ 1 ] = 0xe0;
+	// 01D3 lxi h,02402H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2402;
+	// 01D6 jmp L14CC
+	regs.pc = 0x14cc;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 11 of 11 instructions, returns.
+static void Block_01D9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01D9 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 01DA mov b,m
+	regs.gpr[ 1 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 01DB inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 01DC mov a,c
+	regs.accumulator = regs.gpr[ 0 ];
+	// 01DD add m
+	AluAdd( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ), 0 );
+	// 01DE mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 01DF inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 01E0 mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 01E1 add m
+	AluAdd( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ), 0 );
+	// 01E2 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 01E3 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 11;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_01E4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01E4 mvi b,0C0H
+	regs.gpr[ 1 ] = 0xc0;
+	regs.pc = 0x01e6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_01E6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01E6 lxi d,01B00H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1b00;
+	// 01E9 lxi h,02000H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2000;
+	// 01EC jmp L1A32
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_01EF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01EF lxi h,02142H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2142;
+	// 01F2 jmp L01F8
+	regs.pc = 0x01f8;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_01F5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01F5 lxi h,02242H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2242;
+	regs.pc = 0x01f8;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_01F8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01F8 mvi c,004H
+	regs.gpr[ 0 ] = 0x04;
+	// 01FA lxi d,01D20H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1d20;
+	regs.pc = 0x01fd;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_01FD( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 01FD push d
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 01FE mvi b,02CH
+	regs.gpr[ 1 ] = 0x2c;
+	// 0200 call L1A32
+	AotPush16( chip8, 0x0203 );
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0203( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0203 pop d
+	regs.gprPair[ AotRegisters::GprPair::DE ] = AotPop16( chip8 );
+	// 0204 dcr c
+	regs.gpr[ 0 ] = AluDecrement( regs, regs.gpr[ 0 ] );
+	// 0205 jnz L01FD
+	regs.pc = ! regs.flags.z ? 0x01fd : 0x0208;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_0208( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0208 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_0209( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0209 mvi a,001H
+	regs.accumulator = 0x01;
+	// 020B jmp L021B
+	regs.pc = 0x021b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_020E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 020E mvi a,001H
+	regs.accumulator = 0x01;
+	// 0210 jmp L0214
+	regs.pc = 0x0214;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_0213( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0213 xra a
+	AluXor( regs, regs.accumulator );
+	regs.pc = 0x0214;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_0214( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0214 lxi d,02242H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x2242;
+	// 0217 jmp L021E
+	regs.pc = 0x021e;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_021A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 021A xra a
+	AluXor( regs, regs.accumulator );
+	regs.pc = 0x021b;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_021B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 021B lxi d,02142H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x2142;
+	regs.pc = 0x021e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, falls through.
+static void Block_021E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 021E sta 02081H
+	AotWrite8( chip8, 0x2081, regs.accumulator );
+	// 0221 lxi b,01602H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x1602;
+	// 0224 lxi h,02806H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2806;
+	// 0227 mvi a,004H
+	regs.accumulator = 0x04;
+	regs.pc = 0x0229;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_0229( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0229 push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 022A push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 022B lda 02081H
+	regs.accumulator = AotRead8( chip8, 0x2081 );
+	// 022E ana a
+	AluAnd( regs, regs.accumulator );
+	// 022F jnz L0242
+	regs.pc = ! regs.flags.z ? 0x0242 : 0x0232;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0232( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0232 call L1A69
+	AotPush16( chip8, 0x0235 );
+	regs.pc = 0x1a69;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_0235( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0235 pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 0236 pop psw
+	regs.flags.u8 = AotRead8( chip8, regs.sp );
+	regs.accumulator = AotRead8( chip8, regs.sp + 1 );
+	regs.sp += 2;
+	// 0237 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 0238 rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x0239;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, jumps.
+static void Block_0239( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0239 push d
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 023A lxi d,002E0H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x02e0;
+	// 023D dad d
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 023E pop d
+	regs.gprPair[ AotRegisters::GprPair::DE ] = AotPop16( chip8 );
+	// 023F jmp L0229
+	regs.pc = 0x0229;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0242( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0242 call L147C
+	AotPush16( chip8, 0x0245 );
+	regs.pc = 0x147c;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0245( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0245 jmp L0235
+	regs.pc = 0x0235;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_0248( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0248 lxi h,02010H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2010;
+	regs.pc = 0x024b;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_024B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 024B mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 024C cpi 0FFH
+	AluSubtract( regs, 0xff, 0 );
+	// 024E rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x024f;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_024F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 024F cpi 0FEH
+	AluSubtract( regs, 0xfe, 0 );
+	// 0251 jz L0281
+	regs.pc = regs.flags.z ? 0x0281 : 0x0254;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 6 of 6 instructions, branches.
+static void Block_0254( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0254 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0255 mov b,m
+	regs.gpr[ 1 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0256 mov c,a
+	regs.gpr[ 0 ] = regs.accumulator;
+	// 0257 ora b
+	AluOr( regs, regs.gpr[ 1 ] );
+	// 0258 mov a,c
+	regs.accumulator = regs.gpr[ 0 ];
+	// 0259 jnz L0277
+	regs.pc = ! regs.flags.z ? 0x0277 : 0x025c;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_025C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 025C inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 025D mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 025E ana a
+	AluAnd( regs, regs.accumulator );
+	// 025F jnz L0288
+	regs.pc = ! regs.flags.z ? 0x0288 : 0x0262;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 11 of 11 instructions, jumps indirectly.
+static void Block_0262( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0262 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0263 mov e,m
+	regs.gpr[ 2 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0264 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0265 mov d,m
+	regs.gpr[ 3 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0266 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0267 xchg
+	{
+		const Uint16 de = regs.gprPair[ AotRegisters::GprPair::DE ];
+		regs.gprPair[ AotRegisters::GprPair::DE ] = regs.gprPair[ AotRegisters::GprPair::HL ];
+		regs.gprPair[ AotRegisters::GprPair::HL ] = de;
+	}
+	// 0268 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0269 lxi h,0026FH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x026f;
+	// 026C xthl
+	{
+		const Uint16 hl = regs.gprPair[ AotRegisters::GprPair::HL ];
+		regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, regs.sp );
+		AotWrite16( chip8, regs.sp, hl );
+	}
+	// 026D push d
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 026E pchl
+	regs.pc = regs.gprPair[ AotRegisters::GprPair::HL ];
+	chip8.InstructionsSinceInterrupt += 11;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0277( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0277 dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 0278 inr b
+	regs.gpr[ 1 ] = AluIncrement( regs, regs.gpr[ 1 ] );
+	// 0279 jnz L027D
+	regs.pc = ! regs.flags.z ? 0x027d : 0x027c;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_027C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 027C dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	regs.pc = 0x027d;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, falls through.
+static void Block_027D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 027D dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 027E mov m,b
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.gpr[ 1 ] );
+	// 027F dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 0280 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	regs.pc = 0x0281;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_0281( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0281 lxi d,00010H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x0010;
+	// 0284 dad d
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 0285 jmp L024B
+	regs.pc = 0x024b;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_0288( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0288 dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 0289 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 028A dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 028B jmp L0281
+	regs.pc = 0x0281;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_028E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 028E pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 028F inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0290 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0291 cpi 0FFH
+	AluSubtract( regs, 0xff, 0 );
+	// 0293 jz L033B
+	regs.pc = regs.flags.z ? 0x033b : 0x0296;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_0296( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0296 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0297 dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 0298 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x0299;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 11 of 11 instructions, branches.
+static void Block_0299( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0299 mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 029A xra a
+	AluXor( regs, regs.accumulator );
+	// 029B sta 02068H
+	AotWrite8( chip8, 0x2068, regs.accumulator );
+	// 029E sta 02069H
+	AotWrite8( chip8, 0x2069, regs.accumulator );
+	// 02A1 mvi a,030H
+	regs.accumulator = 0x30;
+	// 02A3 sta 0206AH
+	AotWrite8( chip8, 0x206a, regs.accumulator );
+	// 02A6 mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 02A7 mvi m,005H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x05 );
+	// 02A9 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 02AA dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 02AB jnz L039B
+	regs.pc = ! regs.flags.z ? 0x039b : 0x02ae;
+	chip8.InstructionsSinceInterrupt += 11;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_02AE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02AE lhld 0201AH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x201a );
+	// 02B1 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 02B3 call L1424
+	AotPush16( chip8, 0x02b6 );
+	regs.pc = 0x1424;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_02B6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02B6 lxi h,02010H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2010;
+	// 02B9 lxi d,01B10H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1b10;
+	// 02BC mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 02BE call L1A32
+	AotPush16( chip8, 0x02c1 );
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_02C1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02C1 mvi b,000H
+	regs.gpr[ 1 ] = 0x00;
+	// 02C3 call L19DC
+	AotPush16( chip8, 0x02c6 );
+	regs.pc = 0x19dc;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_02C6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02C6 lda 0206DH
+	regs.accumulator = AotRead8( chip8, 0x206d );
+	// 02C9 ana a
+	AluAnd( regs, regs.accumulator );
+	// 02CA rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x02cb;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_02CB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02CB lda 020EFH
+	regs.accumulator = AotRead8( chip8, 0x20ef );
+	// 02CE ana a
+	AluAnd( regs, regs.accumulator );
+	// 02CF rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x02d0;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 3 instructions, stops for the interpreter.
+static void Block_02D0( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02D0 lxi sp,02400H
+	regs.sp = 0x2400;
+	regs.pc = 0x02d3;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_02D7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02D7 call L092E
+	AotPush16( chip8, 0x02da );
+	regs.pc = 0x092e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_02DA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02DA ana a
+	AluAnd( regs, regs.accumulator );
+	// 02DB jz L166D
+	regs.pc = regs.flags.z ? 0x166d : 0x02de;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_02DE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02DE call L18E7
+	AotPush16( chip8, 0x02e1 );
+	regs.pc = 0x18e7;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_02E1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02E1 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 02E2 ana a
+	AluAnd( regs, regs.accumulator );
+	// 02E3 jz L032C
+	regs.pc = regs.flags.z ? 0x032c : 0x02e6;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_02E6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02E6 lda 020CEH
+	regs.accumulator = AotRead8( chip8, 0x20ce );
+	// 02E9 ana a
+	AluAnd( regs, regs.accumulator );
+	// 02EA jz L032C
+	regs.pc = regs.flags.z ? 0x032c : 0x02ed;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_02ED( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02ED lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 02F0 push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 02F1 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 02F2 jc L0332
+	regs.pc = regs.flags.cy ? 0x0332 : 0x02f5;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_02F5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02F5 call L020E
+	AotPush16( chip8, 0x02f8 );
+	regs.pc = 0x020e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_02F8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02F8 call L0878
+	AotPush16( chip8, 0x02fb );
+	regs.pc = 0x0878;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 8 of 8 instructions, calls.
+static void Block_02FB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 02FB mov m,e
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.gpr[ 2 ] );
+	// 02FC inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 02FD mov m,d
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.gpr[ 3 ] );
+	// 02FE dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 02FF dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 0300 mov m,b
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.gpr[ 1 ] );
+	// 0301 nop
+	// 0302 call L01E4
+	AotPush16( chip8, 0x0305 );
+	regs.pc = 0x01e4;
+	chip8.InstructionsSinceInterrupt += 8;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_0305( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0305 pop psw
+	regs.flags.u8 = AotRead8( chip8, regs.sp );
+	regs.accumulator = AotRead8( chip8, regs.sp + 1 );
+	regs.sp += 2;
+	// 0306 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0307 mvi a,021H
+	regs.accumulator = 0x21;
+	// 0309 mvi b,000H
+	regs.gpr[ 1 ] = 0x00;
+	// 030B jnc L0312
+	regs.pc = ! regs.flags.cy ? 0x0312 : 0x030e;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_030E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 030E mvi b,020H
+	regs.gpr[ 1 ] = 0x20;
+	// 0310 mvi a,022H
+	regs.accumulator = 0x22;
+	regs.pc = 0x0312;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0312( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0312 sta 02067H
+	AotWrite8( chip8, 0x2067, regs.accumulator );
+	// 0315 call L0AB6
+	AotPush16( chip8, 0x0318 );
+	regs.pc = 0x0ab6;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 7 of 7 instructions, calls.
+static void Block_0318( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0318 xra a
+	AluXor( regs, regs.accumulator );
+	// 0319 sta 02011H
+	AotWrite8( chip8, 0x2011, regs.accumulator );
+	// 031C mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	chip8.InstructionsSinceInterrupt += 3;
+	// 031D out 005H
+	IoWrite( chip8, 0x05, regs.accumulator );
+	// 031F inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 0320 sta 02098H
+	AotWrite8( chip8, 0x2098, regs.accumulator );
+	// 0323 call L09D6
+	AotPush16( chip8, 0x0326 );
+	regs.pc = 0x09d6;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0326( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0326 call L1A7F
+	AotPush16( chip8, 0x0329 );
+	regs.pc = 0x1a7f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0329( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0329 jmp L07F9
+	regs.pc = 0x07f9;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_032C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 032C call L1A7F
+	AotPush16( chip8, 0x032f );
+	regs.pc = 0x1a7f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_032F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 032F jmp L0817
+	regs.pc = 0x0817;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0332( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0332 call L0209
+	AotPush16( chip8, 0x0335 );
+	regs.pc = 0x0209;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0335( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0335 jmp L02F8
+	regs.pc = 0x02f8;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 6 of 6 instructions, jumps.
+static void Block_033B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 033B lxi h,02068H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2068;
+	// 033E mvi m,001H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x01 );
+	// 0340 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0341 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0342 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0343 jmp L03B0
+	regs.pc = 0x03b0;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 3 of 3 instructions, falls through.
+static void Block_0346( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0346 nop
+	// 0347 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 0348 mvi m,001H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x01 );
+	regs.pc = 0x034a;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_034A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 034A lda 0201BH
+	regs.accumulator = AotRead8( chip8, 0x201b );
+	// 034D mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 034E lda 020EFH
+	regs.accumulator = AotRead8( chip8, 0x20ef );
+	// 0351 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0352 jnz L0363
+	regs.pc = ! regs.flags.z ? 0x0363 : 0x0355;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0355( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0355 lda 0201DH
+	regs.accumulator = AotRead8( chip8, 0x201d );
+	// 0358 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0359 jc L0381
+	regs.pc = regs.flags.cy ? 0x0381 : 0x035c;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_035C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 035C rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 035D jc L038E
+	regs.pc = regs.flags.cy ? 0x038e : 0x0360;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0360( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0360 jmp L036F
+	regs.pc = 0x036f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0363( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0363 call L17C0
+	AotPush16( chip8, 0x0366 );
+	regs.pc = 0x17c0;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0366( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0366 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 0367 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 0368 jc L0381
+	regs.pc = regs.flags.cy ? 0x0381 : 0x036b;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_036B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 036B rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 036C jc L038E
+	regs.pc = regs.flags.cy ? 0x038e : 0x036f;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_036F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 036F lxi h,02018H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2018;
+	// 0372 call L1A3B
+	AotPush16( chip8, 0x0375 );
+	regs.pc = 0x1a3b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0375( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0375 call L1A47
+	AotPush16( chip8, 0x0378 );
+	regs.pc = 0x1a47;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0378( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0378 call L1439
+	AotPush16( chip8, 0x037b );
+	regs.pc = 0x1439;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_037B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 037B mvi a,000H
+	regs.accumulator = 0x00;
+	// 037D sta 02012H
+	AotWrite8( chip8, 0x2012, regs.accumulator );
+	// 0380 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0381( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0381 mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 0382 cpi 0D9H
+	AluSubtract( regs, 0xd9, 0 );
+	// 0384 jz L036F
+	regs.pc = regs.flags.z ? 0x036f : 0x0387;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_0387( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0387 inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 0388 sta 0201BH
+	AotWrite8( chip8, 0x201b, regs.accumulator );
+	// 038B jmp L036F
+	regs.pc = 0x036f;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_038E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 038E mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 038F cpi 030H
+	AluSubtract( regs, 0x30, 0 );
+	// 0391 jz L036F
+	regs.pc = regs.flags.z ? 0x036f : 0x0394;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_0394( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0394 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 0395 sta 0201BH
+	AotWrite8( chip8, 0x201b, regs.accumulator );
+	// 0398 jmp L036F
+	regs.pc = 0x036f;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 12 of 12 instructions, jumps.
+static void Block_039B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 039B inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 039C ani 001H
+	AluAnd( regs, 0x01 );
+	// 039E sta 02015H
+	AotWrite8( chip8, 0x2015, regs.accumulator );
+	// 03A1 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 03A2 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 03A3 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 03A4 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 03A5 lxi h,01C70H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x1c70;
+	// 03A8 add l
+	AluAdd( regs, regs.gpr[ 4 ], 0 );
+	// 03A9 mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 03AA shld 02018H
+	AotWrite16( chip8, 0x2018, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 03AD jmp L036F
+	regs.pc = 0x036f;
+	chip8.InstructionsSinceInterrupt += 12;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_03B0( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03B0 jnz L034A
+	regs.pc = ! regs.flags.z ? 0x034a : 0x03b3;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_03B3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03B3 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 03B4 dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 03B5 jnz L034A
+	regs.pc = ! regs.flags.z ? 0x034a : 0x03b8;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_03B8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03B8 jmp L0346
+	regs.pc = 0x0346;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_03BB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03BB lxi d,0202AH
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x202a;
+	// 03BE call L1A06
+	AotPush16( chip8, 0x03c1 );
+	regs.pc = 0x1a06;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_03C1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03C1 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 03C2 rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x03c3;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_03C3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03C3 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 03C4 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 03C5 ana a
+	AluAnd( regs, regs.accumulator );
+	// 03C6 rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x03c7;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_03C7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03C7 cpi 001H
+	AluSubtract( regs, 0x01, 0 );
+	// 03C9 jz L03FA
+	regs.pc = regs.flags.z ? 0x03fa : 0x03cc;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_03CC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03CC cpi 002H
+	AluSubtract( regs, 0x02, 0 );
+	// 03CE jz L040A
+	regs.pc = regs.flags.z ? 0x040a : 0x03d1;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_03D1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03D1 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 03D2 cpi 003H
+	AluSubtract( regs, 0x03, 0 );
+	// 03D4 jnz L042A
+	regs.pc = ! regs.flags.z ? 0x042a : 0x03d7;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_03D7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03D7 dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 03D8 jz L0436
+	regs.pc = regs.flags.z ? 0x0436 : 0x03db;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_03DB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03DB mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 03DC cpi 00FH
+	AluSubtract( regs, 0x0f, 0 );
+	// 03DE rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x03df;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_03DF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03DF push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 03E0 call L0430
+	AotPush16( chip8, 0x03e3 );
+	regs.pc = 0x0430;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_03E3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03E3 call L1452
+	AotPush16( chip8, 0x03e6 );
+	regs.pc = 0x1452;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 14 of 14 instructions, calls.
+static void Block_03E6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03E6 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 03E7 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 03E8 inr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluIncrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 03E9 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 03EA inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 03EB dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 03EC dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 03ED inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 03EE dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 03EF dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 03F0 dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 03F1 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 03F2 mvi m,008H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x08 );
+	// 03F4 call L0430
+	AotPush16( chip8, 0x03f7 );
+	regs.pc = 0x0430;
+	chip8.InstructionsSinceInterrupt += 14;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_03F7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03F7 jmp L1400
+	regs.pc = 0x1400;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 6 of 6 instructions, calls.
+static void Block_03FA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 03FA inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 03FB mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 03FC lda 0201BH
+	regs.accumulator = AotRead8( chip8, 0x201b );
+	// 03FF adi 008H
+	AluAdd( regs, 0x08, 0 );
+	// 0401 sta 0202AH
+	AotWrite8( chip8, 0x202a, regs.accumulator );
+	// 0404 call L0430
+	AotPush16( chip8, 0x0407 );
+	regs.pc = 0x0430;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0407( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0407 jmp L1400
+	regs.pc = 0x1400;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_040A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 040A call L0430
+	AotPush16( chip8, 0x040d );
+	regs.pc = 0x0430;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_040D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 040D push d
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 040E push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 040F push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 0410 call L1452
+	AotPush16( chip8, 0x0413 );
+	regs.pc = 0x1452;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 8 of 8 instructions, calls.
+static void Block_0413( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0413 pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 0414 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 0415 pop d
+	regs.gprPair[ AotRegisters::GprPair::DE ] = AotPop16( chip8 );
+	// 0416 lda 0202CH
+	regs.accumulator = AotRead8( chip8, 0x202c );
+	// 0419 add l
+	AluAdd( regs, regs.gpr[ 4 ], 0 );
+	// 041A mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 041B sta 02029H
+	AotWrite8( chip8, 0x2029, regs.accumulator );
+	// 041E call L1491
+	AotPush16( chip8, 0x0421 );
+	regs.pc = 0x1491;
+	chip8.InstructionsSinceInterrupt += 8;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_0421( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0421 lda 02061H
+	regs.accumulator = AotRead8( chip8, 0x2061 );
+	// 0424 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0425 rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x0426;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_0426( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0426 sta 02002H
+	AotWrite8( chip8, 0x2002, regs.accumulator );
+	// 0429 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_042A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 042A cpi 005H
+	AluSubtract( regs, 0x05, 0 );
+	// 042C rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x042d;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_042D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 042D jmp L0436
+	regs.pc = 0x0436;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_0430( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0430 lxi h,02027H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2027;
+	// 0433 jmp L1A3B
+	regs.pc = 0x1a3b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0436( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0436 call L0430
+	AotPush16( chip8, 0x0439 );
+	regs.pc = 0x0430;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0439( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0439 call L1452
+	AotPush16( chip8, 0x043c );
+	regs.pc = 0x1452;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_043C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 043C lxi h,02025H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2025;
+	// 043F lxi d,01B25H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1b25;
+	// 0442 mvi b,007H
+	regs.gpr[ 1 ] = 0x07;
+	// 0444 call L1A32
+	AotPush16( chip8, 0x0447 );
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_0447( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0447 lhld 0208DH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x208d );
+	// 044A inr l
+	regs.gpr[ 4 ] = AluIncrement( regs, regs.gpr[ 4 ] );
+	// 044B mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 044C cpi 063H
+	AluSubtract( regs, 0x63, 0 );
+	// 044E jc L0453
+	regs.pc = regs.flags.cy ? 0x0453 : 0x0451;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_0451( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0451 mvi l,054H
+	regs.gpr[ 4 ] = 0x54;
+	regs.pc = 0x0453;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 7 of 7 instructions, returns conditionally.
+static void Block_0453( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0453 shld 0208DH
+	AotWrite16( chip8, 0x208d, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0456 lhld 0208FH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x208f );
+	// 0459 inr l
+	regs.gpr[ 4 ] = AluIncrement( regs, regs.gpr[ 4 ] );
+	// 045A shld 0208FH
+	AotWrite16( chip8, 0x208f, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 045D lda 02084H
+	regs.accumulator = AotRead8( chip8, 0x2084 );
+	// 0460 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0461 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x0462;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0462( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0462 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0463 ani 001H
+	AluAnd( regs, 0x01 );
+	// 0465 lxi b,00229H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0229;
+	// 0468 jnz L046E
+	regs.pc = ! regs.flags.z ? 0x046e : 0x046b;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_046B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 046B lxi b,0FEE0H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0xfee0;
+	regs.pc = 0x046e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 6 of 6 instructions, returns.
+static void Block_046E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 046E lxi h,0208AH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x208a;
+	// 0471 mov m,c
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.gpr[ 0 ] );
+	// 0472 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0473 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0474 mov m,b
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.gpr[ 1 ] );
+	// 0475 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 7 of 7 instructions, branches.
+static void Block_0476( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0476 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 0477 lda 01B32H
+	regs.accumulator = AotRead8( chip8, 0x1b32 );
+	// 047A sta 02032H
+	AotWrite8( chip8, 0x2032, regs.accumulator );
+	// 047D lhld 02038H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x2038 );
+	// 0480 mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 0481 ora h
+	AluOr( regs, regs.gpr[ 5 ] );
+	// 0482 jnz L048A
+	regs.pc = ! regs.flags.z ? 0x048a : 0x0485;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_0485( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0485 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 0486 shld 02038H
+	AotWrite16( chip8, 0x2038, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0489 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_048A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 048A lxi d,02035H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x2035;
+	// 048D mvi a,0F9H
+	regs.accumulator = 0xf9;
+	// 048F call L0550
+	AotPush16( chip8, 0x0492 );
+	regs.pc = 0x0550;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 5 of 5 instructions, calls.
+static void Block_0492( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0492 lda 02046H
+	regs.accumulator = AotRead8( chip8, 0x2046 );
+	// 0495 sta 02070H
+	AotWrite8( chip8, 0x2070, regs.accumulator );
+	// 0498 lda 02056H
+	regs.accumulator = AotRead8( chip8, 0x2056 );
+	// 049B sta 02071H
+	AotWrite8( chip8, 0x2071, regs.accumulator );
+	// 049E call L0563
+	AotPush16( chip8, 0x04a1 );
+	regs.pc = 0x0563;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_04A1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04A1 lda 02078H
+	regs.accumulator = AotRead8( chip8, 0x2078 );
+	// 04A4 ana a
+	AluAnd( regs, regs.accumulator );
+	// 04A5 lxi h,02035H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2035;
+	// 04A8 jnz L055B
+	regs.pc = ! regs.flags.z ? 0x055b : 0x04ab;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_04AB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04AB lxi d,01B30H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1b30;
+	// 04AE lxi h,02030H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2030;
+	// 04B1 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 04B3 jmp L1A32
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_04B6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04B6 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 04B7 lda 0206EH
+	regs.accumulator = AotRead8( chip8, 0x206e );
+	// 04BA ana a
+	AluAnd( regs, regs.accumulator );
+	// 04BB rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x04bc;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_04BC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04BC lda 02080H
+	regs.accumulator = AotRead8( chip8, 0x2080 );
+	// 04BF cpi 001H
+	AluSubtract( regs, 0x01, 0 );
+	// 04C1 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x04c2;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_04C2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04C2 lxi d,02045H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x2045;
+	// 04C5 mvi a,0EDH
+	regs.accumulator = 0xed;
+	// 04C7 call L0550
+	AotPush16( chip8, 0x04ca );
+	regs.pc = 0x0550;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 5 of 5 instructions, calls.
+static void Block_04CA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04CA lda 02036H
+	regs.accumulator = AotRead8( chip8, 0x2036 );
+	// 04CD sta 02070H
+	AotWrite8( chip8, 0x2070, regs.accumulator );
+	// 04D0 lda 02056H
+	regs.accumulator = AotRead8( chip8, 0x2056 );
+	// 04D3 sta 02071H
+	AotWrite8( chip8, 0x2071, regs.accumulator );
+	// 04D6 call L0563
+	AotPush16( chip8, 0x04d9 );
+	regs.pc = 0x0563;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_04D9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04D9 lda 02076H
+	regs.accumulator = AotRead8( chip8, 0x2076 );
+	// 04DC cpi 010H
+	AluSubtract( regs, 0x10, 0 );
+	// 04DE jc L04E7
+	regs.pc = regs.flags.cy ? 0x04e7 : 0x04e1;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_04E1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04E1 lda 01B48H
+	regs.accumulator = AotRead8( chip8, 0x1b48 );
+	// 04E4 sta 02076H
+	AotWrite8( chip8, 0x2076, regs.accumulator );
+	regs.pc = 0x04e7;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_04E7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04E7 lda 02078H
+	regs.accumulator = AotRead8( chip8, 0x2078 );
+	// 04EA ana a
+	AluAnd( regs, regs.accumulator );
+	// 04EB lxi h,02045H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2045;
+	// 04EE jnz L055B
+	regs.pc = ! regs.flags.z ? 0x055b : 0x04f1;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_04F1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04F1 lxi d,01B40H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1b40;
+	// 04F4 lxi h,02040H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2040;
+	// 04F7 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 04F9 call L1A32
+	AotPush16( chip8, 0x04fc );
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_04FC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 04FC lda 02082H
+	regs.accumulator = AotRead8( chip8, 0x2082 );
+	// 04FF dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 0500 jnz L0508
+	regs.pc = ! regs.flags.z ? 0x0508 : 0x0503;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_0503( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0503 mvi a,001H
+	regs.accumulator = 0x01;
+	// 0505 sta 0206EH
+	AotWrite8( chip8, 0x206e, regs.accumulator );
+	regs.pc = 0x0508;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_0508( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0508 lhld 02076H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x2076 );
+	// 050B jmp L067E
+	regs.pc = 0x067e;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_050E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 050E pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	regs.pc = 0x050f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_050F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 050F lxi d,02055H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x2055;
+	// 0512 mvi a,0DBH
+	regs.accumulator = 0xdb;
+	// 0514 call L0550
+	AotPush16( chip8, 0x0517 );
+	regs.pc = 0x0550;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 5 of 5 instructions, calls.
+static void Block_0517( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0517 lda 02046H
+	regs.accumulator = AotRead8( chip8, 0x2046 );
+	// 051A sta 02070H
+	AotWrite8( chip8, 0x2070, regs.accumulator );
+	// 051D lda 02036H
+	regs.accumulator = AotRead8( chip8, 0x2036 );
+	// 0520 sta 02071H
+	AotWrite8( chip8, 0x2071, regs.accumulator );
+	// 0523 call L0563
+	AotPush16( chip8, 0x0526 );
+	regs.pc = 0x0563;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0526( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0526 lda 02076H
+	regs.accumulator = AotRead8( chip8, 0x2076 );
+	// 0529 cpi 015H
+	AluSubtract( regs, 0x15, 0 );
+	// 052B jc L0534
+	regs.pc = regs.flags.cy ? 0x0534 : 0x052e;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_052E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 052E lda 01B58H
+	regs.accumulator = AotRead8( chip8, 0x1b58 );
+	// 0531 sta 02076H
+	AotWrite8( chip8, 0x2076, regs.accumulator );
+	regs.pc = 0x0534;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0534( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0534 lda 02078H
+	regs.accumulator = AotRead8( chip8, 0x2078 );
+	// 0537 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0538 lxi h,02055H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2055;
+	// 053B jnz L055B
+	regs.pc = ! regs.flags.z ? 0x055b : 0x053e;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_053E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 053E lxi d,01B50H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1b50;
+	// 0541 lxi h,02050H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2050;
+	// 0544 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 0546 call L1A32
+	AotPush16( chip8, 0x0549 );
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_0549( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0549 lhld 02076H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x2076 );
+	// 054C shld 02058H
+	AotWrite16( chip8, 0x2058, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 054F ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_0550( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0550 sta 0207FH
+	AotWrite8( chip8, 0x207f, regs.accumulator );
+	// 0553 lxi h,02073H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2073;
+	// 0556 mvi b,00BH
+	regs.gpr[ 1 ] = 0x0b;
+	// 0558 jmp L1A32
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_055B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 055B lxi d,02073H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x2073;
+	// 055E mvi b,00BH
+	regs.gpr[ 1 ] = 0x0b;
+	// 0560 jmp L1A32
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0563( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0563 lxi h,02073H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2073;
+	// 0566 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0567 ani 080H
+	AluAnd( regs, 0x80 );
+	// 0569 jnz L05C1
+	regs.pc = ! regs.flags.z ? 0x05c1 : 0x056c;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_056C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 056C lda 020C1H
+	regs.accumulator = AotRead8( chip8, 0x20c1 );
+	// 056F cpi 004H
+	AluSubtract( regs, 0x04, 0 );
+	// 0571 lda 02069H
+	regs.accumulator = AotRead8( chip8, 0x2069 );
+	// 0574 jz L05B7
+	regs.pc = regs.flags.z ? 0x05b7 : 0x0577;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_0577( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0577 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0578 rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x0579;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_0579( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0579 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 057A mvi m,000H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x00 );
+	// 057C lda 02070H
+	regs.accumulator = AotRead8( chip8, 0x2070 );
+	// 057F ana a
+	AluAnd( regs, regs.accumulator );
+	// 0580 jz L0589
+	regs.pc = regs.flags.z ? 0x0589 : 0x0583;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_0583( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0583 mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 0584 lda 020CFH
+	regs.accumulator = AotRead8( chip8, 0x20cf );
+	// 0587 cmp b
+	AluSubtract( regs, regs.gpr[ 1 ], 0 );
+	// 0588 rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x0589;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0589( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0589 lda 02071H
+	regs.accumulator = AotRead8( chip8, 0x2071 );
+	// 058C ana a
+	AluAnd( regs, regs.accumulator );
+	// 058D jz L0596
+	regs.pc = regs.flags.z ? 0x0596 : 0x0590;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_0590( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0590 mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 0591 lda 020CFH
+	regs.accumulator = AotRead8( chip8, 0x20cf );
+	// 0594 cmp b
+	AluSubtract( regs, regs.gpr[ 1 ], 0 );
+	// 0595 rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x0596;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0596( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0596 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0597 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0598 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0599 jz L061B
+	regs.pc = regs.flags.z ? 0x061b : 0x059c;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, falls through.
+static void Block_059C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 059C lhld 02076H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x2076 );
+	// 059F mov c,m
+	regs.gpr[ 0 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 05A0 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 05A1 nop
+	// 05A2 shld 02076H
+	AotWrite16( chip8, 0x2076, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	regs.pc = 0x05a5;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_05A5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05A5 call L062F
+	AotPush16( chip8, 0x05a8 );
+	regs.pc = 0x062f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, returns conditionally.
+static void Block_05A8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05A8 rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x05a9;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_05A9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05A9 call L017A
+	AotPush16( chip8, 0x05ac );
+	regs.pc = 0x017a;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 7 of 7 instructions, falls through.
+static void Block_05AC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05AC mov a,c
+	regs.accumulator = regs.gpr[ 0 ];
+	// 05AD adi 007H
+	AluAdd( regs, 0x07, 0 );
+	// 05AF mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 05B0 mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 05B1 sui 00AH
+	regs.accumulator = AluSubtract( regs, 0x0a, 0 );
+	// 05B3 mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 05B4 shld 0207BH
+	AotWrite16( chip8, 0x207b, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	regs.pc = 0x05b7;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 7 of 7 instructions, returns.
+static void Block_05B7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05B7 lxi h,02073H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2073;
+	// 05BA mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 05BB ori 080H
+	AluOr( regs, 0x80 );
+	// 05BD mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 05BE inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 05BF inr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluIncrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 05C0 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_05C1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05C1 lxi d,0207CH
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x207c;
+	// 05C4 call L1A06
+	AotPush16( chip8, 0x05c7 );
+	regs.pc = 0x1a06;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, returns conditionally.
+static void Block_05C7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05C7 rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x05c8;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_05C8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05C8 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 05C9 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 05CA ani 001H
+	AluAnd( regs, 0x01 );
+	// 05CC jnz L0644
+	regs.pc = ! regs.flags.z ? 0x0644 : 0x05cf;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_05CF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05CF inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 05D0 inr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluIncrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 05D1 call L0675
+	AotPush16( chip8, 0x05d4 );
+	regs.pc = 0x0675;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_05D4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05D4 lda 02079H
+	regs.accumulator = AotRead8( chip8, 0x2079 );
+	// 05D7 adi 003H
+	AluAdd( regs, 0x03, 0 );
+	// 05D9 lxi h,0207FH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x207f;
+	// 05DC cmp m
+	AluSubtract( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ), 0 );
+	// 05DD jc L05E2
+	regs.pc = regs.flags.cy ? 0x05e2 : 0x05e0;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_05E0( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05E0 sui 00CH
+	regs.accumulator = AluSubtract( regs, 0x0c, 0 );
+	regs.pc = 0x05e2;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 7 of 7 instructions, calls.
+static void Block_05E2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05E2 sta 02079H
+	AotWrite8( chip8, 0x2079, regs.accumulator );
+	// 05E5 lda 0207BH
+	regs.accumulator = AotRead8( chip8, 0x207b );
+	// 05E8 mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 05E9 lda 0207EH
+	regs.accumulator = AotRead8( chip8, 0x207e );
+	// 05EC add b
+	AluAdd( regs, regs.gpr[ 1 ], 0 );
+	// 05ED sta 0207BH
+	AotWrite8( chip8, 0x207b, regs.accumulator );
+	// 05F0 call L066C
+	AotPush16( chip8, 0x05f3 );
+	regs.pc = 0x066c;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_05F3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05F3 lda 0207BH
+	regs.accumulator = AotRead8( chip8, 0x207b );
+	// 05F6 cpi 015H
+	AluSubtract( regs, 0x15, 0 );
+	// 05F8 jc L0612
+	regs.pc = regs.flags.cy ? 0x0612 : 0x05fb;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_05FB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 05FB lda 02061H
+	regs.accumulator = AotRead8( chip8, 0x2061 );
+	// 05FE ana a
+	AluAnd( regs, regs.accumulator );
+	// 05FF rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x0600;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0600( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0600 lda 0207BH
+	regs.accumulator = AotRead8( chip8, 0x207b );
+	// 0603 cpi 01EH
+	AluSubtract( regs, 0x1e, 0 );
+	// 0605 jc L0612
+	regs.pc = regs.flags.cy ? 0x0612 : 0x0608;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0608( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0608 cpi 027H
+	AluSubtract( regs, 0x27, 0 );
+	// 060A nop
+	// 060B jnc L0612
+	regs.pc = ! regs.flags.cy ? 0x0612 : 0x060e;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_060E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 060E sub a
+	regs.accumulator = AluSubtract( regs, regs.accumulator, 0 );
+	// 060F sta 02015H
+	AotWrite8( chip8, 0x2015, regs.accumulator );
+	regs.pc = 0x0612;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, returns.
+static void Block_0612( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0612 lda 02073H
+	regs.accumulator = AotRead8( chip8, 0x2073 );
+	// 0615 ori 001H
+	AluOr( regs, 0x01 );
+	// 0617 sta 02073H
+	AotWrite8( chip8, 0x2073, regs.accumulator );
+	// 061A ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_061B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 061B lda 0201BH
+	regs.accumulator = AotRead8( chip8, 0x201b );
+	// 061E adi 008H
+	AluAdd( regs, 0x08, 0 );
+	// 0620 mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 0621 call L156F
+	AotPush16( chip8, 0x0624 );
+	regs.pc = 0x156f;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0624( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0624 mov a,c
+	regs.accumulator = regs.gpr[ 0 ];
+	// 0625 cpi 00CH
+	AluSubtract( regs, 0x0c, 0 );
+	// 0627 jc L05A5
+	regs.pc = regs.flags.cy ? 0x05a5 : 0x062a;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_062A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 062A mvi c,00BH
+	regs.gpr[ 0 ] = 0x0b;
+	// 062C jmp L05A5
+	regs.pc = 0x05a5;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 5 of 5 instructions, falls through.
+static void Block_062F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 062F dcr c
+	regs.gpr[ 0 ] = AluDecrement( regs, regs.gpr[ 0 ] );
+	// 0630 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 0633 mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 0634 mov l,c
+	regs.gpr[ 4 ] = regs.gpr[ 0 ];
+	// 0635 mvi d,005H
+	regs.gpr[ 3 ] = 0x05;
+	regs.pc = 0x0637;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_0637( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0637 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0638 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0639 stc
+	regs.flags.cy = 1;
+	// 063A rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x063b;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_063B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 063B mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 063C adi 00BH
+	AluAdd( regs, 0x0b, 0 );
+	// 063E mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 063F dcr d
+	regs.gpr[ 3 ] = AluDecrement( regs, regs.gpr[ 3 ] );
+	// 0640 jnz L0637
+	regs.pc = ! regs.flags.z ? 0x0637 : 0x0643;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_0643( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0643 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_0644( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0644 lxi h,02078H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2078;
+	// 0647 dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 0648 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0649 cpi 003H
+	AluSubtract( regs, 0x03, 0 );
+	// 064B jnz L0667
+	regs.pc = ! regs.flags.z ? 0x0667 : 0x064e;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_064E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 064E call L0675
+	AotPush16( chip8, 0x0651 );
+	regs.pc = 0x0675;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 11 of 11 instructions, jumps.
+static void Block_0651( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0651 lxi h,01CDCH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x1cdc;
+	// 0654 shld 02079H
+	AotWrite16( chip8, 0x2079, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0657 lxi h,0207CH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x207c;
+	// 065A dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 065B dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 065C dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 065D dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 065E dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 065F mvi a,006H
+	regs.accumulator = 0x06;
+	// 0661 sta 0207DH
+	AotWrite8( chip8, 0x207d, regs.accumulator );
+	// 0664 jmp L066C
+	regs.pc = 0x066c;
+	chip8.InstructionsSinceInterrupt += 11;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_0667( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0667 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0668 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x0669;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0669( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0669 jmp L0675
+	regs.pc = 0x0675;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_066C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 066C lxi h,02079H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2079;
+	// 066F call L1A3B
+	AotPush16( chip8, 0x0672 );
+	regs.pc = 0x1a3b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0672( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0672 jmp L1491
+	regs.pc = 0x1491;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0675( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0675 lxi h,02079H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2079;
+	// 0678 call L1A3B
+	AotPush16( chip8, 0x067b );
+	regs.pc = 0x1a3b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_067B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 067B jmp L1452
+	regs.pc = 0x1452;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_067E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 067E shld 02048H
+	AotWrite16( chip8, 0x2048, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0681 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_0682( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0682 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 0683 lda 02080H
+	regs.accumulator = AotRead8( chip8, 0x2080 );
+	// 0686 cpi 002H
+	AluSubtract( regs, 0x02, 0 );
+	// 0688 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x0689;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0689( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0689 lxi h,02083H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2083;
+	// 068C mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 068D ana a
+	AluAnd( regs, regs.accumulator );
+	// 068E jz L050F
+	regs.pc = regs.flags.z ? 0x050f : 0x0691;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0691( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0691 lda 02056H
+	regs.accumulator = AotRead8( chip8, 0x2056 );
+	// 0694 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0695 jnz L050F
+	regs.pc = ! regs.flags.z ? 0x050f : 0x0698;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0698( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0698 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0699 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 069A ana a
+	AluAnd( regs, regs.accumulator );
+	// 069B jnz L06AB
+	regs.pc = ! regs.flags.z ? 0x06ab : 0x069e;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_069E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 069E lda 02082H
+	regs.accumulator = AotRead8( chip8, 0x2082 );
+	// 06A1 cpi 008H
+	AluSubtract( regs, 0x08, 0 );
+	// 06A3 jc L050F
+	regs.pc = regs.flags.cy ? 0x050f : 0x06a6;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_06A6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06A6 mvi m,001H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x01 );
+	// 06A8 call L073C
+	AotPush16( chip8, 0x06ab );
+	regs.pc = 0x073c;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_06AB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06AB lxi d,0208AH
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x208a;
+	// 06AE call L1A06
+	AotPush16( chip8, 0x06b1 );
+	regs.pc = 0x1a06;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, returns conditionally.
+static void Block_06B1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06B1 rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x06b2;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_06B2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06B2 lxi h,02085H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2085;
+	// 06B5 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 06B6 ana a
+	AluAnd( regs, regs.accumulator );
+	// 06B7 jnz L06D6
+	regs.pc = ! regs.flags.z ? 0x06d6 : 0x06ba;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 7 of 7 instructions, calls.
+static void Block_06BA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06BA lxi h,0208AH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x208a;
+	// 06BD mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 06BE inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 06BF inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 06C0 add m
+	AluAdd( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ), 0 );
+	// 06C1 sta 0208AH
+	AotWrite8( chip8, 0x208a, regs.accumulator );
+	// 06C4 call L073C
+	AotPush16( chip8, 0x06c7 );
+	regs.pc = 0x073c;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_06C7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06C7 lxi h,0208AH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x208a;
+	// 06CA mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 06CB cpi 028H
+	AluSubtract( regs, 0x28, 0 );
+	// 06CD jc L06F9
+	regs.pc = regs.flags.cy ? 0x06f9 : 0x06d0;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_06D0( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06D0 cpi 0E1H
+	AluSubtract( regs, 0xe1, 0 );
+	// 06D2 jnc L06F9
+	regs.pc = ! regs.flags.cy ? 0x06f9 : 0x06d5;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_06D5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06D5 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_06D6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06D6 mvi b,0FEH
+	regs.gpr[ 1 ] = 0xfe;
+	// 06D8 call L19DC
+	AotPush16( chip8, 0x06db );
+	regs.pc = 0x19dc;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_06DB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06DB inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 06DC dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 06DD mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 06DE cpi 01FH
+	AluSubtract( regs, 0x1f, 0 );
+	// 06E0 jz L074B
+	regs.pc = regs.flags.z ? 0x074b : 0x06e3;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_06E3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06E3 cpi 018H
+	AluSubtract( regs, 0x18, 0 );
+	// 06E5 jz L070C
+	regs.pc = regs.flags.z ? 0x070c : 0x06e8;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_06E8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06E8 ana a
+	AluAnd( regs, regs.accumulator );
+	// 06E9 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x06ea;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 10 of 10 instructions, falls through.
+static void Block_06EA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06EA mvi b,0EFH
+	regs.gpr[ 1 ] = 0xef;
+	// 06EC lxi h,02098H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2098;
+	// 06EF mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 06F0 ana b
+	AluAnd( regs, regs.gpr[ 1 ] );
+	// 06F1 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 06F2 ani 020H
+	AluAnd( regs, 0x20 );
+	chip8.InstructionsSinceInterrupt += 6;
+	// 06F4 out 005H
+	IoWrite( chip8, 0x05, regs.accumulator );
+	// 06F6 nop
+	// 06F7 nop
+	// 06F8 nop
+	regs.pc = 0x06f9;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_06F9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06F9 call L0742
+	AotPush16( chip8, 0x06fc );
+	regs.pc = 0x0742;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_06FC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06FC call L14CB
+	AotPush16( chip8, 0x06ff );
+	regs.pc = 0x14cb;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_06FF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 06FF lxi h,02083H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2083;
+	// 0702 mvi b,00AH
+	regs.gpr[ 1 ] = 0x0a;
+	// 0704 call L075F
+	AotPush16( chip8, 0x0707 );
+	regs.pc = 0x075f;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_0707( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0707 mvi b,0FEH
+	regs.gpr[ 1 ] = 0xfe;
+	// 0709 jmp L19DC
+	regs.pc = 0x19dc;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 7 of 7 instructions, falls through.
+static void Block_070C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 070C mvi a,001H
+	regs.accumulator = 0x01;
+	// 070E sta 020F1H
+	AotWrite8( chip8, 0x20f1, regs.accumulator );
+	// 0711 lhld 0208DH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x208d );
+	// 0714 mov b,m
+	regs.gpr[ 1 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0715 mvi c,004H
+	regs.gpr[ 0 ] = 0x04;
+	// 0717 lxi h,01D50H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x1d50;
+	// 071A lxi d,01D4CH
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1d4c;
+	regs.pc = 0x071d;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_071D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 071D ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 071E cmp b
+	AluSubtract( regs, regs.gpr[ 1 ], 0 );
+	// 071F jz L0728
+	regs.pc = regs.flags.z ? 0x0728 : 0x0722;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0722( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0722 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0723 inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 0724 dcr c
+	regs.gpr[ 0 ] = AluDecrement( regs, regs.gpr[ 0 ] );
+	// 0725 jnz L071D
+	regs.pc = ! regs.flags.z ? 0x071d : 0x0728;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 10 of 10 instructions, calls.
+static void Block_0728( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0728 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0729 sta 02087H
+	AotWrite8( chip8, 0x2087, regs.accumulator );
+	// 072C mvi h,000H
+	regs.gpr[ 5 ] = 0x00;
+	// 072E mov l,b
+	regs.gpr[ 4 ] = regs.gpr[ 1 ];
+	// 072F dad h
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0730 dad h
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0731 dad h
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0732 dad h
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0733 shld 020F2H
+	AotWrite16( chip8, 0x20f2, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0736 call L0742
+	AotPush16( chip8, 0x0739 );
+	regs.pc = 0x0742;
+	chip8.InstructionsSinceInterrupt += 10;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0739( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0739 jmp L08F1
+	regs.pc = 0x08f1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_073C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 073C call L0742
+	AotPush16( chip8, 0x073f );
+	regs.pc = 0x0742;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_073F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 073F jmp L1439
+	regs.pc = 0x1439;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0742( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0742 lxi h,02087H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2087;
+	// 0745 call L1A3B
+	AotPush16( chip8, 0x0748 );
+	regs.pc = 0x1a3b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0748( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0748 jmp L1A47
+	regs.pc = 0x1a47;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 6 of 6 instructions, calls.
+static void Block_074B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 074B mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 074D lxi h,02098H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2098;
+	// 0750 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0751 ora b
+	AluOr( regs, regs.gpr[ 1 ] );
+	// 0752 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 0753 call L1770
+	AotPush16( chip8, 0x0756 );
+	regs.pc = 0x1770;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_0756( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0756 lxi h,01D7CH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x1d7c;
+	// 0759 shld 02087H
+	AotWrite16( chip8, 0x2087, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 075C jmp L073C
+	regs.pc = 0x073c;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_075F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 075F lxi d,01B83H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1b83;
+	// 0762 jmp L1A32
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 5 instructions, stops for the interpreter.
+static void Block_0765( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0765 mvi a,001H
+	regs.accumulator = 0x01;
+	// 0767 sta 02093H
+	AotWrite8( chip8, 0x2093, regs.accumulator );
+	// 076A lxi sp,02400H
+	regs.sp = 0x2400;
+	regs.pc = 0x076d;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0771( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0771 call L09D6
+	AotPush16( chip8, 0x0774 );
+	regs.pc = 0x09d6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_0774( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0774 lxi h,03013H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x3013;
+	// 0777 lxi d,01FF3H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1ff3;
+	// 077A mvi c,004H
+	regs.gpr[ 0 ] = 0x04;
+	// 077C call L08F3
+	AotPush16( chip8, 0x077f );
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_077F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 077F lda 020EBH
+	regs.accumulator = AotRead8( chip8, 0x20eb );
+	// 0782 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 0783 lxi h,02810H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2810;
+	// 0786 mvi c,014H
+	regs.gpr[ 0 ] = 0x14;
+	// 0788 jnz L0857
+	regs.pc = ! regs.flags.z ? 0x0857 : 0x078b;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_078B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 078B lxi d,01ACFH
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1acf;
+	// 078E call L08F3
+	AotPush16( chip8, 0x0791 );
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0791( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0791 in 001H
+	regs.accumulator = IoRead( chip8, 0x01 );
+	// 0793 ani 004H
+	AluAnd( regs, 0x04 );
+	// 0795 jz L077F
+	regs.pc = regs.flags.z ? 0x077f : 0x0798;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_0798( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0798 mvi b,099H
+	regs.gpr[ 1 ] = 0x99;
+	// 079A xra a
+	AluXor( regs, regs.accumulator );
+	regs.pc = 0x079b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 6 of 6 instructions, calls.
+static void Block_079B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 079B sta 020CEH
+	AotWrite8( chip8, 0x20ce, regs.accumulator );
+	// 079E lda 020EBH
+	regs.accumulator = AotRead8( chip8, 0x20eb );
+	// 07A1 add b
+	AluAdd( regs, regs.gpr[ 1 ], 0 );
+	// 07A2 daa
+	AluDecimalAdjust( regs );
+	// 07A3 sta 020EBH
+	AotWrite8( chip8, 0x20eb, regs.accumulator );
+	// 07A6 call L1947
+	AotPush16( chip8, 0x07a9 );
+	regs.pc = 0x1947;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_07A9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07A9 lxi h,00000H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x0000;
+	// 07AC shld 020F8H
+	AotWrite16( chip8, 0x20f8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 07AF shld 020FCH
+	AotWrite16( chip8, 0x20fc, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 07B2 call L1925
+	AotPush16( chip8, 0x07b5 );
+	regs.pc = 0x1925;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_07B5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07B5 call L192B
+	AotPush16( chip8, 0x07b8 );
+	regs.pc = 0x192b;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_07B8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07B8 call L19D7
+	AotPush16( chip8, 0x07bb );
+	regs.pc = 0x19d7;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 6 of 6 instructions, calls.
+static void Block_07BB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07BB lxi h,00101H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x0101;
+	// 07BE mov a,h
+	regs.accumulator = regs.gpr[ 5 ];
+	// 07BF sta 020EFH
+	AotWrite8( chip8, 0x20ef, regs.accumulator );
+	// 07C2 shld 020E7H
+	AotWrite16( chip8, 0x20e7, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 07C5 shld 020E5H
+	AotWrite16( chip8, 0x20e5, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 07C8 call L1956
+	AotPush16( chip8, 0x07cb );
+	regs.pc = 0x1956;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_07CB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07CB call L01EF
+	AotPush16( chip8, 0x07ce );
+	regs.pc = 0x01ef;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_07CE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07CE call L01F5
+	AotPush16( chip8, 0x07d1 );
+	regs.pc = 0x01f5;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_07D1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07D1 call L08D1
+	AotPush16( chip8, 0x07d4 );
+	regs.pc = 0x08d1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_07D4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07D4 sta 021FFH
+	AotWrite8( chip8, 0x21ff, regs.accumulator );
+	// 07D7 sta 022FFH
+	AotWrite8( chip8, 0x22ff, regs.accumulator );
+	// 07DA call L00D7
+	AotPush16( chip8, 0x07dd );
+	regs.pc = 0x00d7;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_07DD( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07DD xra a
+	AluXor( regs, regs.accumulator );
+	// 07DE sta 021FEH
+	AotWrite8( chip8, 0x21fe, regs.accumulator );
+	// 07E1 sta 022FEH
+	AotWrite8( chip8, 0x22fe, regs.accumulator );
+	// 07E4 call L01C0
+	AotPush16( chip8, 0x07e7 );
+	regs.pc = 0x01c0;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_07E7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07E7 call L1904
+	AotPush16( chip8, 0x07ea );
+	regs.pc = 0x1904;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_07EA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07EA lxi h,03878H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x3878;
+	// 07ED shld 021FCH
+	AotWrite16( chip8, 0x21fc, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 07F0 shld 022FCH
+	AotWrite16( chip8, 0x22fc, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 07F3 call L01E4
+	AotPush16( chip8, 0x07f6 );
+	regs.pc = 0x01e4;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_07F6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07F6 call L1A7F
+	AotPush16( chip8, 0x07f9 );
+	regs.pc = 0x1a7f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_07F9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07F9 call L088D
+	AotPush16( chip8, 0x07fc );
+	regs.pc = 0x088d;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_07FC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07FC call L09D6
+	AotPush16( chip8, 0x07ff );
+	regs.pc = 0x09d6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, falls through.
+static void Block_07FF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 07FF nop
+	// 0800 xra a
+	AluXor( regs, regs.accumulator );
+	// 0801 sta 020C1H
+	AotWrite8( chip8, 0x20c1, regs.accumulator );
+	regs.pc = 0x0804;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0804( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0804 call L01CF
+	AotPush16( chip8, 0x0807 );
+	regs.pc = 0x01cf;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0807( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0807 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 080A rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 080B jc L0872
+	regs.pc = regs.flags.cy ? 0x0872 : 0x080e;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_080E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 080E call L0213
+	AotPush16( chip8, 0x0811 );
+	regs.pc = 0x0213;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0811( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0811 call L01CF
+	AotPush16( chip8, 0x0814 );
+	regs.pc = 0x01cf;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0814( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0814 call L00B1
+	AotPush16( chip8, 0x0817 );
+	regs.pc = 0x00b1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0817( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0817 call L19D1
+	AotPush16( chip8, 0x081a );
+	regs.pc = 0x19d1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_081A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 081A mvi b,020H
+	regs.gpr[ 1 ] = 0x20;
+	// 081C call L18FA
+	AotPush16( chip8, 0x081f );
+	regs.pc = 0x18fa;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_081F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 081F call L1618
+	AotPush16( chip8, 0x0822 );
+	regs.pc = 0x1618;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0822( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0822 call L190A
+	AotPush16( chip8, 0x0825 );
+	regs.pc = 0x190a;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0825( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0825 call L15F3
+	AotPush16( chip8, 0x0828 );
+	regs.pc = 0x15f3;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0828( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0828 call L0988
+	AotPush16( chip8, 0x082b );
+	regs.pc = 0x0988;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_082B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 082B lda 02082H
+	regs.accumulator = AotRead8( chip8, 0x2082 );
+	// 082E ana a
+	AluAnd( regs, regs.accumulator );
+	// 082F jz L09EF
+	regs.pc = regs.flags.z ? 0x09ef : 0x0832;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0832( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0832 call L170E
+	AotPush16( chip8, 0x0835 );
+	regs.pc = 0x170e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0835( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0835 call L0935
+	AotPush16( chip8, 0x0838 );
+	regs.pc = 0x0935;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0838( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0838 call L08D8
+	AotPush16( chip8, 0x083b );
+	regs.pc = 0x08d8;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_083B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 083B call L172C
+	AotPush16( chip8, 0x083e );
+	regs.pc = 0x172c;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_083E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 083E call L0A59
+	AotPush16( chip8, 0x0841 );
+	regs.pc = 0x0a59;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_0841( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0841 jz L0849
+	regs.pc = regs.flags.z ? 0x0849 : 0x0844;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0844( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0844 mvi b,004H
+	regs.gpr[ 1 ] = 0x04;
+	// 0846 call L18FA
+	AotPush16( chip8, 0x0849 );
+	regs.pc = 0x18fa;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0849( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0849 call L1775
+	AotPush16( chip8, 0x084c );
+	regs.pc = 0x1775;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_084C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 084C out 006H
+	IoWrite( chip8, 0x06, regs.accumulator );
+	// 084E call L1804
+	AotPush16( chip8, 0x0851 );
+	regs.pc = 0x1804;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0851( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0851 jmp L081F
+	regs.pc = 0x081f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0857( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0857 lxi d,01ABAH
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1aba;
+	// 085A call L08F3
+	AotPush16( chip8, 0x085d );
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_085D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 085D mvi b,098H
+	regs.gpr[ 1 ] = 0x98;
+	chip8.InstructionsSinceInterrupt += 1;
+	// 085F in 001H
+	regs.accumulator = IoRead( chip8, 0x01 );
+	// 0861 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0862 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0863 jc L086D
+	regs.pc = regs.flags.cy ? 0x086d : 0x0866;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_0866( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0866 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0867 jc L0798
+	regs.pc = regs.flags.cy ? 0x0798 : 0x086a;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_086A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 086A jmp L077F
+	regs.pc = 0x077f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_086D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 086D mvi a,001H
+	regs.accumulator = 0x01;
+	// 086F jmp L079B
+	regs.pc = 0x079b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0872( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0872 call L021A
+	AotPush16( chip8, 0x0875 );
+	regs.pc = 0x021a;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0875( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0875 jmp L0814
+	regs.pc = 0x0814;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 5 of 5 instructions, jumps.
+static void Block_0878( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0878 lda 02008H
+	regs.accumulator = AotRead8( chip8, 0x2008 );
+	// 087B mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 087C lhld 02009H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x2009 );
+	// 087F xchg
+	{
+		const Uint16 de = regs.gprPair[ AotRegisters::GprPair::DE ];
+		regs.gprPair[ AotRegisters::GprPair::DE ] = regs.gprPair[ AotRegisters::GprPair::HL ];
+		regs.gprPair[ AotRegisters::GprPair::HL ] = de;
+	}
+	// 0880 jmp L0886
+	regs.pc = 0x0886;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 4 of 4 instructions, returns.
+static void Block_0886( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0886 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 0889 mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 088A mvi l,0FCH
+	regs.gpr[ 4 ] = 0xfc;
+	// 088C ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_088D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 088D lxi h,02B11H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2b11;
+	// 0890 lxi d,01B70H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1b70;
+	// 0893 mvi c,00EH
+	regs.gpr[ 0 ] = 0x0e;
+	// 0895 call L08F3
+	AotPush16( chip8, 0x0898 );
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 5 of 5 instructions, calls.
+static void Block_0898( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0898 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 089B rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 089C mvi a,01CH
+	regs.accumulator = 0x1c;
+	// 089E lxi h,03711H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x3711;
+	// 08A1 cnc L08FF
+	if ( ! regs.flags.cy )
+	{
+		AotPush16( chip8, 0x08a4 );
+		regs.pc = 0x08ff;
+	}
+	else
+	{
+		regs.pc = 0x08a4;
+	}
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_08A4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08A4 mvi a,0B0H
+	regs.accumulator = 0xb0;
+	// 08A6 sta 020C0H
+	AotWrite8( chip8, 0x20c0, regs.accumulator );
+	regs.pc = 0x08a9;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_08A9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08A9 lda 020C0H
+	regs.accumulator = AotRead8( chip8, 0x20c0 );
+	// 08AC ana a
+	AluAnd( regs, regs.accumulator );
+	// 08AD rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x08ae;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_08AE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08AE ani 004H
+	AluAnd( regs, 0x04 );
+	// 08B0 jnz L08BC
+	regs.pc = ! regs.flags.z ? 0x08bc : 0x08b3;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_08B3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08B3 call L09CA
+	AotPush16( chip8, 0x08b6 );
+	regs.pc = 0x09ca;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_08B6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08B6 call L1931
+	AotPush16( chip8, 0x08b9 );
+	regs.pc = 0x1931;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_08B9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08B9 jmp L08A9
+	regs.pc = 0x08a9;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_08BC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08BC mvi b,020H
+	regs.gpr[ 1 ] = 0x20;
+	// 08BE lxi h,0271CH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x271c;
+	// 08C1 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 08C4 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 08C5 jc L08CB
+	regs.pc = regs.flags.cy ? 0x08cb : 0x08c8;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_08C8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08C8 lxi h,0391CH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x391c;
+	regs.pc = 0x08cb;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_08CB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08CB call L14CB
+	AotPush16( chip8, 0x08ce );
+	regs.pc = 0x14cb;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_08CE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08CE jmp L08A9
+	regs.pc = 0x08a9;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, returns.
+static void Block_08D1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08D1 in 002H
+	regs.accumulator = IoRead( chip8, 0x02 );
+	// 08D3 ani 003H
+	AluAnd( regs, 0x03 );
+	// 08D5 adi 003H
+	AluAdd( regs, 0x03, 0 );
+	// 08D7 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_08D8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08D8 lda 02082H
+	regs.accumulator = AotRead8( chip8, 0x2082 );
+	// 08DB cpi 009H
+	AluSubtract( regs, 0x09, 0 );
+	// 08DD rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x08de;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_08DE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08DE mvi a,0FBH
+	regs.accumulator = 0xfb;
+	// 08E0 sta 0207EH
+	AotWrite8( chip8, 0x207e, regs.accumulator );
+	// 08E3 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_08E4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08E4 lda 020CEH
+	regs.accumulator = AotRead8( chip8, 0x20ce );
+	// 08E7 ana a
+	AluAnd( regs, regs.accumulator );
+	// 08E8 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x08e9;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_08E9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08E9 lxi h,0391CH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x391c;
+	// 08EC mvi b,020H
+	regs.gpr[ 1 ] = 0x20;
+	// 08EE jmp L14CB
+	regs.pc = 0x14cb;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_08F1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08F1 mvi c,003H
+	regs.gpr[ 0 ] = 0x03;
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_08F3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08F3 ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 08F4 push d
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 08F5 call L08FF
+	AotPush16( chip8, 0x08f8 );
+	regs.pc = 0x08ff;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_08F8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08F8 pop d
+	regs.gprPair[ AotRegisters::GprPair::DE ] = AotPop16( chip8 );
+	// 08F9 inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 08FA dcr c
+	regs.gpr[ 0 ] = AluDecrement( regs, regs.gpr[ 0 ] );
+	// 08FB jnz L08F3
+	regs.pc = ! regs.flags.z ? 0x08f3 : 0x08fe;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_08FE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08FE ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 13 of 13 instructions, jumps.
+static void Block_08FF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 08FF lxi d,01E00H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1e00;
+	// 0902 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0903 mvi h,000H
+	regs.gpr[ 5 ] = 0x00;
+	// 0905 mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 0906 dad h
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0907 dad h
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0908 dad h
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0909 dad d
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 090A xchg
+	{
+		const Uint16 de = regs.gprPair[ AotRegisters::GprPair::DE ];
+		regs.gprPair[ AotRegisters::GprPair::DE ] = regs.gprPair[ AotRegisters::GprPair::HL ];
+		regs.gprPair[ AotRegisters::GprPair::HL ] = de;
+	}
+	// 090B pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 090C mvi b,008H
+	regs.gpr[ 1 ] = 0x08;
+	chip8.InstructionsSinceInterrupt += 11;
+	// 090E out 006H
+	IoWrite( chip8, 0x06, regs.accumulator );
+	// 0910 jmp L1439
+	regs.pc = 0x1439;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_0913( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0913 lda 02009H
+	regs.accumulator = AotRead8( chip8, 0x2009 );
+	// 0916 cpi 078H
+	AluSubtract( regs, 0x78, 0 );
+	// 0918 rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x0919;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0919( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0919 lhld 02091H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x2091 );
+	// 091C mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 091D ora h
+	AluOr( regs, regs.gpr[ 5 ] );
+	// 091E jnz L0929
+	regs.pc = ! regs.flags.z ? 0x0929 : 0x0921;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, falls through.
+static void Block_0921( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0921 lxi h,00600H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x0600;
+	// 0924 mvi a,001H
+	regs.accumulator = 0x01;
+	// 0926 sta 02083H
+	AotWrite8( chip8, 0x2083, regs.accumulator );
+	regs.pc = 0x0929;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_0929( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0929 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 092A shld 02091H
+	AotWrite16( chip8, 0x2091, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 092D ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_092E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 092E call L1611
+	AotPush16( chip8, 0x0931 );
+	regs.pc = 0x1611;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_0931( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0931 mvi l,0FFH
+	regs.gpr[ 4 ] = 0xff;
+	// 0933 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0934 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0935( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0935 call L1910
+	AotPush16( chip8, 0x0938 );
+	regs.pc = 0x1910;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 5 of 5 instructions, returns conditionally.
+static void Block_0938( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0938 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 0939 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 093A mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 093B ana a
+	AluAnd( regs, regs.accumulator );
+	// 093C rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x093d;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_093D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 093D mvi b,015H
+	regs.gpr[ 1 ] = 0x15;
+	chip8.InstructionsSinceInterrupt += 1;
+	// 093F in 002H
+	regs.accumulator = IoRead( chip8, 0x02 );
+	// 0941 ani 008H
+	AluAnd( regs, 0x08 );
+	// 0943 jz L0948
+	regs.pc = regs.flags.z ? 0x0948 : 0x0946;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_0946( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0946 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	regs.pc = 0x0948;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0948( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0948 call L09CA
+	AotPush16( chip8, 0x094b );
+	regs.pc = 0x09ca;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_094B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 094B inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 094C mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 094D cmp b
+	AluSubtract( regs, regs.gpr[ 1 ], 0 );
+	// 094E rc
+	regs.pc = regs.flags.cy ? AotPop16( chip8 ) : 0x094f;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_094F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 094F call L092E
+	AotPush16( chip8, 0x0952 );
+	regs.pc = 0x092e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, falls through.
+static void Block_0952( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0952 inr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluIncrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 0953 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0954 push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 0955 lxi h,02501H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2501;
+	regs.pc = 0x0958;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0958( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0958 inr h
+	regs.gpr[ 5 ] = AluIncrement( regs, regs.gpr[ 5 ] );
+	// 0959 inr h
+	regs.gpr[ 5 ] = AluIncrement( regs, regs.gpr[ 5 ] );
+	// 095A dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 095B jnz L0958
+	regs.pc = ! regs.flags.z ? 0x0958 : 0x095e;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_095E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 095E mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 0960 lxi d,01C60H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1c60;
+	// 0963 call L1439
+	AotPush16( chip8, 0x0966 );
+	regs.pc = 0x1439;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0966( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0966 pop psw
+	regs.flags.u8 = AotRead8( chip8, regs.sp );
+	regs.accumulator = AotRead8( chip8, regs.sp + 1 );
+	regs.sp += 2;
+	// 0967 inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 0968 call L1A8B
+	AotPush16( chip8, 0x096b );
+	regs.pc = 0x1a8b;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_096B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 096B call L1910
+	AotPush16( chip8, 0x096e );
+	regs.pc = 0x1910;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 7 of 7 instructions, jumps.
+static void Block_096E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 096E dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 096F dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 0970 mvi m,000H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x00 );
+	// 0972 mvi a,0FFH
+	regs.accumulator = 0xff;
+	// 0974 sta 02099H
+	AotWrite8( chip8, 0x2099, regs.accumulator );
+	// 0977 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 0979 jmp L18FA
+	regs.pc = 0x18fa;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_097C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 097C lxi h,01DA0H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x1da0;
+	// 097F cpi 002H
+	AluSubtract( regs, 0x02, 0 );
+	// 0981 rc
+	regs.pc = regs.flags.cy ? AotPop16( chip8 ) : 0x0982;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_0982( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0982 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0983 cpi 004H
+	AluSubtract( regs, 0x04, 0 );
+	// 0985 rc
+	regs.pc = regs.flags.cy ? AotPop16( chip8 ) : 0x0986;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_0986( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0986 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0987 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0988( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0988 call L09CA
+	AotPush16( chip8, 0x098b );
+	regs.pc = 0x09ca;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_098B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 098B lda 020F1H
+	regs.accumulator = AotRead8( chip8, 0x20f1 );
+	// 098E ana a
+	AluAnd( regs, regs.accumulator );
+	// 098F rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x0990;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 23 of 23 instructions, jumps.
+static void Block_0990( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0990 xra a
+	AluXor( regs, regs.accumulator );
+	// 0991 sta 020F1H
+	AotWrite8( chip8, 0x20f1, regs.accumulator );
+	// 0994 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0995 lhld 020F2H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x20f2 );
+	// 0998 xchg
+	{
+		const Uint16 de = regs.gprPair[ AotRegisters::GprPair::DE ];
+		regs.gprPair[ AotRegisters::GprPair::DE ] = regs.gprPair[ AotRegisters::GprPair::HL ];
+		regs.gprPair[ AotRegisters::GprPair::HL ] = de;
+	}
+	// 0999 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 099A mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 099B add e
+	AluAdd( regs, regs.gpr[ 2 ], 0 );
+	// 099C daa
+	AluDecimalAdjust( regs );
+	// 099D mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 099E mov e,a
+	regs.gpr[ 2 ] = regs.accumulator;
+	// 099F inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 09A0 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 09A1 adc d
+	AluAdd( regs, regs.gpr[ 3 ], regs.flags.cy );
+	// 09A2 daa
+	AluDecimalAdjust( regs );
+	// 09A3 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 09A4 mov d,a
+	regs.gpr[ 3 ] = regs.accumulator;
+	// 09A5 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 09A6 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 09A7 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 09A8 mov h,m
+	regs.gpr[ 5 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 09A9 mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 09AA jmp L09AD
+	regs.pc = 0x09ad;
+	chip8.InstructionsSinceInterrupt += 23;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_09AD( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09AD mov a,d
+	regs.accumulator = regs.gpr[ 3 ];
+	// 09AE call L09B2
+	AotPush16( chip8, 0x09b1 );
+	regs.pc = 0x09b2;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_09B1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09B1 mov a,e
+	regs.accumulator = regs.gpr[ 2 ];
+	regs.pc = 0x09b2;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 8 of 8 instructions, calls.
+static void Block_09B2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09B2 push d
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 09B3 push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 09B4 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 09B5 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 09B6 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 09B7 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 09B8 ani 00FH
+	AluAnd( regs, 0x0f );
+	// 09BA call L09C5
+	AotPush16( chip8, 0x09bd );
+	regs.pc = 0x09c5;
+	chip8.InstructionsSinceInterrupt += 8;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_09BD( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09BD pop psw
+	regs.flags.u8 = AotRead8( chip8, regs.sp );
+	regs.accumulator = AotRead8( chip8, regs.sp + 1 );
+	regs.sp += 2;
+	// 09BE ani 00FH
+	AluAnd( regs, 0x0f );
+	// 09C0 call L09C5
+	AotPush16( chip8, 0x09c3 );
+	regs.pc = 0x09c5;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_09C3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09C3 pop d
+	regs.gprPair[ AotRegisters::GprPair::DE ] = AotPop16( chip8 );
+	// 09C4 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_09C5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09C5 adi 01AH
+	AluAdd( regs, 0x1a, 0 );
+	// 09C7 jmp L08FF
+	regs.pc = 0x08ff;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_09CA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09CA lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 09CD rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 09CE lxi h,020F8H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20f8;
+	// 09D1 rc
+	regs.pc = regs.flags.cy ? AotPop16( chip8 ) : 0x09d2;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_09D2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09D2 lxi h,020FCH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20fc;
+	// 09D5 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_09D6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09D6 lxi h,02402H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2402;
+	regs.pc = 0x09d9;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 6 of 6 instructions, branches.
+static void Block_09D9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09D9 mvi m,000H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x00 );
+	// 09DB inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 09DC mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 09DD ani 01FH
+	AluAnd( regs, 0x1f );
+	// 09DF cpi 01CH
+	AluSubtract( regs, 0x1c, 0 );
+	// 09E1 jc L09E8
+	regs.pc = regs.flags.cy ? 0x09e8 : 0x09e4;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_09E4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09E4 lxi d,00006H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x0006;
+	// 09E7 dad d
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	regs.pc = 0x09e8;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_09E8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09E8 mov a,h
+	regs.accumulator = regs.gpr[ 5 ];
+	// 09E9 cpi 040H
+	AluSubtract( regs, 0x40, 0 );
+	// 09EB jc L09D9
+	regs.pc = regs.flags.cy ? 0x09d9 : 0x09ee;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_09EE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09EE ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_09EF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09EF call L0A3C
+	AotPush16( chip8, 0x09f2 );
+	regs.pc = 0x0a3c;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_09F2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09F2 xra a
+	AluXor( regs, regs.accumulator );
+	// 09F3 sta 020E9H
+	AotWrite8( chip8, 0x20e9, regs.accumulator );
+	// 09F6 call L09D6
+	AotPush16( chip8, 0x09f9 );
+	regs.pc = 0x09d6;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_09F9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 09F9 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 09FC push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 09FD call L01E4
+	AotPush16( chip8, 0x0a00 );
+	regs.pc = 0x01e4;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 11 of 11 instructions, falls through.
+static void Block_0A00( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A00 pop psw
+	regs.flags.u8 = AotRead8( chip8, regs.sp );
+	regs.accumulator = AotRead8( chip8, regs.sp + 1 );
+	regs.sp += 2;
+	// 0A01 sta 02067H
+	AotWrite8( chip8, 0x2067, regs.accumulator );
+	// 0A04 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 0A07 mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 0A08 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0A09 mvi l,0FEH
+	regs.gpr[ 4 ] = 0xfe;
+	// 0A0B mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0A0C ani 007H
+	AluAnd( regs, 0x07 );
+	// 0A0E inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 0A0F mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 0A10 lxi h,01DA2H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x1da2;
+	regs.pc = 0x0a13;
+	chip8.InstructionsSinceInterrupt += 11;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0A13( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A13 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0A14 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 0A15 jnz L0A13
+	regs.pc = ! regs.flags.z ? 0x0a13 : 0x0a18;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 9 of 9 instructions, branches.
+static void Block_0A18( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A18 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0A19 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 0A1A mvi l,0FCH
+	regs.gpr[ 4 ] = 0xfc;
+	// 0A1C mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 0A1D inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 0A1E mvi m,038H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x38 );
+	// 0A20 mov a,h
+	regs.accumulator = regs.gpr[ 5 ];
+	// 0A21 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0A22 jc L0A33
+	regs.pc = regs.flags.cy ? 0x0a33 : 0x0a25;
+	chip8.InstructionsSinceInterrupt += 9;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0A25( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A25 mvi a,021H
+	regs.accumulator = 0x21;
+	// 0A27 sta 02098H
+	AotWrite8( chip8, 0x2098, regs.accumulator );
+	// 0A2A call L01F5
+	AotPush16( chip8, 0x0a2d );
+	regs.pc = 0x01f5;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0A2D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A2D call L1904
+	AotPush16( chip8, 0x0a30 );
+	regs.pc = 0x1904;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0A30( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A30 jmp L0804
+	regs.pc = 0x0804;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0A33( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A33 call L01EF
+	AotPush16( chip8, 0x0a36 );
+	regs.pc = 0x01ef;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0A36( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A36 call L01C0
+	AotPush16( chip8, 0x0a39 );
+	regs.pc = 0x01c0;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0A39( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A39 jmp L0804
+	regs.pc = 0x0804;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0A3C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A3C call L0A59
+	AotPush16( chip8, 0x0a3f );
+	regs.pc = 0x0a59;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_0A3F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A3F jnz L0A52
+	regs.pc = ! regs.flags.z ? 0x0a52 : 0x0a42;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_0A42( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A42 mvi a,030H
+	regs.accumulator = 0x30;
+	// 0A44 sta 020C0H
+	AotWrite8( chip8, 0x20c0, regs.accumulator );
+	regs.pc = 0x0a47;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_0A47( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A47 lda 020C0H
+	regs.accumulator = AotRead8( chip8, 0x20c0 );
+	// 0A4A ana a
+	AluAnd( regs, regs.accumulator );
+	// 0A4B rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x0a4c;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0A4C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A4C call L0A59
+	AotPush16( chip8, 0x0a4f );
+	regs.pc = 0x0a59;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_0A4F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A4F jz L0A47
+	regs.pc = regs.flags.z ? 0x0a47 : 0x0a52;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0A52( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A52 call L0A59
+	AotPush16( chip8, 0x0a55 );
+	regs.pc = 0x0a59;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_0A55( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A55 jnz L0A52
+	regs.pc = ! regs.flags.z ? 0x0a52 : 0x0a58;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_0A58( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A58 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_0A59( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A59 lda 02015H
+	regs.accumulator = AotRead8( chip8, 0x2015 );
+	// 0A5C cpi 0FFH
+	AluSubtract( regs, 0xff, 0 );
+	// 0A5E ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0A5F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A5F lda 020EFH
+	regs.accumulator = AotRead8( chip8, 0x20ef );
+	// 0A62 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0A63 jz L0A7C
+	regs.pc = regs.flags.z ? 0x0a7c : 0x0a66;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0A66( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A66 mov c,b
+	regs.gpr[ 0 ] = regs.gpr[ 1 ];
+	// 0A67 mvi b,008H
+	regs.gpr[ 1 ] = 0x08;
+	// 0A69 call L18FA
+	AotPush16( chip8, 0x0a6c );
+	regs.pc = 0x18fa;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0A6C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A6C mov b,c
+	regs.gpr[ 1 ] = regs.gpr[ 0 ];
+	// 0A6D mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 0A6E call L097C
+	AotPush16( chip8, 0x0a71 );
+	regs.pc = 0x097c;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 7 of 7 instructions, falls through.
+static void Block_0A71( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A71 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0A72 lxi h,020F3H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20f3;
+	// 0A75 mvi m,000H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x00 );
+	// 0A77 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 0A78 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 0A79 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 0A7A mvi m,001H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x01 );
+	regs.pc = 0x0a7c;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_0A7C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A7C lxi h,02062H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2062;
+	// 0A7F ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_0A80( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A80 mvi a,002H
+	regs.accumulator = 0x02;
+	// 0A82 sta 020C1H
+	AotWrite8( chip8, 0x20c1, regs.accumulator );
+	regs.pc = 0x0a85;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_0A85( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A85 out 006H
+	IoWrite( chip8, 0x06, regs.accumulator );
+	// 0A87 lda 020CBH
+	regs.accumulator = AotRead8( chip8, 0x20cb );
+	// 0A8A ana a
+	AluAnd( regs, regs.accumulator );
+	// 0A8B jz L0A85
+	regs.pc = regs.flags.z ? 0x0a85 : 0x0a8e;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_0A8E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A8E xra a
+	AluXor( regs, regs.accumulator );
+	// 0A8F sta 020C1H
+	AotWrite8( chip8, 0x20c1, regs.accumulator );
+	// 0A92 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0A93( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A93 push d
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 0A94 ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 0A95 call L08FF
+	AotPush16( chip8, 0x0a98 );
+	regs.pc = 0x08ff;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, falls through.
+static void Block_0A98( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A98 pop d
+	regs.gprPair[ AotRegisters::GprPair::DE ] = AotPop16( chip8 );
+	// 0A99 mvi a,007H
+	regs.accumulator = 0x07;
+	// 0A9B sta 020C0H
+	AotWrite8( chip8, 0x20c0, regs.accumulator );
+	regs.pc = 0x0a9e;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0A9E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0A9E lda 020C0H
+	regs.accumulator = AotRead8( chip8, 0x20c0 );
+	// 0AA1 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 0AA2 jnz L0A9E
+	regs.pc = ! regs.flags.z ? 0x0a9e : 0x0aa5;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0AA5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AA5 inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 0AA6 dcr c
+	regs.gpr[ 0 ] = AluDecrement( regs, regs.gpr[ 0 ] );
+	// 0AA7 jnz L0A93
+	regs.pc = ! regs.flags.z ? 0x0a93 : 0x0aaa;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_0AAA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AAA ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_0AAB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AAB lxi h,02050H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2050;
+	// 0AAE jmp L024B
+	regs.pc = 0x024b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_0AB1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AB1 mvi a,040H
+	regs.accumulator = 0x40;
+	// 0AB3 jmp L0AD7
+	regs.pc = 0x0ad7;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_0AB6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AB6 mvi a,080H
+	regs.accumulator = 0x80;
+	// 0AB8 jmp L0AD7
+	regs.pc = 0x0ad7;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_0ABB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0ABB pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 0ABC jmp L0072
+	regs.pc = 0x0072;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0ABF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0ABF lda 020C1H
+	regs.accumulator = AotRead8( chip8, 0x20c1 );
+	// 0AC2 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0AC3 jc L0ABB
+	regs.pc = regs.flags.cy ? 0x0abb : 0x0ac6;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_0AC6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AC6 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0AC7 jc L1868
+	regs.pc = regs.flags.cy ? 0x1868 : 0x0aca;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_0ACA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0ACA rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 0ACB jc L0AAB
+	regs.pc = regs.flags.cy ? 0x0aab : 0x0ace;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_0ACE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0ACE ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_0ACF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0ACF lxi h,02B14H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2b14;
+	// 0AD2 mvi c,00FH
+	regs.gpr[ 0 ] = 0x0f;
+	// 0AD4 jmp L0A93
+	regs.pc = 0x0a93;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_0AD7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AD7 sta 020C0H
+	AotWrite8( chip8, 0x20c0, regs.accumulator );
+	regs.pc = 0x0ada;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0ADA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0ADA lda 020C0H
+	regs.accumulator = AotRead8( chip8, 0x20c0 );
+	// 0ADD ana a
+	AluAnd( regs, regs.accumulator );
+	// 0ADE jnz L0ADA
+	regs.pc = ! regs.flags.z ? 0x0ada : 0x0ae1;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_0AE1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AE1 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_0AE2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AE2 lxi h,020C2H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20c2;
+	// 0AE5 mvi b,00CH
+	regs.gpr[ 1 ] = 0x0c;
+	// 0AE7 jmp L1A32
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_0AEA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AEA xra a
+	AluXor( regs, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 0AEB out 003H
+	IoWrite( chip8, 0x03, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 0AED out 005H
+	IoWrite( chip8, 0x05, regs.accumulator );
+	// 0AEF call L1982
+	AotPush16( chip8, 0x0af2 );
+	regs.pc = 0x1982;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_0AF6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0AF6 lda 020ECH
+	regs.accumulator = AotRead8( chip8, 0x20ec );
+	// 0AF9 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0AFA lxi h,03017H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x3017;
+	// 0AFD mvi c,004H
+	regs.gpr[ 0 ] = 0x04;
+	// 0AFF jnz L0BE8
+	regs.pc = ! regs.flags.z ? 0x0be8 : 0x0b02;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0B02( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B02 lxi d,01CFAH
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1cfa;
+	// 0B05 call L0A93
+	AotPush16( chip8, 0x0b08 );
+	regs.pc = 0x0a93;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_0B08( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B08 lxi d,01DAFH
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1daf;
+	regs.pc = 0x0b0b;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B0B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B0B call L0ACF
+	AotPush16( chip8, 0x0b0e );
+	regs.pc = 0x0acf;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B0E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B0E call L0AB1
+	AotPush16( chip8, 0x0b11 );
+	regs.pc = 0x0ab1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B11( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B11 call L1815
+	AotPush16( chip8, 0x0b14 );
+	regs.pc = 0x1815;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B14( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B14 call L0AB6
+	AotPush16( chip8, 0x0b17 );
+	regs.pc = 0x0ab6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0B17( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B17 lda 020ECH
+	regs.accumulator = AotRead8( chip8, 0x20ec );
+	// 0B1A ana a
+	AluAnd( regs, regs.accumulator );
+	// 0B1B jnz L0B4A
+	regs.pc = ! regs.flags.z ? 0x0b4a : 0x0b1e;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0B1E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B1E lxi d,01A95H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1a95;
+	// 0B21 call L0AE2
+	AotPush16( chip8, 0x0b24 );
+	regs.pc = 0x0ae2;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B24( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B24 call L0A80
+	AotPush16( chip8, 0x0b27 );
+	regs.pc = 0x0a80;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0B27( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B27 lxi d,01BB0H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1bb0;
+	// 0B2A call L0AE2
+	AotPush16( chip8, 0x0b2d );
+	regs.pc = 0x0ae2;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B2D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B2D call L0A80
+	AotPush16( chip8, 0x0b30 );
+	regs.pc = 0x0a80;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B30( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B30 call L0AB1
+	AotPush16( chip8, 0x0b33 );
+	regs.pc = 0x0ab1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0B33( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B33 lxi d,01FC9H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1fc9;
+	// 0B36 call L0AE2
+	AotPush16( chip8, 0x0b39 );
+	regs.pc = 0x0ae2;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B39( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B39 call L0A80
+	AotPush16( chip8, 0x0b3c );
+	regs.pc = 0x0a80;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B3C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B3C call L0AB1
+	AotPush16( chip8, 0x0b3f );
+	regs.pc = 0x0ab1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0B3F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B3F lxi h,033B7H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x33b7;
+	// 0B42 mvi b,00AH
+	regs.gpr[ 1 ] = 0x0a;
+	// 0B44 call L14CB
+	AotPush16( chip8, 0x0b47 );
+	regs.pc = 0x14cb;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B47( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B47 call L0AB6
+	AotPush16( chip8, 0x0b4a );
+	regs.pc = 0x0ab6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B4A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B4A call L09D6
+	AotPush16( chip8, 0x0b4d );
+	regs.pc = 0x09d6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0B4D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B4D lda 021FFH
+	regs.accumulator = AotRead8( chip8, 0x21ff );
+	// 0B50 ana a
+	AluAnd( regs, regs.accumulator );
+	// 0B51 jnz L0B5D
+	regs.pc = ! regs.flags.z ? 0x0b5d : 0x0b54;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B54( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B54 call L08D1
+	AotPush16( chip8, 0x0b57 );
+	regs.pc = 0x08d1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0B57( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B57 sta 021FFH
+	AotWrite8( chip8, 0x21ff, regs.accumulator );
+	// 0B5A call L1A7F
+	AotPush16( chip8, 0x0b5d );
+	regs.pc = 0x1a7f;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B5D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B5D call L01E4
+	AotPush16( chip8, 0x0b60 );
+	regs.pc = 0x01e4;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B60( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B60 call L01C0
+	AotPush16( chip8, 0x0b63 );
+	regs.pc = 0x01c0;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B63( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B63 call L01EF
+	AotPush16( chip8, 0x0b66 );
+	regs.pc = 0x01ef;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B66( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B66 call L021A
+	AotPush16( chip8, 0x0b69 );
+	regs.pc = 0x021a;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0B69( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B69 mvi a,001H
+	regs.accumulator = 0x01;
+	// 0B6B sta 020C1H
+	AotWrite8( chip8, 0x20c1, regs.accumulator );
+	// 0B6E call L01CF
+	AotPush16( chip8, 0x0b71 );
+	regs.pc = 0x01cf;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B71( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B71 call L1618
+	AotPush16( chip8, 0x0b74 );
+	regs.pc = 0x1618;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B74( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B74 call L0BF1
+	AotPush16( chip8, 0x0b77 );
+	regs.pc = 0x0bf1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0B77( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B77 out 006H
+	IoWrite( chip8, 0x06, regs.accumulator );
+	// 0B79 call L0A59
+	AotPush16( chip8, 0x0b7c );
+	regs.pc = 0x0a59;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_0B7C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B7C jz L0B71
+	regs.pc = regs.flags.z ? 0x0b71 : 0x0b7f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_0B7F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B7F xra a
+	AluXor( regs, regs.accumulator );
+	// 0B80 sta 02025H
+	AotWrite8( chip8, 0x2025, regs.accumulator );
+	regs.pc = 0x0b83;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B83( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B83 call L0A59
+	AotPush16( chip8, 0x0b86 );
+	regs.pc = 0x0a59;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_0B86( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B86 jnz L0B83
+	regs.pc = ! regs.flags.z ? 0x0b83 : 0x0b89;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0B89( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B89 xra a
+	AluXor( regs, regs.accumulator );
+	// 0B8A sta 020C1H
+	AotWrite8( chip8, 0x20c1, regs.accumulator );
+	// 0B8D call L0AB1
+	AotPush16( chip8, 0x0b90 );
+	regs.pc = 0x0ab1;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0B90( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B90 call L1988
+	AotPush16( chip8, 0x0b93 );
+	regs.pc = 0x1988;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_0B93( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B93 mvi c,00CH
+	regs.gpr[ 0 ] = 0x0c;
+	// 0B95 lxi h,02C11H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2c11;
+	// 0B98 lxi d,01F90H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1f90;
+	// 0B9B call L08F3
+	AotPush16( chip8, 0x0b9e );
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0B9E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0B9E lda 020ECH
+	regs.accumulator = AotRead8( chip8, 0x20ec );
+	// 0BA1 cpi 000H
+	AluSubtract( regs, 0x00, 0 );
+	// 0BA3 jnz L0BAE
+	regs.pc = ! regs.flags.z ? 0x0bae : 0x0ba6;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_0BA6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BA6 lxi h,03311H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x3311;
+	// 0BA9 mvi a,002H
+	regs.accumulator = 0x02;
+	// 0BAB call L08FF
+	AotPush16( chip8, 0x0bae );
+	regs.pc = 0x08ff;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0BAE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BAE lxi b,01F9CH
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x1f9c;
+	// 0BB1 call L1856
+	AotPush16( chip8, 0x0bb4 );
+	regs.pc = 0x1856;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0BB4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BB4 call L184C
+	AotPush16( chip8, 0x0bb7 );
+	regs.pc = 0x184c;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0BB7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BB7 in 002H
+	regs.accumulator = IoRead( chip8, 0x02 );
+	// 0BB9 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 0BBA jc L0BC3
+	regs.pc = regs.flags.cy ? 0x0bc3 : 0x0bbd;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0BBD( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BBD lxi b,01FA0H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x1fa0;
+	// 0BC0 call L183A
+	AotPush16( chip8, 0x0bc3 );
+	regs.pc = 0x183a;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0BC3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BC3 call L0AB6
+	AotPush16( chip8, 0x0bc6 );
+	regs.pc = 0x0ab6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_0BC6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BC6 lda 020ECH
+	regs.accumulator = AotRead8( chip8, 0x20ec );
+	// 0BC9 cpi 000H
+	AluSubtract( regs, 0x00, 0 );
+	// 0BCB jnz L0BDA
+	regs.pc = ! regs.flags.z ? 0x0bda : 0x0bce;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0BCE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BCE lxi d,01FD5H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1fd5;
+	// 0BD1 call L0AE2
+	AotPush16( chip8, 0x0bd4 );
+	regs.pc = 0x0ae2;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0BD4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BD4 call L0A80
+	AotPush16( chip8, 0x0bd7 );
+	regs.pc = 0x0a80;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0BD7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BD7 call L189E
+	AotPush16( chip8, 0x0bda );
+	regs.pc = 0x189e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 6 of 6 instructions, calls.
+static void Block_0BDA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BDA lxi h,020ECH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20ec;
+	// 0BDD mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 0BDE inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 0BDF ani 001H
+	AluAnd( regs, 0x01 );
+	// 0BE1 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 0BE2 call L09D6
+	AotPush16( chip8, 0x0be5 );
+	regs.pc = 0x09d6;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0BE5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BE5 jmp L18DF
+	regs.pc = 0x18df;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_0BE8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BE8 lxi d,01DABH
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1dab;
+	// 0BEB call L0A93
+	AotPush16( chip8, 0x0bee );
+	regs.pc = 0x0a93;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0BEE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BEE jmp L0B0B
+	regs.pc = 0x0b0b;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_0BF1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BF1 call L190A
+	AotPush16( chip8, 0x0bf4 );
+	regs.pc = 0x190a;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_0BF4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 0BF4 jmp L199A
+	regs.pc = 0x199a;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_1400( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1400 nop
+	// 1401 call L1474
+	AotPush16( chip8, 0x1404 );
+	regs.pc = 0x1474;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_1404( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1404 nop
+	regs.pc = 0x1405;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 20 of 20 instructions, branches.
+static void Block_1405( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1405 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1406 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1407 ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	chip8.InstructionsSinceInterrupt += 3;
+	// 1408 out 004H
+	IoWrite( chip8, 0x04, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 140A in 003H
+	regs.accumulator = IoRead( chip8, 0x03 );
+	// 140C ora m
+	AluOr( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) );
+	// 140D mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 140E inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 140F inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 1410 xra a
+	AluXor( regs, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 6;
+	// 1411 out 004H
+	IoWrite( chip8, 0x04, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 1413 in 003H
+	regs.accumulator = IoRead( chip8, 0x03 );
+	// 1415 ora m
+	AluOr( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) );
+	// 1416 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 1417 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 1418 lxi b,00020H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0020;
+	// 141B dad b
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 141C pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 141D dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 141E jnz L1405
+	regs.pc = ! regs.flags.z ? 0x1405 : 0x1421;
+	chip8.InstructionsSinceInterrupt += 9;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1421( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1421 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1424( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1424 call L1474
+	AotPush16( chip8, 0x1427 );
+	regs.pc = 0x1474;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 13 of 13 instructions, branches.
+static void Block_1427( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1427 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1428 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1429 xra a
+	AluXor( regs, regs.accumulator );
+	// 142A mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 142B inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 142C mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 142D inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 142E pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 142F lxi b,00020H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0020;
+	// 1432 dad b
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1433 pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 1434 dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 1435 jnz L1427
+	regs.pc = ! regs.flags.z ? 0x1427 : 0x1438;
+	chip8.InstructionsSinceInterrupt += 13;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1438( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1438 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 9 of 9 instructions, branches.
+static void Block_1439( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1439 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 143A ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 143B mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 143C inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 143D lxi b,00020H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0020;
+	// 1440 dad b
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1441 pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 1442 dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 1443 jnz L1439
+	regs.pc = ! regs.flags.z ? 0x1439 : 0x1446;
+	chip8.InstructionsSinceInterrupt += 9;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1446( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1446 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1452( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1452 call L1474
+	AotPush16( chip8, 0x1455 );
+	regs.pc = 0x1474;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 22 of 22 instructions, branches.
+static void Block_1455( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1455 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1456 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1457 ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	chip8.InstructionsSinceInterrupt += 3;
+	// 1458 out 004H
+	IoWrite( chip8, 0x04, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 145A in 003H
+	regs.accumulator = IoRead( chip8, 0x03 );
+	// 145C cma
+	regs.accumulator = ~regs.accumulator;
+	// 145D ana m
+	AluAnd( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) );
+	// 145E mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 145F inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1460 inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 1461 xra a
+	AluXor( regs, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 7;
+	// 1462 out 004H
+	IoWrite( chip8, 0x04, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 1464 in 003H
+	regs.accumulator = IoRead( chip8, 0x03 );
+	// 1466 cma
+	regs.accumulator = ~regs.accumulator;
+	// 1467 ana m
+	AluAnd( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) );
+	// 1468 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 1469 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 146A lxi b,00020H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0020;
+	// 146D dad b
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 146E pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 146F dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 1470 jnz L1455
+	regs.pc = ! regs.flags.z ? 0x1455 : 0x1473;
+	chip8.InstructionsSinceInterrupt += 10;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1473( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1473 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_1474( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1474 mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 1475 ani 007H
+	AluAnd( regs, 0x07 );
+	chip8.InstructionsSinceInterrupt += 2;
+	// 1477 out 002H
+	IoWrite( chip8, 0x02, regs.accumulator );
+	// 1479 jmp L1A47
+	regs.pc = 0x1a47;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_147C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 147C push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 147D push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	regs.pc = 0x147e;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 6 of 6 instructions, branches.
+static void Block_147E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 147E mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 147F stax d
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ], regs.accumulator );
+	// 1480 inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 1481 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1482 dcr c
+	regs.gpr[ 0 ] = AluDecrement( regs, regs.gpr[ 0 ] );
+	// 1483 jnz L147E
+	regs.pc = ! regs.flags.z ? 0x147e : 0x1486;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 6 of 6 instructions, branches.
+static void Block_1486( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1486 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 1487 lxi b,00020H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0020;
+	// 148A dad b
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 148B pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 148C dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 148D jnz L147C
+	regs.pc = ! regs.flags.z ? 0x147c : 0x1490;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1490( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1490 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1491( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1491 call L1474
+	AotPush16( chip8, 0x1494 );
+	regs.pc = 0x1474;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_1494( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1494 xra a
+	AluXor( regs, regs.accumulator );
+	// 1495 sta 02061H
+	AotWrite8( chip8, 0x2061, regs.accumulator );
+	regs.pc = 0x1498;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 8 of 8 instructions, branches.
+static void Block_1498( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1498 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1499 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 149A ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	chip8.InstructionsSinceInterrupt += 3;
+	// 149B out 004H
+	IoWrite( chip8, 0x04, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 149D in 003H
+	regs.accumulator = IoRead( chip8, 0x03 );
+	// 149F push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 14A0 ana m
+	AluAnd( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) );
+	// 14A1 jz L14A9
+	regs.pc = regs.flags.z ? 0x14a9 : 0x14a4;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_14A4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14A4 mvi a,001H
+	regs.accumulator = 0x01;
+	// 14A6 sta 02061H
+	AotWrite8( chip8, 0x2061, regs.accumulator );
+	regs.pc = 0x14a9;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 11 of 11 instructions, branches.
+static void Block_14A9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14A9 pop psw
+	regs.flags.u8 = AotRead8( chip8, regs.sp );
+	regs.accumulator = AotRead8( chip8, regs.sp + 1 );
+	regs.sp += 2;
+	// 14AA ora m
+	AluOr( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) );
+	// 14AB mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 14AC inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 14AD inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 14AE xra a
+	AluXor( regs, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 6;
+	// 14AF out 004H
+	IoWrite( chip8, 0x04, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 14B1 in 003H
+	regs.accumulator = IoRead( chip8, 0x03 );
+	// 14B3 push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 14B4 ana m
+	AluAnd( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) );
+	// 14B5 jz L14BD
+	regs.pc = regs.flags.z ? 0x14bd : 0x14b8;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_14B8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14B8 mvi a,001H
+	regs.accumulator = 0x01;
+	// 14BA sta 02061H
+	AotWrite8( chip8, 0x2061, regs.accumulator );
+	regs.pc = 0x14bd;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 9 of 9 instructions, branches.
+static void Block_14BD( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14BD pop psw
+	regs.flags.u8 = AotRead8( chip8, regs.sp );
+	regs.accumulator = AotRead8( chip8, regs.sp + 1 );
+	regs.sp += 2;
+	// 14BE ora m
+	AluOr( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) );
+	// 14BF mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 14C0 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 14C1 lxi b,00020H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0020;
+	// 14C4 dad b
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 14C5 pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 14C6 dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 14C7 jnz L1498
+	regs.pc = ! regs.flags.z ? 0x1498 : 0x14ca;
+	chip8.InstructionsSinceInterrupt += 9;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_14CA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14CA ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_14CB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14CB xra a
+	AluXor( regs, regs.accumulator );
+	regs.pc = 0x14cc;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 7 of 7 instructions, branches.
+static void Block_14CC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14CC push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 14CD mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 14CE lxi b,00020H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0020;
+	// 14D1 dad b
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 14D2 pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 14D3 dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 14D4 jnz L14CC
+	regs.pc = ! regs.flags.z ? 0x14cc : 0x14d7;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_14D7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14D7 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_14D8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14D8 lda 02025H
+	regs.accumulator = AotRead8( chip8, 0x2025 );
+	// 14DB cpi 005H
+	AluSubtract( regs, 0x05, 0 );
+	// 14DD rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x14de;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_14DE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14DE cpi 002H
+	AluSubtract( regs, 0x02, 0 );
+	// 14E0 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x14e1;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_14E1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14E1 lda 02029H
+	regs.accumulator = AotRead8( chip8, 0x2029 );
+	// 14E4 cpi 0D8H
+	AluSubtract( regs, 0xd8, 0 );
+	// 14E6 mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 14E7 jnc L1530
+	regs.pc = ! regs.flags.cy ? 0x1530 : 0x14ea;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_14EA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14EA lda 02002H
+	regs.accumulator = AotRead8( chip8, 0x2002 );
+	// 14ED ana a
+	AluAnd( regs, regs.accumulator );
+	// 14EE rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x14ef;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_14EF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14EF mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 14F0 cpi 0CEH
+	AluSubtract( regs, 0xce, 0 );
+	// 14F2 jnc L1579
+	regs.pc = ! regs.flags.cy ? 0x1579 : 0x14f5;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_14F5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 14F5 adi 006H
+	AluAdd( regs, 0x06, 0 );
+	// 14F7 mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 14F8 lda 02009H
+	regs.accumulator = AotRead8( chip8, 0x2009 );
+	// 14FB cpi 090H
+	AluSubtract( regs, 0x90, 0 );
+	// 14FD jnc L1504
+	regs.pc = ! regs.flags.cy ? 0x1504 : 0x1500;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_1500( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1500 cmp b
+	AluSubtract( regs, regs.gpr[ 1 ], 0 );
+	// 1501 jnc L1530
+	regs.pc = ! regs.flags.cy ? 0x1530 : 0x1504;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_1504( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1504 mov l,b
+	regs.gpr[ 4 ] = regs.gpr[ 1 ];
+	// 1505 call L1562
+	AotPush16( chip8, 0x1508 );
+	regs.pc = 0x1562;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_1508( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1508 lda 0202AH
+	regs.accumulator = AotRead8( chip8, 0x202a );
+	// 150B mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 150C call L156F
+	AotPush16( chip8, 0x150f );
+	regs.pc = 0x156f;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_150F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 150F shld 02064H
+	AotWrite16( chip8, 0x2064, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1512 mvi a,005H
+	regs.accumulator = 0x05;
+	// 1514 sta 02025H
+	AotWrite8( chip8, 0x2025, regs.accumulator );
+	// 1517 call L1581
+	AotPush16( chip8, 0x151a );
+	regs.pc = 0x1581;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_151A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 151A mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 151B ana a
+	AluAnd( regs, regs.accumulator );
+	// 151C jz L1530
+	regs.pc = regs.flags.z ? 0x1530 : 0x151f;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_151F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 151F mvi m,000H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x00 );
+	// 1521 call L0A5F
+	AotPush16( chip8, 0x1524 );
+	regs.pc = 0x0a5f;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1524( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1524 call L1A3B
+	AotPush16( chip8, 0x1527 );
+	regs.pc = 0x1a3b;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1527( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1527 call L15D3
+	AotPush16( chip8, 0x152a );
+	regs.pc = 0x15d3;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_152A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 152A mvi a,010H
+	regs.accumulator = 0x10;
+	// 152C sta 02003H
+	AotWrite8( chip8, 0x2003, regs.accumulator );
+	// 152F ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_1530( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1530 mvi a,003H
+	regs.accumulator = 0x03;
+	// 1532 sta 02025H
+	AotWrite8( chip8, 0x2025, regs.accumulator );
+	// 1535 jmp L154A
+	regs.pc = 0x154a;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_1538( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1538 lxi h,02003H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2003;
+	// 153B dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 153C rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x153d;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_153D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 153D lhld 02064H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x2064 );
+	// 1540 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 1542 call L1424
+	AotPush16( chip8, 0x1545 );
+	regs.pc = 0x1424;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_1545( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1545 mvi a,004H
+	regs.accumulator = 0x04;
+	// 1547 sta 02025H
+	AotWrite8( chip8, 0x2025, regs.accumulator );
+	regs.pc = 0x154a;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_154A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 154A xra a
+	AluXor( regs, regs.accumulator );
+	// 154B sta 02002H
+	AotWrite8( chip8, 0x2002, regs.accumulator );
+	// 154E mvi b,0F7H
+	regs.gpr[ 1 ] = 0xf7;
+	// 1550 jmp L19DC
+	regs.pc = 0x19dc;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_1554( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1554 mvi c,000H
+	regs.gpr[ 0 ] = 0x00;
+	// 1556 cmp h
+	AluSubtract( regs, regs.gpr[ 5 ], 0 );
+	// 1557 cnc L1590
+	if ( ! regs.flags.cy )
+	{
+		AotPush16( chip8, 0x155a );
+		regs.pc = 0x1590;
+	}
+	else
+	{
+		regs.pc = 0x155a;
+	}
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_155A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 155A cmp h
+	AluSubtract( regs, regs.gpr[ 5 ], 0 );
+	// 155B rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x155c;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_155C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 155C adi 010H
+	AluAdd( regs, 0x10, 0 );
+	// 155E inr c
+	regs.gpr[ 0 ] = AluIncrement( regs, regs.gpr[ 0 ] );
+	// 155F jmp L155A
+	regs.pc = 0x155a;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_1562( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1562 lda 02009H
+	regs.accumulator = AotRead8( chip8, 0x2009 );
+	// 1565 mov h,l
+	regs.gpr[ 5 ] = regs.gpr[ 4 ];
+	// 1566 call L1554
+	AotPush16( chip8, 0x1569 );
+	regs.pc = 0x1554;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 5 of 5 instructions, returns.
+static void Block_1569( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1569 mov b,c
+	regs.gpr[ 1 ] = regs.gpr[ 0 ];
+	// 156A dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 156B sbi 010H
+	regs.accumulator = AluSubtract( regs, 0x10, regs.flags.cy );
+	// 156D mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 156E ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_156F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 156F lda 0200AH
+	regs.accumulator = AotRead8( chip8, 0x200a );
+	// 1572 call L1554
+	AotPush16( chip8, 0x1575 );
+	regs.pc = 0x1554;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_1575( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1575 sbi 010H
+	regs.accumulator = AluSubtract( regs, 0x10, regs.flags.cy );
+	// 1577 mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 1578 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_1579( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1579 mvi a,001H
+	regs.accumulator = 0x01;
+	// 157B sta 02085H
+	AotWrite8( chip8, 0x2085, regs.accumulator );
+	// 157E jmp L1545
+	regs.pc = 0x1545;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 13 of 13 instructions, returns.
+static void Block_1581( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1581 mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 1582 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 1583 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 1584 rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 1585 add b
+	AluAdd( regs, regs.gpr[ 1 ], 0 );
+	// 1586 add b
+	AluAdd( regs, regs.gpr[ 1 ], 0 );
+	// 1587 add b
+	AluAdd( regs, regs.gpr[ 1 ], 0 );
+	// 1588 add c
+	AluAdd( regs, regs.gpr[ 0 ], 0 );
+	// 1589 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 158A mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 158B lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 158E mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 158F ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 13;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_1590( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1590 inr c
+	regs.gpr[ 0 ] = AluIncrement( regs, regs.gpr[ 0 ] );
+	// 1591 adi 010H
+	AluAdd( regs, 0x10, 0 );
+	// 1593 jm L1590
+	regs.pc = regs.flags.s ? 0x1590 : 0x1596;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1596( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1596 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_1597( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1597 lda 0200DH
+	regs.accumulator = AotRead8( chip8, 0x200d );
+	// 159A ana a
+	AluAnd( regs, regs.accumulator );
+	// 159B jnz L15B7
+	regs.pc = ! regs.flags.z ? 0x15b7 : 0x159e;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_159E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 159E lxi h,03EA4H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x3ea4;
+	// 15A1 call L15C5
+	AotPush16( chip8, 0x15a4 );
+	regs.pc = 0x15c5;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, returns conditionally.
+static void Block_15A4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15A4 rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x15a5;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_15A5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15A5 mvi b,0FEH
+	regs.gpr[ 1 ] = 0xfe;
+	// 15A7 mvi a,001H
+	regs.accumulator = 0x01;
+	regs.pc = 0x15a9;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 6 of 6 instructions, returns.
+static void Block_15A9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15A9 sta 0200DH
+	AotWrite8( chip8, 0x200d, regs.accumulator );
+	// 15AC mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 15AD sta 02008H
+	AotWrite8( chip8, 0x2008, regs.accumulator );
+	// 15B0 lda 0200EH
+	regs.accumulator = AotRead8( chip8, 0x200e );
+	// 15B3 sta 02007H
+	AotWrite8( chip8, 0x2007, regs.accumulator );
+	// 15B6 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_15B7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15B7 lxi h,02524H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2524;
+	// 15BA call L15C5
+	AotPush16( chip8, 0x15bd );
+	regs.pc = 0x15c5;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, returns conditionally.
+static void Block_15BD( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15BD rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x15be;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_15BE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15BE call L18F1
+	AotPush16( chip8, 0x15c1 );
+	regs.pc = 0x18f1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_15C1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15C1 xra a
+	AluXor( regs, regs.accumulator );
+	// 15C2 jmp L15A9
+	regs.pc = 0x15a9;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_15C5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15C5 mvi b,017H
+	regs.gpr[ 1 ] = 0x17;
+	regs.pc = 0x15c7;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_15C7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15C7 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 15C8 ana a
+	AluAnd( regs, regs.accumulator );
+	// 15C9 jnz L166B
+	regs.pc = ! regs.flags.z ? 0x166b : 0x15cc;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_15CC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15CC inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 15CD dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 15CE jnz L15C7
+	regs.pc = ! regs.flags.z ? 0x15c7 : 0x15d1;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_15D1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15D1 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_15D3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15D3 call L1474
+	AotPush16( chip8, 0x15d6 );
+	regs.pc = 0x1474;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_15D6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15D6 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	regs.pc = 0x15d7;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 18 of 18 instructions, branches.
+static void Block_15D7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15D7 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 15D8 push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 15D9 ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	chip8.InstructionsSinceInterrupt += 3;
+	// 15DA out 004H
+	IoWrite( chip8, 0x04, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 15DC in 003H
+	regs.accumulator = IoRead( chip8, 0x03 );
+	// 15DE mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 15DF inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 15E0 inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 15E1 xra a
+	AluXor( regs, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 5;
+	// 15E2 out 004H
+	IoWrite( chip8, 0x04, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 15E4 in 003H
+	regs.accumulator = IoRead( chip8, 0x03 );
+	// 15E6 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 15E7 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 15E8 lxi b,00020H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0020;
+	// 15EB dad b
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 15EC pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 15ED dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 15EE jnz L15D7
+	regs.pc = ! regs.flags.z ? 0x15d7 : 0x15f1;
+	chip8.InstructionsSinceInterrupt += 8;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_15F1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15F1 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 15F2 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_15F3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15F3 call L1611
+	AotPush16( chip8, 0x15f6 );
+	regs.pc = 0x1611;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_15F6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15F6 lxi b,03700H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x3700;
+	regs.pc = 0x15f9;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_15F9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15F9 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 15FA ana a
+	AluAnd( regs, regs.accumulator );
+	// 15FB jz L15FF
+	regs.pc = regs.flags.z ? 0x15ff : 0x15fe;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_15FE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15FE inr c
+	regs.gpr[ 0 ] = AluIncrement( regs, regs.gpr[ 0 ] );
+	regs.pc = 0x15ff;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_15FF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 15FF inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1600 dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 1601 jnz L15F9
+	regs.pc = ! regs.flags.z ? 0x15f9 : 0x1604;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_1604( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1604 mov a,c
+	regs.accumulator = regs.gpr[ 0 ];
+	// 1605 sta 02082H
+	AotWrite8( chip8, 0x2082, regs.accumulator );
+	// 1608 cpi 001H
+	AluSubtract( regs, 0x01, 0 );
+	// 160A rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x160b;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_160B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 160B lxi h,0206BH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x206b;
+	// 160E mvi m,001H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x01 );
+	// 1610 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, returns.
+static void Block_1611( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1611 mvi l,000H
+	regs.gpr[ 4 ] = 0x00;
+	// 1613 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 1616 mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 1617 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_1618( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1618 lda 02015H
+	regs.accumulator = AotRead8( chip8, 0x2015 );
+	// 161B cpi 0FFH
+	AluSubtract( regs, 0xff, 0 );
+	// 161D rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x161e;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 6 of 6 instructions, returns conditionally.
+static void Block_161E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 161E lxi h,02010H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2010;
+	// 1621 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1622 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1623 mov b,m
+	regs.gpr[ 1 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1624 ora b
+	AluOr( regs, regs.gpr[ 1 ] );
+	// 1625 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x1626;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_1626( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1626 lda 02025H
+	regs.accumulator = AotRead8( chip8, 0x2025 );
+	// 1629 ana a
+	AluAnd( regs, regs.accumulator );
+	// 162A rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x162b;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_162B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 162B lda 020EFH
+	regs.accumulator = AotRead8( chip8, 0x20ef );
+	// 162E ana a
+	AluAnd( regs, regs.accumulator );
+	// 162F jz L1652
+	regs.pc = regs.flags.z ? 0x1652 : 0x1632;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_1632( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1632 lda 0202DH
+	regs.accumulator = AotRead8( chip8, 0x202d );
+	// 1635 ana a
+	AluAnd( regs, regs.accumulator );
+	// 1636 jnz L1648
+	regs.pc = ! regs.flags.z ? 0x1648 : 0x1639;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1639( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1639 call L17C0
+	AotPush16( chip8, 0x163c );
+	regs.pc = 0x17c0;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_163C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 163C ani 010H
+	AluAnd( regs, 0x10 );
+	// 163E rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x163f;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, returns.
+static void Block_163F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 163F mvi a,001H
+	regs.accumulator = 0x01;
+	// 1641 sta 02025H
+	AotWrite8( chip8, 0x2025, regs.accumulator );
+	// 1644 sta 0202DH
+	AotWrite8( chip8, 0x202d, regs.accumulator );
+	// 1647 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1648( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1648 call L17C0
+	AotPush16( chip8, 0x164b );
+	regs.pc = 0x17c0;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_164B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 164B ani 010H
+	AluAnd( regs, 0x10 );
+	// 164D rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x164e;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_164E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 164E sta 0202DH
+	AotWrite8( chip8, 0x202d, regs.accumulator );
+	// 1651 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 7 of 7 instructions, branches.
+static void Block_1652( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1652 lxi h,02025H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2025;
+	// 1655 mvi m,001H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x01 );
+	// 1657 lhld 020EDH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x20ed );
+	// 165A inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 165B mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 165C cpi 07EH
+	AluSubtract( regs, 0x7e, 0 );
+	// 165E jc L1663
+	regs.pc = regs.flags.cy ? 0x1663 : 0x1661;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_1661( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1661 mvi l,074H
+	regs.gpr[ 4 ] = 0x74;
+	regs.pc = 0x1663;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, returns.
+static void Block_1663( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1663 shld 020EDH
+	AotWrite16( chip8, 0x20ed, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1666 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1667 sta 0201DH
+	AotWrite8( chip8, 0x201d, regs.accumulator );
+	// 166A ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_166B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 166B stc
+	regs.flags.cy = 1;
+	// 166C ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_166D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 166D xra a
+	AluXor( regs, regs.accumulator );
+	// 166E call L1A8B
+	AotPush16( chip8, 0x1671 );
+	regs.pc = 0x1a8b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1671( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1671 call L1910
+	AotPush16( chip8, 0x1674 );
+	regs.pc = 0x1910;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_1674( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1674 mvi m,000H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x00 );
+	// 1676 call L09CA
+	AotPush16( chip8, 0x1679 );
+	regs.pc = 0x09ca;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 8 of 8 instructions, branches.
+static void Block_1679( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1679 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 167A lxi d,020F5H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x20f5;
+	// 167D ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 167E cmp m
+	AluSubtract( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ), 0 );
+	// 167F dcx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] -= 1;
+	// 1680 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 1681 ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 1682 jz L168B
+	regs.pc = regs.flags.z ? 0x168b : 0x1685;
+	chip8.InstructionsSinceInterrupt += 8;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_1685( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1685 jnc L1698
+	regs.pc = ! regs.flags.cy ? 0x1698 : 0x1688;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_1688( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1688 jmp L168F
+	regs.pc = 0x168f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_168B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 168B cmp m
+	AluSubtract( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ), 0 );
+	// 168C jnc L1698
+	regs.pc = ! regs.flags.cy ? 0x1698 : 0x168f;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 7 of 7 instructions, calls.
+static void Block_168F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 168F mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1690 stax d
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ], regs.accumulator );
+	// 1691 inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 1692 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1693 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1694 stax d
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ], regs.accumulator );
+	// 1695 call L1950
+	AotPush16( chip8, 0x1698 );
+	regs.pc = 0x1950;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_1698( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1698 lda 020CEH
+	regs.accumulator = AotRead8( chip8, 0x20ce );
+	// 169B ana a
+	AluAnd( regs, regs.accumulator );
+	// 169C jz L16C9
+	regs.pc = regs.flags.z ? 0x16c9 : 0x169f;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_169F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 169F lxi h,02803H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2803;
+	// 16A2 lxi d,01AA6H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1aa6;
+	// 16A5 mvi c,014H
+	regs.gpr[ 0 ] = 0x14;
+	// 16A7 call L0A93
+	AotPush16( chip8, 0x16aa );
+	regs.pc = 0x0a93;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 6 of 6 instructions, branches.
+static void Block_16AA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16AA dcr h
+	regs.gpr[ 5 ] = AluDecrement( regs, regs.gpr[ 5 ] );
+	// 16AB dcr h
+	regs.gpr[ 5 ] = AluDecrement( regs, regs.gpr[ 5 ] );
+	// 16AC mvi b,01BH
+	regs.gpr[ 1 ] = 0x1b;
+	// 16AE lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 16B1 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 16B2 jc L16B7
+	regs.pc = regs.flags.cy ? 0x16b7 : 0x16b5;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_16B5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16B5 mvi b,01CH
+	regs.gpr[ 1 ] = 0x1c;
+	regs.pc = 0x16b7;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_16B7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16B7 mov a,b
+	regs.accumulator = regs.gpr[ 1 ];
+	// 16B8 call L08FF
+	AotPush16( chip8, 0x16bb );
+	regs.pc = 0x08ff;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_16BB( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16BB call L0AB1
+	AotPush16( chip8, 0x16be );
+	regs.pc = 0x0ab1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_16BE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16BE call L18E7
+	AotPush16( chip8, 0x16c1 );
+	regs.pc = 0x18e7;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_16C1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16C1 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 16C2 ana a
+	AluAnd( regs, regs.accumulator );
+	// 16C3 jz L16C9
+	regs.pc = regs.flags.z ? 0x16c9 : 0x16c6;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_16C6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16C6 jmp L02ED
+	regs.pc = 0x02ed;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_16C9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16C9 lxi h,02D18H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2d18;
+	// 16CC lxi d,01AA6H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1aa6;
+	// 16CF mvi c,00AH
+	regs.gpr[ 0 ] = 0x0a;
+	// 16D1 call L0A93
+	AotPush16( chip8, 0x16d4 );
+	regs.pc = 0x0a93;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_16D4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16D4 call L0AB6
+	AotPush16( chip8, 0x16d7 );
+	regs.pc = 0x0ab6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_16D7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16D7 call L09D6
+	AotPush16( chip8, 0x16da );
+	regs.pc = 0x09d6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_16DA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16DA xra a
+	AluXor( regs, regs.accumulator );
+	// 16DB sta 020EFH
+	AotWrite8( chip8, 0x20ef, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 2;
+	// 16DE out 005H
+	IoWrite( chip8, 0x05, regs.accumulator );
+	// 16E0 call L19D1
+	AotPush16( chip8, 0x16e3 );
+	regs.pc = 0x19d1;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_16E3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16E3 jmp L0B89
+	regs.pc = 0x0b89;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 4 instructions, stops for the interpreter.
+static void Block_16E6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16E6 lxi sp,02400H
+	regs.sp = 0x2400;
+	regs.pc = 0x16e9;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_16EE( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16EE call L14D8
+	AotPush16( chip8, 0x16f1 );
+	regs.pc = 0x14d8;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_16F1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16F1 mvi b,004H
+	regs.gpr[ 1 ] = 0x04;
+	// 16F3 call L18FA
+	AotPush16( chip8, 0x16f6 );
+	regs.pc = 0x18fa;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_16F6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16F6 call L0A59
+	AotPush16( chip8, 0x16f9 );
+	regs.pc = 0x0a59;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_16F9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16F9 jnz L16EE
+	regs.pc = ! regs.flags.z ? 0x16ee : 0x16fc;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_16FC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16FC call L19D7
+	AotPush16( chip8, 0x16ff );
+	regs.pc = 0x19d7;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_16FF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 16FF lxi h,02701H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2701;
+	// 1702 call L19FA
+	AotPush16( chip8, 0x1705 );
+	regs.pc = 0x19fa;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_1705( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1705 xra a
+	AluXor( regs, regs.accumulator );
+	// 1706 call L1A8B
+	AotPush16( chip8, 0x1709 );
+	regs.pc = 0x1a8b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_1709( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1709 mvi b,0FBH
+	regs.gpr[ 1 ] = 0xfb;
+	// 170B jmp L196B
+	regs.pc = 0x196b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_170E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 170E call L09CA
+	AotPush16( chip8, 0x1711 );
+	regs.pc = 0x09ca;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 6 of 6 instructions, falls through.
+static void Block_1711( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1711 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1712 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1713 lxi d,01CB8H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1cb8;
+	// 1716 lxi h,01AA1H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x1aa1;
+	// 1719 mvi c,004H
+	regs.gpr[ 0 ] = 0x04;
+	// 171B mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	regs.pc = 0x171c;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_171C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 171C ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 171D cmp b
+	AluSubtract( regs, regs.gpr[ 1 ], 0 );
+	// 171E jnc L1727
+	regs.pc = ! regs.flags.cy ? 0x1727 : 0x1721;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_1721( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1721 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1722 inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 1723 dcr c
+	regs.gpr[ 0 ] = AluDecrement( regs, regs.gpr[ 0 ] );
+	// 1724 jnz L171C
+	regs.pc = ! regs.flags.z ? 0x171c : 0x1727;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_1727( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1727 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1728 sta 020CFH
+	AotWrite8( chip8, 0x20cf, regs.accumulator );
+	// 172B ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_172C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 172C lda 02025H
+	regs.accumulator = AotRead8( chip8, 0x2025 );
+	// 172F cpi 000H
+	AluSubtract( regs, 0x00, 0 );
+	// 1731 jnz L1739
+	regs.pc = ! regs.flags.z ? 0x1739 : 0x1734;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_1734( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1734 mvi b,0FDH
+	regs.gpr[ 1 ] = 0xfd;
+	// 1736 jmp L19DC
+	regs.pc = 0x19dc;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_1739( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1739 mvi b,002H
+	regs.gpr[ 1 ] = 0x02;
+	// 173B jmp L18FA
+	regs.pc = 0x18fa;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_1740( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1740 lxi h,0209BH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x209b;
+	// 1743 dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 1744 cz L176D
+	if ( regs.flags.z )
+	{
+		AotPush16( chip8, 0x1747 );
+		regs.pc = 0x176d;
+	}
+	else
+	{
+		regs.pc = 0x1747;
+	}
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_1747( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1747 lda 02068H
+	regs.accumulator = AotRead8( chip8, 0x2068 );
+	// 174A ana a
+	AluAnd( regs, regs.accumulator );
+	// 174B jz L176D
+	regs.pc = regs.flags.z ? 0x176d : 0x174e;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_174E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 174E lxi h,02096H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2096;
+	// 1751 dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 1752 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x1753;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 6 of 6 instructions, branches.
+static void Block_1753( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1753 lxi h,02098H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2098;
+	// 1756 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	chip8.InstructionsSinceInterrupt += 2;
+	// 1757 out 005H
+	IoWrite( chip8, 0x05, regs.accumulator );
+	// 1759 lda 02082H
+	regs.accumulator = AotRead8( chip8, 0x2082 );
+	// 175C ana a
+	AluAnd( regs, regs.accumulator );
+	// 175D jz L176D
+	regs.pc = regs.flags.z ? 0x176d : 0x1760;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 9 of 9 instructions, returns.
+static void Block_1760( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1760 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 1761 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1762 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 1763 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 1764 dcx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] -= 1;
+	// 1765 mvi m,001H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x01 );
+	// 1767 mvi a,004H
+	regs.accumulator = 0x04;
+	// 1769 sta 0209BH
+	AotWrite8( chip8, 0x209b, regs.accumulator );
+	// 176C ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 9;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_176D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 176D lda 02098H
+	regs.accumulator = AotRead8( chip8, 0x2098 );
+	regs.pc = 0x1770;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_1770( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1770 ani 030H
+	AluAnd( regs, 0x30 );
+	chip8.InstructionsSinceInterrupt += 1;
+	// 1772 out 005H
+	IoWrite( chip8, 0x05, regs.accumulator );
+	// 1774 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_1775( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1775 lda 02095H
+	regs.accumulator = AotRead8( chip8, 0x2095 );
+	// 1778 ana a
+	AluAnd( regs, regs.accumulator );
+	// 1779 jz L17AA
+	regs.pc = regs.flags.z ? 0x17aa : 0x177c;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, falls through.
+static void Block_177C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 177C lxi h,01A11H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x1a11;
+	// 177F lxi d,01A21H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1a21;
+	// 1782 lda 02082H
+	regs.accumulator = AotRead8( chip8, 0x2082 );
+	regs.pc = 0x1785;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_1785( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1785 cmp m
+	AluSubtract( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ), 0 );
+	// 1786 jnc L178E
+	regs.pc = ! regs.flags.cy ? 0x178e : 0x1789;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_1789( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1789 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 178A inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 178B jmp L1785
+	regs.pc = 0x1785;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 11 of 11 instructions, branches.
+static void Block_178E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 178E ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 178F sta 02097H
+	AotWrite8( chip8, 0x2097, regs.accumulator );
+	// 1792 lxi h,02098H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2098;
+	// 1795 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1796 ani 030H
+	AluAnd( regs, 0x30 );
+	// 1798 mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 1799 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 179A ani 00FH
+	AluAnd( regs, 0x0f );
+	// 179C rlc
+	regs.flags.cy = regs.accumulator >> 7;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator << 1 ) | regs.flags.cy );
+	// 179D cpi 010H
+	AluSubtract( regs, 0x10, 0 );
+	// 179F jnz L17A4
+	regs.pc = ! regs.flags.z ? 0x17a4 : 0x17a2;
+	chip8.InstructionsSinceInterrupt += 11;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_17A2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17A2 mvi a,001H
+	regs.accumulator = 0x01;
+	regs.pc = 0x17a4;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, falls through.
+static void Block_17A4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17A4 ora b
+	AluOr( regs, regs.gpr[ 1 ] );
+	// 17A5 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 17A6 xra a
+	AluXor( regs, regs.accumulator );
+	// 17A7 sta 02095H
+	AotWrite8( chip8, 0x2095, regs.accumulator );
+	regs.pc = 0x17aa;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_17AA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17AA lxi h,02099H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2099;
+	// 17AD dcr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluDecrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 17AE rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x17af;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_17AF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17AF mvi b,0EFH
+	regs.gpr[ 1 ] = 0xef;
+	// 17B1 jmp L19DC
+	regs.pc = 0x19dc;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_17C0( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17C0 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 17C3 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 17C4 jnc L17CA
+	regs.pc = ! regs.flags.cy ? 0x17ca : 0x17c7;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_17C7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17C7 in 001H
+	regs.accumulator = IoRead( chip8, 0x01 );
+	// 17C9 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_17CA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17CA in 002H
+	regs.accumulator = IoRead( chip8, 0x02 );
+	// 17CC ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_17CD( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17CD in 002H
+	regs.accumulator = IoRead( chip8, 0x02 );
+	// 17CF ani 004H
+	AluAnd( regs, 0x04 );
+	// 17D1 rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x17d2;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, returns conditionally.
+static void Block_17D2( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17D2 lda 0209AH
+	regs.accumulator = AotRead8( chip8, 0x209a );
+	// 17D5 ana a
+	AluAnd( regs, regs.accumulator );
+	// 17D6 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x17d7;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_17D7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17D7 lxi sp,02400H
+	regs.sp = 0x2400;
+	// 17DA mvi b,004H
+	regs.gpr[ 1 ] = 0x04;
+	regs.pc = 0x17dc;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_17DC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17DC call L09D6
+	AotPush16( chip8, 0x17df );
+	regs.pc = 0x09d6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_17DF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17DF dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 17E0 jnz L17DC
+	regs.pc = ! regs.flags.z ? 0x17dc : 0x17e3;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_17E3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17E3 mvi a,001H
+	regs.accumulator = 0x01;
+	// 17E5 sta 0209AH
+	AotWrite8( chip8, 0x209a, regs.accumulator );
+	// 17E8 call L19D7
+	AotPush16( chip8, 0x17eb );
+	regs.pc = 0x19d7;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_17F7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17F7 call L0AB1
+	AotPush16( chip8, 0x17fa );
+	regs.pc = 0x0ab1;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_17FA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 17FA xra a
+	AluXor( regs, regs.accumulator );
+	// 17FB sta 0209AH
+	AotWrite8( chip8, 0x209a, regs.accumulator );
+	// 17FE sta 02093H
+	AotWrite8( chip8, 0x2093, regs.accumulator );
+	// 1801 jmp L16C9
+	regs.pc = 0x16c9;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_1804( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1804 lxi h,02084H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2084;
+	// 1807 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1808 ana a
+	AluAnd( regs, regs.accumulator );
+	// 1809 jz L0707
+	regs.pc = regs.flags.z ? 0x0707 : 0x180c;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_180C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 180C inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 180D mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 180E ana a
+	AluAnd( regs, regs.accumulator );
+	// 180F rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x1810;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_1810( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1810 mvi b,001H
+	regs.gpr[ 1 ] = 0x01;
+	// 1812 jmp L18FA
+	regs.pc = 0x18fa;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_1815( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1815 lxi h,02810H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2810;
+	// 1818 lxi d,01CA3H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1ca3;
+	// 181B mvi c,015H
+	regs.gpr[ 0 ] = 0x15;
+	// 181D call L08F3
+	AotPush16( chip8, 0x1820 );
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, falls through.
+static void Block_1820( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1820 mvi a,00AH
+	regs.accumulator = 0x0a;
+	// 1822 sta 0206CH
+	AotWrite8( chip8, 0x206c, regs.accumulator );
+	// 1825 lxi b,01DBEH
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x1dbe;
+	regs.pc = 0x1828;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1828( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1828 call L1856
+	AotPush16( chip8, 0x182b );
+	regs.pc = 0x1856;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, branches.
+static void Block_182B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 182B jc L1837
+	regs.pc = regs.flags.cy ? 0x1837 : 0x182e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_182E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 182E call L1844
+	AotPush16( chip8, 0x1831 );
+	regs.pc = 0x1844;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_1831( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1831 jmp L1828
+	regs.pc = 0x1828;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_1837( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1837 lxi b,01DCFH
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x1dcf;
+	regs.pc = 0x183a;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_183A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 183A call L1856
+	AotPush16( chip8, 0x183d );
+	regs.pc = 0x1856;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, returns conditionally.
+static void Block_183D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 183D rc
+	regs.pc = regs.flags.cy ? AotPop16( chip8 ) : 0x183e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_183E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 183E call L184C
+	AotPush16( chip8, 0x1841 );
+	regs.pc = 0x184c;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_1841( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1841 jmp L183A
+	regs.pc = 0x183a;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_1844( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1844 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1845 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 1847 call L1439
+	AotPush16( chip8, 0x184a );
+	regs.pc = 0x1439;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_184A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 184A pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 184B ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_184C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 184C push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 184D lda 0206CH
+	regs.accumulator = AotRead8( chip8, 0x206c );
+	// 1850 mov c,a
+	regs.gpr[ 0 ] = regs.accumulator;
+	// 1851 call L0A93
+	AotPush16( chip8, 0x1854 );
+	regs.pc = 0x0a93;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_1854( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1854 pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 1855 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_1856( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1856 ldax b
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1857 cpi 0FFH
+	AluSubtract( regs, 0xff, 0 );
+	// 1859 stc
+	regs.flags.cy = 1;
+	// 185A rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x185b;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 13 of 13 instructions, returns.
+static void Block_185B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 185B mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 185C inx b
+	regs.gprPair[ AotRegisters::GprPair::BC ] += 1;
+	// 185D ldax b
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 185E mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 185F inx b
+	regs.gprPair[ AotRegisters::GprPair::BC ] += 1;
+	// 1860 ldax b
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1861 mov e,a
+	regs.gpr[ 2 ] = regs.accumulator;
+	// 1862 inx b
+	regs.gprPair[ AotRegisters::GprPair::BC ] += 1;
+	// 1863 ldax b
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1864 mov d,a
+	regs.gpr[ 3 ] = regs.accumulator;
+	// 1865 inx b
+	regs.gprPair[ AotRegisters::GprPair::BC ] += 1;
+	// 1866 ana a
+	AluAnd( regs, regs.accumulator );
+	// 1867 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 13;
+}
+
+// 5 of 5 instructions, calls.
+static void Block_1868( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1868 lxi h,020C2H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20c2;
+	// 186B inr m
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], AluIncrement( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) ) );
+	// 186C inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 186D mov c,m
+	regs.gpr[ 0 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 186E call L01D9
+	AotPush16( chip8, 0x1871 );
+	regs.pc = 0x01d9;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_1871( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1871 mov b,a
+	regs.gpr[ 1 ] = regs.accumulator;
+	// 1872 lda 020CAH
+	regs.accumulator = AotRead8( chip8, 0x20ca );
+	// 1875 cmp b
+	AluSubtract( regs, regs.gpr[ 1 ], 0 );
+	// 1876 jz L1898
+	regs.pc = regs.flags.z ? 0x1898 : 0x1879;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, branches.
+static void Block_1879( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1879 lda 020C2H
+	regs.accumulator = AotRead8( chip8, 0x20c2 );
+	// 187C ani 004H
+	AluAnd( regs, 0x04 );
+	// 187E lhld 020CCH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotRead16( chip8, 0x20cc );
+	// 1881 jnz L1888
+	regs.pc = ! regs.flags.z ? 0x1888 : 0x1884;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_1884( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1884 lxi d,00030H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x0030;
+	// 1887 dad d
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	regs.pc = 0x1888;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_1888( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1888 shld 020C7H
+	AotWrite16( chip8, 0x20c7, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 188B lxi h,020C5H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20c5;
+	// 188E call L1A3B
+	AotPush16( chip8, 0x1891 );
+	regs.pc = 0x1a3b;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_1891( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1891 xchg
+	{
+		const Uint16 de = regs.gprPair[ AotRegisters::GprPair::DE ];
+		regs.gprPair[ AotRegisters::GprPair::DE ] = regs.gprPair[ AotRegisters::GprPair::HL ];
+		regs.gprPair[ AotRegisters::GprPair::HL ] = de;
+	}
+	// 1892 jmp L15D3
+	regs.pc = 0x15d3;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, returns.
+static void Block_1898( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1898 mvi a,001H
+	regs.accumulator = 0x01;
+	// 189A sta 020CBH
+	AotWrite8( chip8, 0x20cb, regs.accumulator );
+	// 189D ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_189E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 189E lxi h,02050H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2050;
+	// 18A1 lxi d,01BC0H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1bc0;
+	// 18A4 mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 18A6 call L1A32
+	AotPush16( chip8, 0x18a9 );
+	regs.pc = 0x1a32;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 6 of 6 instructions, falls through.
+static void Block_18A9( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18A9 mvi a,002H
+	regs.accumulator = 0x02;
+	// 18AB sta 02080H
+	AotWrite8( chip8, 0x2080, regs.accumulator );
+	// 18AE mvi a,0FFH
+	regs.accumulator = 0xff;
+	// 18B0 sta 0207EH
+	AotWrite8( chip8, 0x207e, regs.accumulator );
+	// 18B3 mvi a,004H
+	regs.accumulator = 0x04;
+	// 18B5 sta 020C1H
+	AotWrite8( chip8, 0x20c1, regs.accumulator );
+	regs.pc = 0x18b8;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_18B8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18B8 lda 02055H
+	regs.accumulator = AotRead8( chip8, 0x2055 );
+	// 18BB ani 001H
+	AluAnd( regs, 0x01 );
+	// 18BD jz L18B8
+	regs.pc = regs.flags.z ? 0x18b8 : 0x18c0;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_18C0( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18C0 lda 02055H
+	regs.accumulator = AotRead8( chip8, 0x2055 );
+	// 18C3 ani 001H
+	AluAnd( regs, 0x01 );
+	// 18C5 jnz L18C0
+	regs.pc = ! regs.flags.z ? 0x18c0 : 0x18c8;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_18C8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18C8 lxi h,03311H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x3311;
+	// 18CB mvi a,026H
+	regs.accumulator = 0x26;
+	// 18CD nop
+	// 18CE call L08FF
+	AotPush16( chip8, 0x18d1 );
+	regs.pc = 0x08ff;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_18D1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18D1 jmp L0AB6
+	regs.pc = 0x0ab6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, calls.
+static void Block_18D4( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18D4 lxi sp,02400H
+	regs.sp = 0x2400;
+	// 18D7 mvi b,000H
+	regs.gpr[ 1 ] = 0x00;
+	// 18D9 call L01E6
+	AotPush16( chip8, 0x18dc );
+	regs.pc = 0x01e6;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_18DC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18DC call L1956
+	AotPush16( chip8, 0x18df );
+	regs.pc = 0x1956;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_18DF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18DF mvi a,008H
+	regs.accumulator = 0x08;
+	// 18E1 sta 020CFH
+	AotWrite8( chip8, 0x20cf, regs.accumulator );
+	// 18E4 jmp L0AEA
+	regs.pc = 0x0aea;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_18E7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18E7 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 18EA lxi h,020E7H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20e7;
+	// 18ED rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 18EE rnc
+	regs.pc = ! regs.flags.cy ? AotPop16( chip8 ) : 0x18ef;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_18EF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18EF inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 18F0 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_18F1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18F1 mvi b,002H
+	regs.gpr[ 1 ] = 0x02;
+	// 18F3 lda 02082H
+	regs.accumulator = AotRead8( chip8, 0x2082 );
+	// 18F6 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 18F7 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x18f8;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_18F8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18F8 inr b
+	regs.gpr[ 1 ] = AluIncrement( regs, regs.gpr[ 1 ] );
+	// 18F9 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 5 of 5 instructions, returns.
+static void Block_18FA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 18FA lda 02094H
+	regs.accumulator = AotRead8( chip8, 0x2094 );
+	// 18FD ora b
+	AluOr( regs, regs.gpr[ 1 ] );
+	// 18FE sta 02094H
+	AotWrite8( chip8, 0x2094, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 3;
+	// 1901 out 003H
+	IoWrite( chip8, 0x03, regs.accumulator );
+	// 1903 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_1904( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1904 lxi h,02200H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2200;
+	// 1907 jmp L01C3
+	regs.pc = 0x01c3;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_190A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 190A call L14D8
+	AotPush16( chip8, 0x190d );
+	regs.pc = 0x14d8;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_190D( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 190D jmp L1597
+	regs.pc = 0x1597;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_1910( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1910 lxi h,020E7H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20e7;
+	// 1913 lda 02067H
+	regs.accumulator = AotRead8( chip8, 0x2067 );
+	// 1916 rrc
+	regs.flags.cy = regs.accumulator & 1;
+	regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( regs.flags.cy << 7 ) );
+	// 1917 rc
+	regs.pc = regs.flags.cy ? AotPop16( chip8 ) : 0x1918;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_1918( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1918 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1919 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_191A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 191A mvi c,01CH
+	regs.gpr[ 0 ] = 0x1c;
+	// 191C lxi h,0241EH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x241e;
+	// 191F lxi d,01AE4H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1ae4;
+	// 1922 jmp L08F3
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_1925( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1925 lxi h,020F8H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20f8;
+	// 1928 jmp L1931
+	regs.pc = 0x1931;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_192B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 192B lxi h,020FCH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20fc;
+	// 192E jmp L1931
+	regs.pc = 0x1931;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 9 of 9 instructions, jumps.
+static void Block_1931( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1931 mov e,m
+	regs.gpr[ 2 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1932 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1933 mov d,m
+	regs.gpr[ 3 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1934 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1935 mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1936 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1937 mov h,m
+	regs.gpr[ 5 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1938 mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 1939 jmp L09AD
+	regs.pc = 0x09ad;
+	chip8.InstructionsSinceInterrupt += 9;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_193C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 193C mvi c,007H
+	regs.gpr[ 0 ] = 0x07;
+	// 193E lxi h,03501H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x3501;
+	// 1941 lxi d,01FA9H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1fa9;
+	// 1944 jmp L08F3
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_1947( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1947 lda 020EBH
+	regs.accumulator = AotRead8( chip8, 0x20eb );
+	// 194A lxi h,03C01H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x3c01;
+	// 194D jmp L09B2
+	regs.pc = 0x09b2;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_1950( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1950 lxi h,020F4H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x20f4;
+	// 1953 jmp L1931
+	regs.pc = 0x1931;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1956( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1956 call L1A5C
+	AotPush16( chip8, 0x1959 );
+	regs.pc = 0x1a5c;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1959( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1959 call L191A
+	AotPush16( chip8, 0x195c );
+	regs.pc = 0x191a;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_195C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 195C call L1925
+	AotPush16( chip8, 0x195f );
+	regs.pc = 0x1925;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_195F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 195F call L192B
+	AotPush16( chip8, 0x1962 );
+	regs.pc = 0x192b;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1962( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1962 call L1950
+	AotPush16( chip8, 0x1965 );
+	regs.pc = 0x1950;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1965( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1965 call L193C
+	AotPush16( chip8, 0x1968 );
+	regs.pc = 0x193c;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_1968( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1968 jmp L1947
+	regs.pc = 0x1947;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_196B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 196B call L19DC
+	AotPush16( chip8, 0x196e );
+	regs.pc = 0x19dc;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_196E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 196E jmp L1671
+	regs.pc = 0x1671;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_1971( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1971 mvi a,001H
+	regs.accumulator = 0x01;
+	// 1973 sta 0206DH
+	AotWrite8( chip8, 0x206d, regs.accumulator );
+	// 1976 jmp L16E6
+	regs.pc = 0x16e6;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1979( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1979 call L19D7
+	AotPush16( chip8, 0x197c );
+	regs.pc = 0x19d7;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_197C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 197C call L1947
+	AotPush16( chip8, 0x197f );
+	regs.pc = 0x1947;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_197F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 197F jmp L193C
+	regs.pc = 0x193c;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_1982( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1982 sta 020C1H
+	AotWrite8( chip8, 0x20c1, regs.accumulator );
+	// 1985 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 1 of 1 instructions, jumps.
+static void Block_1988( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1988 jmp L09D6
+	regs.pc = 0x09d6;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_199A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 199A lda 0201EH
+	regs.accumulator = AotRead8( chip8, 0x201e );
+	// 199D ana a
+	AluAnd( regs, regs.accumulator );
+	// 199E jnz L19AC
+	regs.pc = ! regs.flags.z ? 0x19ac : 0x19a1;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_19A1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19A1 in 001H
+	regs.accumulator = IoRead( chip8, 0x01 );
+	// 19A3 ani 076H
+	AluAnd( regs, 0x76 );
+	// 19A5 sui 072H
+	regs.accumulator = AluSubtract( regs, 0x72, 0 );
+	// 19A7 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x19a8;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_19A8( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19A8 inr a
+	regs.accumulator = AluIncrement( regs, regs.accumulator );
+	// 19A9 sta 0201EH
+	AotWrite8( chip8, 0x201e, regs.accumulator );
+	regs.pc = 0x19ac;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, returns conditionally.
+static void Block_19AC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19AC in 001H
+	regs.accumulator = IoRead( chip8, 0x01 );
+	// 19AE ani 076H
+	AluAnd( regs, 0x76 );
+	// 19B0 cpi 034H
+	AluSubtract( regs, 0x34, 0 );
+	// 19B2 rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x19b3;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 4 of 4 instructions, jumps.
+static void Block_19B3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19B3 lxi h,02E1BH
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2e1b;
+	// 19B6 lxi d,00BF7H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x0bf7;
+	// 19B9 mvi c,009H
+	regs.gpr[ 0 ] = 0x09;
+	// 19BB jmp L08F3
+	regs.pc = 0x08f3;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_19D1( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19D1 mvi a,001H
+	regs.accumulator = 0x01;
+	regs.pc = 0x19d3;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_19D3( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19D3 sta 020E9H
+	AotWrite8( chip8, 0x20e9, regs.accumulator );
+	// 19D6 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, jumps.
+static void Block_19D7( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19D7 xra a
+	AluXor( regs, regs.accumulator );
+	// 19D8 jmp L19D3
+	regs.pc = 0x19d3;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 5 of 5 instructions, returns.
+static void Block_19DC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19DC lda 02094H
+	regs.accumulator = AotRead8( chip8, 0x2094 );
+	// 19DF ana b
+	AluAnd( regs, regs.gpr[ 1 ] );
+	// 19E0 sta 02094H
+	AotWrite8( chip8, 0x2094, regs.accumulator );
+	chip8.InstructionsSinceInterrupt += 3;
+	// 19E3 out 003H
+	IoWrite( chip8, 0x03, regs.accumulator );
+	// 19E5 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 2 of 2 instructions, branches.
+static void Block_19E6( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19E6 lxi h,02701H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2701;
+	// 19E9 jz L19FA
+	regs.pc = regs.flags.z ? 0x19fa : 0x19ec;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_19EC( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19EC lxi d,01C60H
+	regs.gprPair[ AotRegisters::GprPair::DE ] = 0x1c60;
+	// 19EF mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 19F1 mov c,a
+	regs.gpr[ 0 ] = regs.accumulator;
+	// 19F2 call L1439
+	AotPush16( chip8, 0x19f5 );
+	regs.pc = 0x1439;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_19F5( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19F5 mov a,c
+	regs.accumulator = regs.gpr[ 0 ];
+	// 19F6 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 19F7 jnz L19EC
+	regs.pc = ! regs.flags.z ? 0x19ec : 0x19fa;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 2 of 2 instructions, calls.
+static void Block_19FA( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19FA mvi b,010H
+	regs.gpr[ 1 ] = 0x10;
+	// 19FC call L14CB
+	AotPush16( chip8, 0x19ff );
+	regs.pc = 0x14cb;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 3 of 3 instructions, branches.
+static void Block_19FF( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 19FF mov a,h
+	regs.accumulator = regs.gpr[ 5 ];
+	// 1A00 cpi 035H
+	AluSubtract( regs, 0x35, 0 );
+	// 1A02 jnz L19FA
+	regs.pc = ! regs.flags.z ? 0x19fa : 0x1a05;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1A05( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A05 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 6 of 6 instructions, returns conditionally.
+static void Block_1A06( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A06 lxi h,02072H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2072;
+	// 1A09 mov b,m
+	regs.gpr[ 1 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1A0A ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 1A0B ani 080H
+	AluAnd( regs, 0x80 );
+	// 1A0D xra b
+	AluXor( regs, regs.gpr[ 1 ] );
+	// 1A0E rnz
+	regs.pc = ! regs.flags.z ? AotPop16( chip8 ) : 0x1a0f;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 2 of 2 instructions, returns.
+static void Block_1A0F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A0F stc
+	regs.flags.cy = 1;
+	// 1A10 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 6 of 6 instructions, branches.
+static void Block_1A32( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A32 ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 1A33 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 1A34 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1A35 inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 1A36 dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 1A37 jnz L1A32
+	regs.pc = ! regs.flags.z ? 0x1a32 : 0x1a3a;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1A3A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A3A ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 12 of 12 instructions, returns.
+static void Block_1A3B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A3B mov e,m
+	regs.gpr[ 2 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1A3C inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1A3D mov d,m
+	regs.gpr[ 3 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1A3E inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1A3F mov a,m
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1A40 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1A41 mov c,m
+	regs.gpr[ 0 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1A42 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1A43 mov b,m
+	regs.gpr[ 1 ] = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	// 1A44 mov h,c
+	regs.gpr[ 5 ] = regs.gpr[ 0 ];
+	// 1A45 mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 1A46 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 12;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_1A47( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A47 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1A48 mvi b,003H
+	regs.gpr[ 1 ] = 0x03;
+	regs.pc = 0x1a4a;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 8 of 8 instructions, branches.
+static void Block_1A4A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A4A mov a,h
+	regs.accumulator = regs.gpr[ 5 ];
+	// 1A4B rar
+	{
+		const Uint8 msb = regs.flags.cy;
+		regs.flags.cy = regs.accumulator & 1;
+		regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( msb << 7 ) );
+	}
+	// 1A4C mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 1A4D mov a,l
+	regs.accumulator = regs.gpr[ 4 ];
+	// 1A4E rar
+	{
+		const Uint8 msb = regs.flags.cy;
+		regs.flags.cy = regs.accumulator & 1;
+		regs.accumulator = ( Uint8 )( ( regs.accumulator >> 1 ) | ( msb << 7 ) );
+	}
+	// 1A4F mov l,a
+	regs.gpr[ 4 ] = regs.accumulator;
+	// 1A50 dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 1A51 jnz L1A4A
+	regs.pc = ! regs.flags.z ? 0x1a4a : 0x1a54;
+	chip8.InstructionsSinceInterrupt += 8;
+}
+
+// 6 of 6 instructions, returns.
+static void Block_1A54( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A54 mov a,h
+	regs.accumulator = regs.gpr[ 5 ];
+	// 1A55 ani 03FH
+	AluAnd( regs, 0x3f );
+	// 1A57 ori 020H
+	AluOr( regs, 0x20 );
+	// 1A59 mov h,a
+	regs.gpr[ 5 ] = regs.accumulator;
+	// 1A5A pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 1A5B ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_1A5C( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A5C lxi h,02400H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2400;
+	regs.pc = 0x1a5f;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 5 of 5 instructions, branches.
+static void Block_1A5F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A5F mvi m,000H
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], 0x00 );
+	// 1A61 inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1A62 mov a,h
+	regs.accumulator = regs.gpr[ 5 ];
+	// 1A63 cpi 040H
+	AluSubtract( regs, 0x40, 0 );
+	// 1A65 jnz L1A5F
+	regs.pc = ! regs.flags.z ? 0x1a5f : 0x1a68;
+	chip8.InstructionsSinceInterrupt += 5;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1A68( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A68 ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, falls through.
+static void Block_1A69( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A69 push b
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1A6A push h
+	AotPush16( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] );
+	regs.pc = 0x1a6b;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 7 of 7 instructions, branches.
+static void Block_1A6B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A6B ldax d
+	regs.accumulator = AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::DE ] );
+	// 1A6C ora m
+	AluOr( regs, AotRead8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ] ) );
+	// 1A6D mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 1A6E inx d
+	regs.gprPair[ AotRegisters::GprPair::DE ] += 1;
+	// 1A6F inx h
+	regs.gprPair[ AotRegisters::GprPair::HL ] += 1;
+	// 1A70 dcr c
+	regs.gpr[ 0 ] = AluDecrement( regs, regs.gpr[ 0 ] );
+	// 1A71 jnz L1A6B
+	regs.pc = ! regs.flags.z ? 0x1a6b : 0x1a74;
+	chip8.InstructionsSinceInterrupt += 7;
+}
+
+// 6 of 6 instructions, branches.
+static void Block_1A74( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A74 pop h
+	regs.gprPair[ AotRegisters::GprPair::HL ] = AotPop16( chip8 );
+	// 1A75 lxi b,00020H
+	regs.gprPair[ AotRegisters::GprPair::BC ] = 0x0020;
+	// 1A78 dad b
+	AluDoubleAdd( regs, regs.gprPair[ AotRegisters::GprPair::BC ] );
+	// 1A79 pop b
+	regs.gprPair[ AotRegisters::GprPair::BC ] = AotPop16( chip8 );
+	// 1A7A dcr b
+	regs.gpr[ 1 ] = AluDecrement( regs, regs.gpr[ 1 ] );
+	// 1A7B jnz L1A69
+	regs.pc = ! regs.flags.z ? 0x1a69 : 0x1a7e;
+	chip8.InstructionsSinceInterrupt += 6;
+}
+
+// 1 of 1 instructions, returns.
+static void Block_1A7E( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A7E ret
+	regs.pc = AotPop16( chip8 );
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 1 of 1 instructions, calls.
+static void Block_1A7F( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A7F call L092E
+	AotPush16( chip8, 0x1a82 );
+	regs.pc = 0x092e;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 2 of 2 instructions, returns conditionally.
+static void Block_1A82( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A82 ana a
+	AluAnd( regs, regs.accumulator );
+	// 1A83 rz
+	regs.pc = regs.flags.z ? AotPop16( chip8 ) : 0x1a84;
+	chip8.InstructionsSinceInterrupt += 2;
+}
+
+// 4 of 4 instructions, calls.
+static void Block_1A84( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A84 push psw
+	AotWrite8( chip8, regs.sp - 1, regs.accumulator );
+	AotWrite8( chip8, regs.sp - 2, regs.flags.u8 );
+	regs.sp -= 2;
+	// 1A85 dcr a
+	regs.accumulator = AluDecrement( regs, regs.accumulator );
+	// 1A86 mov m,a
+	AotWrite8( chip8, regs.gprPair[ AotRegisters::GprPair::HL ], regs.accumulator );
+	// 1A87 call L19E6
+	AotPush16( chip8, 0x1a8a );
+	regs.pc = 0x19e6;
+	chip8.InstructionsSinceInterrupt += 4;
+}
+
+// 1 of 1 instructions, falls through.
+static void Block_1A8A( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A8A pop psw
+	regs.flags.u8 = AotRead8( chip8, regs.sp );
+	regs.accumulator = AotRead8( chip8, regs.sp + 1 );
+	regs.sp += 2;
+	regs.pc = 0x1a8b;
+	chip8.InstructionsSinceInterrupt += 1;
+}
+
+// 3 of 3 instructions, jumps.
+static void Block_1A8B( Cpu8080 & chip8 )
+{
+	AotRegisters & regs = chip8.Cpu.Regs;
+	// 1A8B lxi h,02501H
+	regs.gprPair[ AotRegisters::GprPair::HL ] = 0x2501;
+	// 1A8E ani 00FH
+	AluAnd( regs, 0x0f );
+	// 1A90 jmp L09C5
+	regs.pc = 0x09c5;
+	chip8.InstructionsSinceInterrupt += 3;
+}
+
+static const AotBlock kBlocks[ ] =
+{
+	{ 0x0000, 4, 0x0003, Block_0000 },
+	{ 0x0008, 5, 0x000c, Block_0008 },
+	{ 0x0010, 9, 0x001d, Block_0010 },
+	{ 0x0020, 3, 0x0023, Block_0020 },
+	{ 0x0026, 3, 0x002a, Block_0026 },
+	{ 0x002d, 3, 0x0032, Block_002D },
+	{ 0x0035, 4, 0x003b, Block_0035 },
+	{ 0x003e, 1, 0x003e, Block_003E },
+	{ 0x003f, 1, 0x003f, Block_003F },
+	{ 0x0042, 3, 0x0046, Block_0042 },
+	{ 0x0049, 3, 0x004d, Block_0049 },
+	{ 0x0050, 3, 0x0054, Block_0050 },
+	{ 0x0057, 1, 0x0057, Block_0057 },
+	{ 0x005a, 1, 0x005a, Block_005A },
+	{ 0x005d, 3, 0x0061, Block_005D },
+	{ 0x0064, 1, 0x0064, Block_0064 },
+	{ 0x0067, 3, 0x006c, Block_0067 },
+	{ 0x006f, 1, 0x006f, Block_006F },
+	{ 0x0072, 3, 0x0078, Block_0072 },
+	{ 0x007b, 1, 0x007b, Block_007B },
+	{ 0x007e, 1, 0x007e, Block_007E },
+	{ 0x0081, 1, 0x0081, Block_0081 },
+	{ 0x0082, 4, 0x0085, Block_0082 },
+	{ 0x008c, 5, 0x0094, Block_008C },
+	{ 0x0097, 3, 0x009b, Block_0097 },
+	{ 0x009e, 3, 0x00a2, Block_009E },
+	{ 0x00a5, 2, 0x00a8, Block_00A5 },
+	{ 0x00ab, 1, 0x00ab, Block_00AB },
+	{ 0x00ae, 1, 0x00ae, Block_00AE },
+	{ 0x00b1, 1, 0x00b1, Block_00B1 },
+	{ 0x00b4, 12, 0x00c4, Block_00B4 },
+	{ 0x00c7, 1, 0x00c7, Block_00C7 },
+	{ 0x00c8, 4, 0x00cf, Block_00C8 },
+	{ 0x00d2, 1, 0x00d2, Block_00D2 },
+	{ 0x00d3, 2, 0x00d6, Block_00D3 },
+	{ 0x00d7, 4, 0x00df, Block_00D7 },
+	{ 0x0100, 4, 0x0105, Block_0100 },
+	{ 0x0108, 9, 0x0114, Block_0108 },
+	{ 0x0117, 17, 0x012b, Block_0117 },
+	{ 0x012e, 3, 0x0133, Block_012E },
+	{ 0x0136, 3, 0x013a, Block_0136 },
+	{ 0x013b, 4, 0x0140, Block_013B },
+	{ 0x0141, 3, 0x0145, Block_0141 },
+	{ 0x0146, 3, 0x014a, Block_0146 },
+	{ 0x014b, 4, 0x0152, Block_014B },
+	{ 0x0154, 3, 0x0157, Block_0154 },
+	{ 0x015a, 4, 0x015d, Block_015A },
+	{ 0x0160, 2, 0x0163, Block_0160 },
+	{ 0x0166, 5, 0x016d, Block_0166 },
+	{ 0x0170, 5, 0x0179, Block_0170 },
+	{ 0x017a, 6, 0x0182, Block_017A },
+	{ 0x0183, 2, 0x0185, Block_0183 },
+	{ 0x0188, 8, 0x0191, Block_0188 },
+	{ 0x0194, 1, 0x0194, Block_0194 },
+	{ 0x0195, 2, 0x0196, Block_0195 },
+	{ 0x0197, 7, 0x019e, Block_0197 },
+	{ 0x01a1, 2, 0x01a2, Block_01A1 },
+	{ 0x01a5, 6, 0x01ae, Block_01A5 },
+	{ 0x01b1, 9, 0x01be, Block_01B1 },
+	{ 0x01c0, 1, 0x01c0, Block_01C0 },
+	{ 0x01c3, 1, 0x01c3, Block_01C3 },
+	{ 0x01c5, 4, 0x01c9, Block_01C5 },
+	{ 0x01cc, 1, 0x01cc, Block_01CC },
+	{ 0x01cd, 2, 0x01ce, Block_01CD },
+	{ 0x01cf, 4, 0x01d6, Block_01CF },
+	{ 0x01d9, 11, 0x01e3, Block_01D9 },
+	{ 0x01e4, 1, 0x01e4, Block_01E4 },
+	{ 0x01e6, 3, 0x01ec, Block_01E6 },
+	{ 0x01ef, 2, 0x01f2, Block_01EF },
+	{ 0x01f5, 1, 0x01f5, Block_01F5 },
+	{ 0x01f8, 2, 0x01fa, Block_01F8 },
+	{ 0x01fd, 3, 0x0200, Block_01FD },
+	{ 0x0203, 3, 0x0205, Block_0203 },
+	{ 0x0208, 1, 0x0208, Block_0208 },
+	{ 0x0209, 2, 0x020b, Block_0209 },
+	{ 0x020e, 2, 0x0210, Block_020E },
+	{ 0x0213, 1, 0x0213, Block_0213 },
+	{ 0x0214, 2, 0x0217, Block_0214 },
+	{ 0x021a, 1, 0x021a, Block_021A },
+	{ 0x021b, 1, 0x021b, Block_021B },
+	{ 0x021e, 4, 0x0227, Block_021E },
+	{ 0x0229, 5, 0x022f, Block_0229 },
+	{ 0x0232, 1, 0x0232, Block_0232 },
+	{ 0x0235, 4, 0x0238, Block_0235 },
+	{ 0x0239, 5, 0x023f, Block_0239 },
+	{ 0x0242, 1, 0x0242, Block_0242 },
+	{ 0x0245, 1, 0x0245, Block_0245 },
+	{ 0x0248, 1, 0x0248, Block_0248 },
+	{ 0x024b, 3, 0x024e, Block_024B },
+	{ 0x024f, 2, 0x0251, Block_024F },
+	{ 0x0254, 6, 0x0259, Block_0254 },
+	{ 0x025c, 4, 0x025f, Block_025C },
+	{ 0x0262, 11, 0x026e, Block_0262 },
+	{ 0x0277, 3, 0x0279, Block_0277 },
+	{ 0x027c, 1, 0x027c, Block_027C },
+	{ 0x027d, 4, 0x0280, Block_027D },
+	{ 0x0281, 3, 0x0285, Block_0281 },
+	{ 0x0288, 4, 0x028b, Block_0288 },
+	{ 0x028e, 5, 0x0293, Block_028E },
+	{ 0x0296, 3, 0x0298, Block_0296 },
+	{ 0x0299, 11, 0x02ab, Block_0299 },
+	{ 0x02ae, 3, 0x02b3, Block_02AE },
+	{ 0x02b6, 4, 0x02be, Block_02B6 },
+	{ 0x02c1, 2, 0x02c3, Block_02C1 },
+	{ 0x02c6, 3, 0x02ca, Block_02C6 },
+	{ 0x02cb, 3, 0x02cf, Block_02CB },
+	{ 0x02d0, 1, 0x02d0, Block_02D0 },
+	{ 0x02d7, 1, 0x02d7, Block_02D7 },
+	{ 0x02da, 2, 0x02db, Block_02DA },
+	{ 0x02de, 1, 0x02de, Block_02DE },
+	{ 0x02e1, 3, 0x02e3, Block_02E1 },
+	{ 0x02e6, 3, 0x02ea, Block_02E6 },
+	{ 0x02ed, 4, 0x02f2, Block_02ED },
+	{ 0x02f5, 1, 0x02f5, Block_02F5 },
+	{ 0x02f8, 1, 0x02f8, Block_02F8 },
+	{ 0x02fb, 8, 0x0302, Block_02FB },
+	{ 0x0305, 5, 0x030b, Block_0305 },
+	{ 0x030e, 2, 0x0310, Block_030E },
+	{ 0x0312, 2, 0x0315, Block_0312 },
+	{ 0x0318, 7, 0x0323, Block_0318 },
+	{ 0x0326, 1, 0x0326, Block_0326 },
+	{ 0x0329, 1, 0x0329, Block_0329 },
+	{ 0x032c, 1, 0x032c, Block_032C },
+	{ 0x032f, 1, 0x032f, Block_032F },
+	{ 0x0332, 1, 0x0332, Block_0332 },
+	{ 0x0335, 1, 0x0335, Block_0335 },
+	{ 0x033b, 6, 0x0343, Block_033B },
+	{ 0x0346, 3, 0x0348, Block_0346 },
+	{ 0x034a, 5, 0x0352, Block_034A },
+	{ 0x0355, 3, 0x0359, Block_0355 },
+	{ 0x035c, 2, 0x035d, Block_035C },
+	{ 0x0360, 1, 0x0360, Block_0360 },
+	{ 0x0363, 1, 0x0363, Block_0363 },
+	{ 0x0366, 3, 0x0368, Block_0366 },
+	{ 0x036b, 2, 0x036c, Block_036B },
+	{ 0x036f, 2, 0x0372, Block_036F },
+	{ 0x0375, 1, 0x0375, Block_0375 },
+	{ 0x0378, 1, 0x0378, Block_0378 },
+	{ 0x037b, 3, 0x0380, Block_037B },
+	{ 0x0381, 3, 0x0384, Block_0381 },
+	{ 0x0387, 3, 0x038b, Block_0387 },
+	{ 0x038e, 3, 0x0391, Block_038E },
+	{ 0x0394, 3, 0x0398, Block_0394 },
+	{ 0x039b, 12, 0x03ad, Block_039B },
+	{ 0x03b0, 1, 0x03b0, Block_03B0 },
+	{ 0x03b3, 3, 0x03b5, Block_03B3 },
+	{ 0x03b8, 1, 0x03b8, Block_03B8 },
+	{ 0x03bb, 2, 0x03be, Block_03BB },
+	{ 0x03c1, 2, 0x03c2, Block_03C1 },
+	{ 0x03c3, 4, 0x03c6, Block_03C3 },
+	{ 0x03c7, 2, 0x03c9, Block_03C7 },
+	{ 0x03cc, 2, 0x03ce, Block_03CC },
+	{ 0x03d1, 3, 0x03d4, Block_03D1 },
+	{ 0x03d7, 2, 0x03d8, Block_03D7 },
+	{ 0x03db, 3, 0x03de, Block_03DB },
+	{ 0x03df, 2, 0x03e0, Block_03DF },
+	{ 0x03e3, 1, 0x03e3, Block_03E3 },
+	{ 0x03e6, 14, 0x03f4, Block_03E6 },
+	{ 0x03f7, 1, 0x03f7, Block_03F7 },
+	{ 0x03fa, 6, 0x0404, Block_03FA },
+	{ 0x0407, 1, 0x0407, Block_0407 },
+	{ 0x040a, 1, 0x040a, Block_040A },
+	{ 0x040d, 4, 0x0410, Block_040D },
+	{ 0x0413, 8, 0x041e, Block_0413 },
+	{ 0x0421, 3, 0x0425, Block_0421 },
+	{ 0x0426, 2, 0x0429, Block_0426 },
+	{ 0x042a, 2, 0x042c, Block_042A },
+	{ 0x042d, 1, 0x042d, Block_042D },
+	{ 0x0430, 2, 0x0433, Block_0430 },
+	{ 0x0436, 1, 0x0436, Block_0436 },
+	{ 0x0439, 1, 0x0439, Block_0439 },
+	{ 0x043c, 4, 0x0444, Block_043C },
+	{ 0x0447, 5, 0x044e, Block_0447 },
+	{ 0x0451, 1, 0x0451, Block_0451 },
+	{ 0x0453, 7, 0x0461, Block_0453 },
+	{ 0x0462, 4, 0x0468, Block_0462 },
+	{ 0x046b, 1, 0x046b, Block_046B },
+	{ 0x046e, 6, 0x0475, Block_046E },
+	{ 0x0476, 7, 0x0482, Block_0476 },
+	{ 0x0485, 3, 0x0489, Block_0485 },
+	{ 0x048a, 3, 0x048f, Block_048A },
+	{ 0x0492, 5, 0x049e, Block_0492 },
+	{ 0x04a1, 4, 0x04a8, Block_04A1 },
+	{ 0x04ab, 4, 0x04b3, Block_04AB },
+	{ 0x04b6, 4, 0x04bb, Block_04B6 },
+	{ 0x04bc, 3, 0x04c1, Block_04BC },
+	{ 0x04c2, 3, 0x04c7, Block_04C2 },
+	{ 0x04ca, 5, 0x04d6, Block_04CA },
+	{ 0x04d9, 3, 0x04de, Block_04D9 },
+	{ 0x04e1, 2, 0x04e4, Block_04E1 },
+	{ 0x04e7, 4, 0x04ee, Block_04E7 },
+	{ 0x04f1, 4, 0x04f9, Block_04F1 },
+	{ 0x04fc, 3, 0x0500, Block_04FC },
+	{ 0x0503, 2, 0x0505, Block_0503 },
+	{ 0x0508, 2, 0x050b, Block_0508 },
+	{ 0x050e, 1, 0x050e, Block_050E },
+	{ 0x050f, 3, 0x0514, Block_050F },
+	{ 0x0517, 5, 0x0523, Block_0517 },
+	{ 0x0526, 3, 0x052b, Block_0526 },
+	{ 0x052e, 2, 0x0531, Block_052E },
+	{ 0x0534, 4, 0x053b, Block_0534 },
+	{ 0x053e, 4, 0x0546, Block_053E },
+	{ 0x0549, 3, 0x054f, Block_0549 },
+	{ 0x0550, 4, 0x0558, Block_0550 },
+	{ 0x055b, 3, 0x0560, Block_055B },
+	{ 0x0563, 4, 0x0569, Block_0563 },
+	{ 0x056c, 4, 0x0574, Block_056C },
+	{ 0x0577, 2, 0x0578, Block_0577 },
+	{ 0x0579, 5, 0x0580, Block_0579 },
+	{ 0x0583, 4, 0x0588, Block_0583 },
+	{ 0x0589, 3, 0x058d, Block_0589 },
+	{ 0x0590, 4, 0x0595, Block_0590 },
+	{ 0x0596, 4, 0x0599, Block_0596 },
+	{ 0x059c, 5, 0x05a2, Block_059C },
+	{ 0x05a5, 1, 0x05a5, Block_05A5 },
+	{ 0x05a8, 1, 0x05a8, Block_05A8 },
+	{ 0x05a9, 1, 0x05a9, Block_05A9 },
+	{ 0x05ac, 7, 0x05b4, Block_05AC },
+	{ 0x05b7, 7, 0x05c0, Block_05B7 },
+	{ 0x05c1, 2, 0x05c4, Block_05C1 },
+	{ 0x05c7, 1, 0x05c7, Block_05C7 },
+	{ 0x05c8, 4, 0x05cc, Block_05C8 },
+	{ 0x05cf, 3, 0x05d1, Block_05CF },
+	{ 0x05d4, 5, 0x05dd, Block_05D4 },
+	{ 0x05e0, 1, 0x05e0, Block_05E0 },
+	{ 0x05e2, 7, 0x05f0, Block_05E2 },
+	{ 0x05f3, 3, 0x05f8, Block_05F3 },
+	{ 0x05fb, 3, 0x05ff, Block_05FB },
+	{ 0x0600, 3, 0x0605, Block_0600 },
+	{ 0x0608, 3, 0x060b, Block_0608 },
+	{ 0x060e, 2, 0x060f, Block_060E },
+	{ 0x0612, 4, 0x061a, Block_0612 },
+	{ 0x061b, 4, 0x0621, Block_061B },
+	{ 0x0624, 3, 0x0627, Block_0624 },
+	{ 0x062a, 2, 0x062c, Block_062A },
+	{ 0x062f, 5, 0x0635, Block_062F },
+	{ 0x0637, 4, 0x063a, Block_0637 },
+	{ 0x063b, 5, 0x0640, Block_063B },
+	{ 0x0643, 1, 0x0643, Block_0643 },
+	{ 0x0644, 5, 0x064b, Block_0644 },
+	{ 0x064e, 1, 0x064e, Block_064E },
+	{ 0x0651, 11, 0x0664, Block_0651 },
+	{ 0x0667, 2, 0x0668, Block_0667 },
+	{ 0x0669, 1, 0x0669, Block_0669 },
+	{ 0x066c, 2, 0x066f, Block_066C },
+	{ 0x0672, 1, 0x0672, Block_0672 },
+	{ 0x0675, 2, 0x0678, Block_0675 },
+	{ 0x067b, 1, 0x067b, Block_067B },
+	{ 0x067e, 2, 0x0681, Block_067E },
+	{ 0x0682, 4, 0x0688, Block_0682 },
+	{ 0x0689, 4, 0x068e, Block_0689 },
+	{ 0x0691, 3, 0x0695, Block_0691 },
+	{ 0x0698, 4, 0x069b, Block_0698 },
+	{ 0x069e, 3, 0x06a3, Block_069E },
+	{ 0x06a6, 2, 0x06a8, Block_06A6 },
+	{ 0x06ab, 2, 0x06ae, Block_06AB },
+	{ 0x06b1, 1, 0x06b1, Block_06B1 },
+	{ 0x06b2, 4, 0x06b7, Block_06B2 },
+	{ 0x06ba, 7, 0x06c4, Block_06BA },
+	{ 0x06c7, 4, 0x06cd, Block_06C7 },
+	{ 0x06d0, 2, 0x06d2, Block_06D0 },
+	{ 0x06d5, 1, 0x06d5, Block_06D5 },
+	{ 0x06d6, 2, 0x06d8, Block_06D6 },
+	{ 0x06db, 5, 0x06e0, Block_06DB },
+	{ 0x06e3, 2, 0x06e5, Block_06E3 },
+	{ 0x06e8, 2, 0x06e9, Block_06E8 },
+	{ 0x06ea, 10, 0x06f8, Block_06EA },
+	{ 0x06f9, 1, 0x06f9, Block_06F9 },
+	{ 0x06fc, 1, 0x06fc, Block_06FC },
+	{ 0x06ff, 3, 0x0704, Block_06FF },
+	{ 0x0707, 2, 0x0709, Block_0707 },
+	{ 0x070c, 7, 0x071a, Block_070C },
+	{ 0x071d, 3, 0x071f, Block_071D },
+	{ 0x0722, 4, 0x0725, Block_0722 },
+	{ 0x0728, 10, 0x0736, Block_0728 },
+	{ 0x0739, 1, 0x0739, Block_0739 },
+	{ 0x073c, 1, 0x073c, Block_073C },
+	{ 0x073f, 1, 0x073f, Block_073F },
+	{ 0x0742, 2, 0x0745, Block_0742 },
+	{ 0x0748, 1, 0x0748, Block_0748 },
+	{ 0x074b, 6, 0x0753, Block_074B },
+	{ 0x0756, 3, 0x075c, Block_0756 },
+	{ 0x075f, 2, 0x0762, Block_075F },
+	{ 0x0765, 3, 0x076a, Block_0765 },
+	{ 0x0771, 1, 0x0771, Block_0771 },
+	{ 0x0774, 4, 0x077c, Block_0774 },
+	{ 0x077f, 5, 0x0788, Block_077F },
+	{ 0x078b, 2, 0x078e, Block_078B },
+	{ 0x0791, 3, 0x0795, Block_0791 },
+	{ 0x0798, 2, 0x079a, Block_0798 },
+	{ 0x079b, 6, 0x07a6, Block_079B },
+	{ 0x07a9, 4, 0x07b2, Block_07A9 },
+	{ 0x07b5, 1, 0x07b5, Block_07B5 },
+	{ 0x07b8, 1, 0x07b8, Block_07B8 },
+	{ 0x07bb, 6, 0x07c8, Block_07BB },
+	{ 0x07cb, 1, 0x07cb, Block_07CB },
+	{ 0x07ce, 1, 0x07ce, Block_07CE },
+	{ 0x07d1, 1, 0x07d1, Block_07D1 },
+	{ 0x07d4, 3, 0x07da, Block_07D4 },
+	{ 0x07dd, 4, 0x07e4, Block_07DD },
+	{ 0x07e7, 1, 0x07e7, Block_07E7 },
+	{ 0x07ea, 4, 0x07f3, Block_07EA },
+	{ 0x07f6, 1, 0x07f6, Block_07F6 },
+	{ 0x07f9, 1, 0x07f9, Block_07F9 },
+	{ 0x07fc, 1, 0x07fc, Block_07FC },
+	{ 0x07ff, 3, 0x0801, Block_07FF },
+	{ 0x0804, 1, 0x0804, Block_0804 },
+	{ 0x0807, 3, 0x080b, Block_0807 },
+	{ 0x080e, 1, 0x080e, Block_080E },
+	{ 0x0811, 1, 0x0811, Block_0811 },
+	{ 0x0814, 1, 0x0814, Block_0814 },
+	{ 0x0817, 1, 0x0817, Block_0817 },
+	{ 0x081a, 2, 0x081c, Block_081A },
+	{ 0x081f, 1, 0x081f, Block_081F },
+	{ 0x0822, 1, 0x0822, Block_0822 },
+	{ 0x0825, 1, 0x0825, Block_0825 },
+	{ 0x0828, 1, 0x0828, Block_0828 },
+	{ 0x082b, 3, 0x082f, Block_082B },
+	{ 0x0832, 1, 0x0832, Block_0832 },
+	{ 0x0835, 1, 0x0835, Block_0835 },
+	{ 0x0838, 1, 0x0838, Block_0838 },
+	{ 0x083b, 1, 0x083b, Block_083B },
+	{ 0x083e, 1, 0x083e, Block_083E },
+	{ 0x0841, 1, 0x0841, Block_0841 },
+	{ 0x0844, 2, 0x0846, Block_0844 },
+	{ 0x0849, 1, 0x0849, Block_0849 },
+	{ 0x084c, 2, 0x084e, Block_084C },
+	{ 0x0851, 1, 0x0851, Block_0851 },
+	{ 0x0857, 2, 0x085a, Block_0857 },
+	{ 0x085d, 5, 0x0863, Block_085D },
+	{ 0x0866, 2, 0x0867, Block_0866 },
+	{ 0x086a, 1, 0x086a, Block_086A },
+	{ 0x086d, 2, 0x086f, Block_086D },
+	{ 0x0872, 1, 0x0872, Block_0872 },
+	{ 0x0875, 1, 0x0875, Block_0875 },
+	{ 0x0878, 5, 0x0880, Block_0878 },
+	{ 0x0886, 4, 0x088c, Block_0886 },
+	{ 0x088d, 4, 0x0895, Block_088D },
+	{ 0x0898, 5, 0x08a1, Block_0898 },
+	{ 0x08a4, 2, 0x08a6, Block_08A4 },
+	{ 0x08a9, 3, 0x08ad, Block_08A9 },
+	{ 0x08ae, 2, 0x08b0, Block_08AE },
+	{ 0x08b3, 1, 0x08b3, Block_08B3 },
+	{ 0x08b6, 1, 0x08b6, Block_08B6 },
+	{ 0x08b9, 1, 0x08b9, Block_08B9 },
+	{ 0x08bc, 5, 0x08c5, Block_08BC },
+	{ 0x08c8, 1, 0x08c8, Block_08C8 },
+	{ 0x08cb, 1, 0x08cb, Block_08CB },
+	{ 0x08ce, 1, 0x08ce, Block_08CE },
+	{ 0x08d1, 4, 0x08d7, Block_08D1 },
+	{ 0x08d8, 3, 0x08dd, Block_08D8 },
+	{ 0x08de, 3, 0x08e3, Block_08DE },
+	{ 0x08e4, 3, 0x08e8, Block_08E4 },
+	{ 0x08e9, 3, 0x08ee, Block_08E9 },
+	{ 0x08f1, 1, 0x08f1, Block_08F1 },
+	{ 0x08f3, 3, 0x08f5, Block_08F3 },
+	{ 0x08f8, 4, 0x08fb, Block_08F8 },
+	{ 0x08fe, 1, 0x08fe, Block_08FE },
+	{ 0x08ff, 13, 0x0910, Block_08FF },
+	{ 0x0913, 3, 0x0918, Block_0913 },
+	{ 0x0919, 4, 0x091e, Block_0919 },
+	{ 0x0921, 3, 0x0926, Block_0921 },
+	{ 0x0929, 3, 0x092d, Block_0929 },
+	{ 0x092e, 1, 0x092e, Block_092E },
+	{ 0x0931, 3, 0x0934, Block_0931 },
+	{ 0x0935, 1, 0x0935, Block_0935 },
+	{ 0x0938, 5, 0x093c, Block_0938 },
+	{ 0x093d, 4, 0x0943, Block_093D },
+	{ 0x0946, 1, 0x0946, Block_0946 },
+	{ 0x0948, 1, 0x0948, Block_0948 },
+	{ 0x094b, 4, 0x094e, Block_094B },
+	{ 0x094f, 1, 0x094f, Block_094F },
+	{ 0x0952, 4, 0x0955, Block_0952 },
+	{ 0x0958, 4, 0x095b, Block_0958 },
+	{ 0x095e, 3, 0x0963, Block_095E },
+	{ 0x0966, 3, 0x0968, Block_0966 },
+	{ 0x096b, 1, 0x096b, Block_096B },
+	{ 0x096e, 7, 0x0979, Block_096E },
+	{ 0x097c, 3, 0x0981, Block_097C },
+	{ 0x0982, 3, 0x0985, Block_0982 },
+	{ 0x0986, 2, 0x0987, Block_0986 },
+	{ 0x0988, 1, 0x0988, Block_0988 },
+	{ 0x098b, 3, 0x098f, Block_098B },
+	{ 0x0990, 23, 0x09aa, Block_0990 },
+	{ 0x09ad, 2, 0x09ae, Block_09AD },
+	{ 0x09b1, 1, 0x09b1, Block_09B1 },
+	{ 0x09b2, 8, 0x09ba, Block_09B2 },
+	{ 0x09bd, 3, 0x09c0, Block_09BD },
+	{ 0x09c3, 2, 0x09c4, Block_09C3 },
+	{ 0x09c5, 2, 0x09c7, Block_09C5 },
+	{ 0x09ca, 4, 0x09d1, Block_09CA },
+	{ 0x09d2, 2, 0x09d5, Block_09D2 },
+	{ 0x09d6, 1, 0x09d6, Block_09D6 },
+	{ 0x09d9, 6, 0x09e1, Block_09D9 },
+	{ 0x09e4, 2, 0x09e7, Block_09E4 },
+	{ 0x09e8, 3, 0x09eb, Block_09E8 },
+	{ 0x09ee, 1, 0x09ee, Block_09EE },
+	{ 0x09ef, 1, 0x09ef, Block_09EF },
+	{ 0x09f2, 3, 0x09f6, Block_09F2 },
+	{ 0x09f9, 3, 0x09fd, Block_09F9 },
+	{ 0x0a00, 11, 0x0a10, Block_0A00 },
+	{ 0x0a13, 3, 0x0a15, Block_0A13 },
+	{ 0x0a18, 9, 0x0a22, Block_0A18 },
+	{ 0x0a25, 3, 0x0a2a, Block_0A25 },
+	{ 0x0a2d, 1, 0x0a2d, Block_0A2D },
+	{ 0x0a30, 1, 0x0a30, Block_0A30 },
+	{ 0x0a33, 1, 0x0a33, Block_0A33 },
+	{ 0x0a36, 1, 0x0a36, Block_0A36 },
+	{ 0x0a39, 1, 0x0a39, Block_0A39 },
+	{ 0x0a3c, 1, 0x0a3c, Block_0A3C },
+	{ 0x0a3f, 1, 0x0a3f, Block_0A3F },
+	{ 0x0a42, 2, 0x0a44, Block_0A42 },
+	{ 0x0a47, 3, 0x0a4b, Block_0A47 },
+	{ 0x0a4c, 1, 0x0a4c, Block_0A4C },
+	{ 0x0a4f, 1, 0x0a4f, Block_0A4F },
+	{ 0x0a52, 1, 0x0a52, Block_0A52 },
+	{ 0x0a55, 1, 0x0a55, Block_0A55 },
+	{ 0x0a58, 1, 0x0a58, Block_0A58 },
+	{ 0x0a59, 3, 0x0a5e, Block_0A59 },
+	{ 0x0a5f, 3, 0x0a63, Block_0A5F },
+	{ 0x0a66, 3, 0x0a69, Block_0A66 },
+	{ 0x0a6c, 3, 0x0a6e, Block_0A6C },
+	{ 0x0a71, 7, 0x0a7a, Block_0A71 },
+	{ 0x0a7c, 2, 0x0a7f, Block_0A7C },
+	{ 0x0a80, 2, 0x0a82, Block_0A80 },
+	{ 0x0a85, 4, 0x0a8b, Block_0A85 },
+	{ 0x0a8e, 3, 0x0a92, Block_0A8E },
+	{ 0x0a93, 3, 0x0a95, Block_0A93 },
+	{ 0x0a98, 3, 0x0a9b, Block_0A98 },
+	{ 0x0a9e, 3, 0x0aa2, Block_0A9E },
+	{ 0x0aa5, 3, 0x0aa7, Block_0AA5 },
+	{ 0x0aaa, 1, 0x0aaa, Block_0AAA },
+	{ 0x0aab, 2, 0x0aae, Block_0AAB },
+	{ 0x0ab1, 2, 0x0ab3, Block_0AB1 },
+	{ 0x0ab6, 2, 0x0ab8, Block_0AB6 },
+	{ 0x0abb, 2, 0x0abc, Block_0ABB },
+	{ 0x0abf, 3, 0x0ac3, Block_0ABF },
+	{ 0x0ac6, 2, 0x0ac7, Block_0AC6 },
+	{ 0x0aca, 2, 0x0acb, Block_0ACA },
+	{ 0x0ace, 1, 0x0ace, Block_0ACE },
+	{ 0x0acf, 3, 0x0ad4, Block_0ACF },
+	{ 0x0ad7, 1, 0x0ad7, Block_0AD7 },
+	{ 0x0ada, 3, 0x0ade, Block_0ADA },
+	{ 0x0ae1, 1, 0x0ae1, Block_0AE1 },
+	{ 0x0ae2, 3, 0x0ae7, Block_0AE2 },
+	{ 0x0aea, 4, 0x0aef, Block_0AEA },
+	{ 0x0af6, 5, 0x0aff, Block_0AF6 },
+	{ 0x0b02, 2, 0x0b05, Block_0B02 },
+	{ 0x0b08, 1, 0x0b08, Block_0B08 },
+	{ 0x0b0b, 1, 0x0b0b, Block_0B0B },
+	{ 0x0b0e, 1, 0x0b0e, Block_0B0E },
+	{ 0x0b11, 1, 0x0b11, Block_0B11 },
+	{ 0x0b14, 1, 0x0b14, Block_0B14 },
+	{ 0x0b17, 3, 0x0b1b, Block_0B17 },
+	{ 0x0b1e, 2, 0x0b21, Block_0B1E },
+	{ 0x0b24, 1, 0x0b24, Block_0B24 },
+	{ 0x0b27, 2, 0x0b2a, Block_0B27 },
+	{ 0x0b2d, 1, 0x0b2d, Block_0B2D },
+	{ 0x0b30, 1, 0x0b30, Block_0B30 },
+	{ 0x0b33, 2, 0x0b36, Block_0B33 },
+	{ 0x0b39, 1, 0x0b39, Block_0B39 },
+	{ 0x0b3c, 1, 0x0b3c, Block_0B3C },
+	{ 0x0b3f, 3, 0x0b44, Block_0B3F },
+	{ 0x0b47, 1, 0x0b47, Block_0B47 },
+	{ 0x0b4a, 1, 0x0b4a, Block_0B4A },
+	{ 0x0b4d, 3, 0x0b51, Block_0B4D },
+	{ 0x0b54, 1, 0x0b54, Block_0B54 },
+	{ 0x0b57, 2, 0x0b5a, Block_0B57 },
+	{ 0x0b5d, 1, 0x0b5d, Block_0B5D },
+	{ 0x0b60, 1, 0x0b60, Block_0B60 },
+	{ 0x0b63, 1, 0x0b63, Block_0B63 },
+	{ 0x0b66, 1, 0x0b66, Block_0B66 },
+	{ 0x0b69, 3, 0x0b6e, Block_0B69 },
+	{ 0x0b71, 1, 0x0b71, Block_0B71 },
+	{ 0x0b74, 1, 0x0b74, Block_0B74 },
+	{ 0x0b77, 2, 0x0b79, Block_0B77 },
+	{ 0x0b7c, 1, 0x0b7c, Block_0B7C },
+	{ 0x0b7f, 2, 0x0b80, Block_0B7F },
+	{ 0x0b83, 1, 0x0b83, Block_0B83 },
+	{ 0x0b86, 1, 0x0b86, Block_0B86 },
+	{ 0x0b89, 3, 0x0b8d, Block_0B89 },
+	{ 0x0b90, 1, 0x0b90, Block_0B90 },
+	{ 0x0b93, 4, 0x0b9b, Block_0B93 },
+	{ 0x0b9e, 3, 0x0ba3, Block_0B9E },
+	{ 0x0ba6, 3, 0x0bab, Block_0BA6 },
+	{ 0x0bae, 2, 0x0bb1, Block_0BAE },
+	{ 0x0bb4, 1, 0x0bb4, Block_0BB4 },
+	{ 0x0bb7, 3, 0x0bba, Block_0BB7 },
+	{ 0x0bbd, 2, 0x0bc0, Block_0BBD },
+	{ 0x0bc3, 1, 0x0bc3, Block_0BC3 },
+	{ 0x0bc6, 3, 0x0bcb, Block_0BC6 },
+	{ 0x0bce, 2, 0x0bd1, Block_0BCE },
+	{ 0x0bd4, 1, 0x0bd4, Block_0BD4 },
+	{ 0x0bd7, 1, 0x0bd7, Block_0BD7 },
+	{ 0x0bda, 6, 0x0be2, Block_0BDA },
+	{ 0x0be5, 1, 0x0be5, Block_0BE5 },
+	{ 0x0be8, 2, 0x0beb, Block_0BE8 },
+	{ 0x0bee, 1, 0x0bee, Block_0BEE },
+	{ 0x0bf1, 1, 0x0bf1, Block_0BF1 },
+	{ 0x0bf4, 1, 0x0bf4, Block_0BF4 },
+	{ 0x1400, 2, 0x1401, Block_1400 },
+	{ 0x1404, 1, 0x1404, Block_1404 },
+	{ 0x1405, 20, 0x141e, Block_1405 },
+	{ 0x1421, 1, 0x1421, Block_1421 },
+	{ 0x1424, 1, 0x1424, Block_1424 },
+	{ 0x1427, 13, 0x1435, Block_1427 },
+	{ 0x1438, 1, 0x1438, Block_1438 },
+	{ 0x1439, 9, 0x1443, Block_1439 },
+	{ 0x1446, 1, 0x1446, Block_1446 },
+	{ 0x1452, 1, 0x1452, Block_1452 },
+	{ 0x1455, 22, 0x1470, Block_1455 },
+	{ 0x1473, 1, 0x1473, Block_1473 },
+	{ 0x1474, 4, 0x1479, Block_1474 },
+	{ 0x147c, 2, 0x147d, Block_147C },
+	{ 0x147e, 6, 0x1483, Block_147E },
+	{ 0x1486, 6, 0x148d, Block_1486 },
+	{ 0x1490, 1, 0x1490, Block_1490 },
+	{ 0x1491, 1, 0x1491, Block_1491 },
+	{ 0x1494, 2, 0x1495, Block_1494 },
+	{ 0x1498, 8, 0x14a1, Block_1498 },
+	{ 0x14a4, 2, 0x14a6, Block_14A4 },
+	{ 0x14a9, 11, 0x14b5, Block_14A9 },
+	{ 0x14b8, 2, 0x14ba, Block_14B8 },
+	{ 0x14bd, 9, 0x14c7, Block_14BD },
+	{ 0x14ca, 1, 0x14ca, Block_14CA },
+	{ 0x14cb, 1, 0x14cb, Block_14CB },
+	{ 0x14cc, 7, 0x14d4, Block_14CC },
+	{ 0x14d7, 1, 0x14d7, Block_14D7 },
+	{ 0x14d8, 3, 0x14dd, Block_14D8 },
+	{ 0x14de, 2, 0x14e0, Block_14DE },
+	{ 0x14e1, 4, 0x14e7, Block_14E1 },
+	{ 0x14ea, 3, 0x14ee, Block_14EA },
+	{ 0x14ef, 3, 0x14f2, Block_14EF },
+	{ 0x14f5, 5, 0x14fd, Block_14F5 },
+	{ 0x1500, 2, 0x1501, Block_1500 },
+	{ 0x1504, 2, 0x1505, Block_1504 },
+	{ 0x1508, 3, 0x150c, Block_1508 },
+	{ 0x150f, 4, 0x1517, Block_150F },
+	{ 0x151a, 3, 0x151c, Block_151A },
+	{ 0x151f, 2, 0x1521, Block_151F },
+	{ 0x1524, 1, 0x1524, Block_1524 },
+	{ 0x1527, 1, 0x1527, Block_1527 },
+	{ 0x152a, 3, 0x152f, Block_152A },
+	{ 0x1530, 3, 0x1535, Block_1530 },
+	{ 0x1538, 3, 0x153c, Block_1538 },
+	{ 0x153d, 3, 0x1542, Block_153D },
+	{ 0x1545, 2, 0x1547, Block_1545 },
+	{ 0x154a, 4, 0x1550, Block_154A },
+	{ 0x1554, 3, 0x1557, Block_1554 },
+	{ 0x155a, 2, 0x155b, Block_155A },
+	{ 0x155c, 3, 0x155f, Block_155C },
+	{ 0x1562, 3, 0x1566, Block_1562 },
+	{ 0x1569, 5, 0x156e, Block_1569 },
+	{ 0x156f, 2, 0x1572, Block_156F },
+	{ 0x1575, 3, 0x1578, Block_1575 },
+	{ 0x1579, 3, 0x157e, Block_1579 },
+	{ 0x1581, 13, 0x158f, Block_1581 },
+	{ 0x1590, 3, 0x1593, Block_1590 },
+	{ 0x1596, 1, 0x1596, Block_1596 },
+	{ 0x1597, 3, 0x159b, Block_1597 },
+	{ 0x159e, 2, 0x15a1, Block_159E },
+	{ 0x15a4, 1, 0x15a4, Block_15A4 },
+	{ 0x15a5, 2, 0x15a7, Block_15A5 },
+	{ 0x15a9, 6, 0x15b6, Block_15A9 },
+	{ 0x15b7, 2, 0x15ba, Block_15B7 },
+	{ 0x15bd, 1, 0x15bd, Block_15BD },
+	{ 0x15be, 1, 0x15be, Block_15BE },
+	{ 0x15c1, 2, 0x15c2, Block_15C1 },
+	{ 0x15c5, 1, 0x15c5, Block_15C5 },
+	{ 0x15c7, 3, 0x15c9, Block_15C7 },
+	{ 0x15cc, 3, 0x15ce, Block_15CC },
+	{ 0x15d1, 1, 0x15d1, Block_15D1 },
+	{ 0x15d3, 1, 0x15d3, Block_15D3 },
+	{ 0x15d6, 1, 0x15d6, Block_15D6 },
+	{ 0x15d7, 18, 0x15ee, Block_15D7 },
+	{ 0x15f1, 2, 0x15f2, Block_15F1 },
+	{ 0x15f3, 1, 0x15f3, Block_15F3 },
+	{ 0x15f6, 1, 0x15f6, Block_15F6 },
+	{ 0x15f9, 3, 0x15fb, Block_15F9 },
+	{ 0x15fe, 1, 0x15fe, Block_15FE },
+	{ 0x15ff, 3, 0x1601, Block_15FF },
+	{ 0x1604, 4, 0x160a, Block_1604 },
+	{ 0x160b, 3, 0x1610, Block_160B },
+	{ 0x1611, 4, 0x1617, Block_1611 },
+	{ 0x1618, 3, 0x161d, Block_1618 },
+	{ 0x161e, 6, 0x1625, Block_161E },
+	{ 0x1626, 3, 0x162a, Block_1626 },
+	{ 0x162b, 3, 0x162f, Block_162B },
+	{ 0x1632, 3, 0x1636, Block_1632 },
+	{ 0x1639, 1, 0x1639, Block_1639 },
+	{ 0x163c, 2, 0x163e, Block_163C },
+	{ 0x163f, 4, 0x1647, Block_163F },
+	{ 0x1648, 1, 0x1648, Block_1648 },
+	{ 0x164b, 2, 0x164d, Block_164B },
+	{ 0x164e, 2, 0x1651, Block_164E },
+	{ 0x1652, 7, 0x165e, Block_1652 },
+	{ 0x1661, 1, 0x1661, Block_1661 },
+	{ 0x1663, 4, 0x166a, Block_1663 },
+	{ 0x166b, 2, 0x166c, Block_166B },
+	{ 0x166d, 2, 0x166e, Block_166D },
+	{ 0x1671, 1, 0x1671, Block_1671 },
+	{ 0x1674, 2, 0x1676, Block_1674 },
+	{ 0x1679, 8, 0x1682, Block_1679 },
+	{ 0x1685, 1, 0x1685, Block_1685 },
+	{ 0x1688, 1, 0x1688, Block_1688 },
+	{ 0x168b, 2, 0x168c, Block_168B },
+	{ 0x168f, 7, 0x1695, Block_168F },
+	{ 0x1698, 3, 0x169c, Block_1698 },
+	{ 0x169f, 4, 0x16a7, Block_169F },
+	{ 0x16aa, 6, 0x16b2, Block_16AA },
+	{ 0x16b5, 1, 0x16b5, Block_16B5 },
+	{ 0x16b7, 2, 0x16b8, Block_16B7 },
+	{ 0x16bb, 1, 0x16bb, Block_16BB },
+	{ 0x16be, 1, 0x16be, Block_16BE },
+	{ 0x16c1, 3, 0x16c3, Block_16C1 },
+	{ 0x16c6, 1, 0x16c6, Block_16C6 },
+	{ 0x16c9, 4, 0x16d1, Block_16C9 },
+	{ 0x16d4, 1, 0x16d4, Block_16D4 },
+	{ 0x16d7, 1, 0x16d7, Block_16D7 },
+	{ 0x16da, 4, 0x16e0, Block_16DA },
+	{ 0x16e3, 1, 0x16e3, Block_16E3 },
+	{ 0x16e6, 1, 0x16e6, Block_16E6 },
+	{ 0x16ee, 1, 0x16ee, Block_16EE },
+	{ 0x16f1, 2, 0x16f3, Block_16F1 },
+	{ 0x16f6, 1, 0x16f6, Block_16F6 },
+	{ 0x16f9, 1, 0x16f9, Block_16F9 },
+	{ 0x16fc, 1, 0x16fc, Block_16FC },
+	{ 0x16ff, 2, 0x1702, Block_16FF },
+	{ 0x1705, 2, 0x1706, Block_1705 },
+	{ 0x1709, 2, 0x170b, Block_1709 },
+	{ 0x170e, 1, 0x170e, Block_170E },
+	{ 0x1711, 6, 0x171b, Block_1711 },
+	{ 0x171c, 3, 0x171e, Block_171C },
+	{ 0x1721, 4, 0x1724, Block_1721 },
+	{ 0x1727, 3, 0x172b, Block_1727 },
+	{ 0x172c, 3, 0x1731, Block_172C },
+	{ 0x1734, 2, 0x1736, Block_1734 },
+	{ 0x1739, 2, 0x173b, Block_1739 },
+	{ 0x1740, 3, 0x1744, Block_1740 },
+	{ 0x1747, 3, 0x174b, Block_1747 },
+	{ 0x174e, 3, 0x1752, Block_174E },
+	{ 0x1753, 6, 0x175d, Block_1753 },
+	{ 0x1760, 9, 0x176c, Block_1760 },
+	{ 0x176d, 1, 0x176d, Block_176D },
+	{ 0x1770, 3, 0x1774, Block_1770 },
+	{ 0x1775, 3, 0x1779, Block_1775 },
+	{ 0x177c, 3, 0x1782, Block_177C },
+	{ 0x1785, 2, 0x1786, Block_1785 },
+	{ 0x1789, 3, 0x178b, Block_1789 },
+	{ 0x178e, 11, 0x179f, Block_178E },
+	{ 0x17a2, 1, 0x17a2, Block_17A2 },
+	{ 0x17a4, 4, 0x17a7, Block_17A4 },
+	{ 0x17aa, 3, 0x17ae, Block_17AA },
+	{ 0x17af, 2, 0x17b1, Block_17AF },
+	{ 0x17c0, 3, 0x17c4, Block_17C0 },
+	{ 0x17c7, 2, 0x17c9, Block_17C7 },
+	{ 0x17ca, 2, 0x17cc, Block_17CA },
+	{ 0x17cd, 3, 0x17d1, Block_17CD },
+	{ 0x17d2, 3, 0x17d6, Block_17D2 },
+	{ 0x17d7, 2, 0x17da, Block_17D7 },
+	{ 0x17dc, 1, 0x17dc, Block_17DC },
+	{ 0x17df, 2, 0x17e0, Block_17DF },
+	{ 0x17e3, 3, 0x17e8, Block_17E3 },
+	{ 0x17f7, 1, 0x17f7, Block_17F7 },
+	{ 0x17fa, 4, 0x1801, Block_17FA },
+	{ 0x1804, 4, 0x1809, Block_1804 },
+	{ 0x180c, 4, 0x180f, Block_180C },
+	{ 0x1810, 2, 0x1812, Block_1810 },
+	{ 0x1815, 4, 0x181d, Block_1815 },
+	{ 0x1820, 3, 0x1825, Block_1820 },
+	{ 0x1828, 1, 0x1828, Block_1828 },
+	{ 0x182b, 1, 0x182b, Block_182B },
+	{ 0x182e, 1, 0x182e, Block_182E },
+	{ 0x1831, 1, 0x1831, Block_1831 },
+	{ 0x1837, 1, 0x1837, Block_1837 },
+	{ 0x183a, 1, 0x183a, Block_183A },
+	{ 0x183d, 1, 0x183d, Block_183D },
+	{ 0x183e, 1, 0x183e, Block_183E },
+	{ 0x1841, 1, 0x1841, Block_1841 },
+	{ 0x1844, 3, 0x1847, Block_1844 },
+	{ 0x184a, 2, 0x184b, Block_184A },
+	{ 0x184c, 4, 0x1851, Block_184C },
+	{ 0x1854, 2, 0x1855, Block_1854 },
+	{ 0x1856, 4, 0x185a, Block_1856 },
+	{ 0x185b, 13, 0x1867, Block_185B },
+	{ 0x1868, 5, 0x186e, Block_1868 },
+	{ 0x1871, 4, 0x1876, Block_1871 },
+	{ 0x1879, 4, 0x1881, Block_1879 },
+	{ 0x1884, 2, 0x1887, Block_1884 },
+	{ 0x1888, 3, 0x188e, Block_1888 },
+	{ 0x1891, 2, 0x1892, Block_1891 },
+	{ 0x1898, 3, 0x189d, Block_1898 },
+	{ 0x189e, 4, 0x18a6, Block_189E },
+	{ 0x18a9, 6, 0x18b5, Block_18A9 },
+	{ 0x18b8, 3, 0x18bd, Block_18B8 },
+	{ 0x18c0, 3, 0x18c5, Block_18C0 },
+	{ 0x18c8, 4, 0x18ce, Block_18C8 },
+	{ 0x18d1, 1, 0x18d1, Block_18D1 },
+	{ 0x18d4, 3, 0x18d9, Block_18D4 },
+	{ 0x18dc, 1, 0x18dc, Block_18DC },
+	{ 0x18df, 3, 0x18e4, Block_18DF },
+	{ 0x18e7, 4, 0x18ee, Block_18E7 },
+	{ 0x18ef, 2, 0x18f0, Block_18EF },
+	{ 0x18f1, 4, 0x18f7, Block_18F1 },
+	{ 0x18f8, 2, 0x18f9, Block_18F8 },
+	{ 0x18fa, 5, 0x1903, Block_18FA },
+	{ 0x1904, 2, 0x1907, Block_1904 },
+	{ 0x190a, 1, 0x190a, Block_190A },
+	{ 0x190d, 1, 0x190d, Block_190D },
+	{ 0x1910, 4, 0x1917, Block_1910 },
+	{ 0x1918, 2, 0x1919, Block_1918 },
+	{ 0x191a, 4, 0x1922, Block_191A },
+	{ 0x1925, 2, 0x1928, Block_1925 },
+	{ 0x192b, 2, 0x192e, Block_192B },
+	{ 0x1931, 9, 0x1939, Block_1931 },
+	{ 0x193c, 4, 0x1944, Block_193C },
+	{ 0x1947, 3, 0x194d, Block_1947 },
+	{ 0x1950, 2, 0x1953, Block_1950 },
+	{ 0x1956, 1, 0x1956, Block_1956 },
+	{ 0x1959, 1, 0x1959, Block_1959 },
+	{ 0x195c, 1, 0x195c, Block_195C },
+	{ 0x195f, 1, 0x195f, Block_195F },
+	{ 0x1962, 1, 0x1962, Block_1962 },
+	{ 0x1965, 1, 0x1965, Block_1965 },
+	{ 0x1968, 1, 0x1968, Block_1968 },
+	{ 0x196b, 1, 0x196b, Block_196B },
+	{ 0x196e, 1, 0x196e, Block_196E },
+	{ 0x1971, 3, 0x1976, Block_1971 },
+	{ 0x1979, 1, 0x1979, Block_1979 },
+	{ 0x197c, 1, 0x197c, Block_197C },
+	{ 0x197f, 1, 0x197f, Block_197F },
+	{ 0x1982, 2, 0x1985, Block_1982 },
+	{ 0x1988, 1, 0x1988, Block_1988 },
+	{ 0x199a, 3, 0x199e, Block_199A },
+	{ 0x19a1, 4, 0x19a7, Block_19A1 },
+	{ 0x19a8, 2, 0x19a9, Block_19A8 },
+	{ 0x19ac, 4, 0x19b2, Block_19AC },
+	{ 0x19b3, 4, 0x19bb, Block_19B3 },
+	{ 0x19d1, 1, 0x19d1, Block_19D1 },
+	{ 0x19d3, 2, 0x19d6, Block_19D3 },
+	{ 0x19d7, 2, 0x19d8, Block_19D7 },
+	{ 0x19dc, 5, 0x19e5, Block_19DC },
+	{ 0x19e6, 2, 0x19e9, Block_19E6 },
+	{ 0x19ec, 4, 0x19f2, Block_19EC },
+	{ 0x19f5, 3, 0x19f7, Block_19F5 },
+	{ 0x19fa, 2, 0x19fc, Block_19FA },
+	{ 0x19ff, 3, 0x1a02, Block_19FF },
+	{ 0x1a05, 1, 0x1a05, Block_1A05 },
+	{ 0x1a06, 6, 0x1a0e, Block_1A06 },
+	{ 0x1a0f, 2, 0x1a10, Block_1A0F },
+	{ 0x1a32, 6, 0x1a37, Block_1A32 },
+	{ 0x1a3a, 1, 0x1a3a, Block_1A3A },
+	{ 0x1a3b, 12, 0x1a46, Block_1A3B },
+	{ 0x1a47, 2, 0x1a48, Block_1A47 },
+	{ 0x1a4a, 8, 0x1a51, Block_1A4A },
+	{ 0x1a54, 6, 0x1a5b, Block_1A54 },
+	{ 0x1a5c, 1, 0x1a5c, Block_1A5C },
+	{ 0x1a5f, 5, 0x1a65, Block_1A5F },
+	{ 0x1a68, 1, 0x1a68, Block_1A68 },
+	{ 0x1a69, 2, 0x1a6a, Block_1A69 },
+	{ 0x1a6b, 7, 0x1a71, Block_1A6B },
+	{ 0x1a74, 6, 0x1a7b, Block_1A74 },
+	{ 0x1a7e, 1, 0x1a7e, Block_1A7E },
+	{ 0x1a7f, 1, 0x1a7f, Block_1A7F },
+	{ 0x1a82, 2, 0x1a83, Block_1A82 },
+	{ 0x1a84, 4, 0x1a87, Block_1A84 },
+	{ 0x1a8a, 1, 0x1a8a, Block_1A8A },
+	{ 0x1a8b, 3, 0x1a90, Block_1A8B },
+};
+
+const AotProgram kInvadersAot =
+{
+	0x3a10cf06u,
+	kBlocks,
+	sizeof( kBlocks ) / sizeof( kBlocks[ 0 ] ),
+};
@@ -0,0 +1,85 @@
+#include "IoBus.h"
+#include "Cpu8080.h"
+
+IoBus g_IoBus;
+
+// ------------------------------------------------------------
+// Devices.
+// ------------------------------------------------------------
+
+static Uint8 UnmappedRead( Cpu8080 & chip8, Uint8 port )
+{
+	return 0;
+}
+
+static void UnmappedWrite( Cpu8080 & chip8, Uint8 port, Uint8 value )
+{
+}
+
+static Uint8 InputRead( Cpu8080 & chip8, Uint8 port )
+{
+	return chip8.Io.Inputs[ port ];
+}
+
+static void ShifterDataWrite( Cpu8080 & chip8, Uint8 port, Uint8 value )
+{
+	ShiftRegister & shifter = chip8.Io.Shifter;
+	shifter.Value = ( Uint16 )( ( value << 8 ) | ( shifter.Value >> 8 ) );
+}
+
+static void ShifterOffsetWrite( Cpu8080 & chip8, Uint8 port, Uint8 value )
+{
+	chip8.Io.Shifter.Offset = value & 0x7;
+}
+
+static Uint8 ShifterRead( Cpu8080 & chip8, Uint8 port )
+{
+	const ShiftRegister & shifter = chip8.Io.Shifter;
+	return ( Uint8 )( shifter.Value >> ( 8 - shifter.Offset ) );
+}
+
+static void SoundWrite( Cpu8080 & chip8, Uint8 port, Uint8 value )
+{
+	// Port 3 -> latch 0, port 5 -> latch 1.
+	chip8.Io.Sound[ port == 5 ] = value;
+}
+
+static void WatchdogWrite( Cpu8080 & chip8, Uint8 port, Uint8 value )
+{
+	chip8.Io.Watchdog = value;
+	chip8.Io.WatchdogKicks++;
+}
+
+// ------------------------------------------------------------
+// Bus.
+// ------------------------------------------------------------
+
+IoBus::IoBus( )
+{
+	for ( size_t ix = 0; ix < 256; ++ix )
+	{
+		Read[ ix ] = UnmappedRead;
+		Write[ ix ] = UnmappedWrite;
+	}
+
+	MapRead( 0, InputRead );
+	MapRead( 1, InputRead );
+	MapRead( 2, InputRead );
+	MapRead( 3, ShifterRead );
+
+	MapWrite( 2, ShifterOffsetWrite );
+	MapWrite( 3, SoundWrite );
+	MapWrite( 4, ShifterDataWrite );
+	MapWrite( 5, SoundWrite );
+	MapWrite( 6, WatchdogWrite );
+}
+
+void IoBus::MapRead( Uint8 port, IoReadHandler handler )
+{
+	Read[ port ] = handler;
+}
+
+void IoBus::MapWrite( Uint8 port, IoWriteHandler handler )
+{
+	Write[ port ] = handler;
+}
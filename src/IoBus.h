@@ -0,0 +1,66 @@
+#pragma once
+
+#include <SDL.h>
+
+struct Cpu8080;
+
+// ------------------------------------------------------------
+// I/O bus.
+//
+// IN and OUT dispatch through a 256 entry handler table per direction, so
+// devices can be added by mapping ports rather than growing the interpreter.
+// Device state lives in the machine (Cpu8080::Io) so machines can still be
+// copied; the wiring (g_IoBus) is the same for every machine.
+// ------------------------------------------------------------
+
+typedef Uint8 ( * IoReadHandler )( Cpu8080 & chip8, Uint8 port );
+typedef void ( * IoWriteHandler )( Cpu8080 & chip8, Uint8 port, Uint8 value );
+
+// Midway's 16 bit barrel shifter: OUT 4 shifts a byte in from the top, OUT 2 sets the offset, IN 3 reads 8 bits at that offset.
+struct ShiftRegister
+{
+	Uint16	Value;
+	Uint8	Offset;
+};
+
+// IN 1 bits.
+static const Uint8 kInputCoin = 1 << 0;
+static const Uint8 kInputTwoPlayerStart = 1 << 1;
+static const Uint8 kInputOnePlayerStart = 1 << 2;
+static const Uint8 kInputFire = 1 << 4;
+static const Uint8 kInputLeft = 1 << 5;
+static const Uint8 kInputRight = 1 << 6;
+
+// State of every device on the invaders board.
+struct IoDevices
+{
+	Uint8			Inputs[ 3 ];	// IN 0-2 (IN 1 is coin, start and player 1, IN 2 dip switches and player 2).
+	ShiftRegister	Shifter;		// OUT 2, OUT 4, IN 3.
+	Uint8			Sound[ 2 ];		// OUT 3, OUT 5.
+	Uint8			Watchdog;		// OUT 6.
+	Uint32			WatchdogKicks;
+};
+
+struct IoBus
+{
+	// Maps the invaders board; unmapped ports read 0 and ignore writes.
+	IoBus( );
+
+	void MapRead( Uint8 port, IoReadHandler handler );
+	void MapWrite( Uint8 port, IoWriteHandler handler );
+
+	IoReadHandler	Read[ 256 ];
+	IoWriteHandler	Write[ 256 ];
+};
+
+extern IoBus g_IoBus;
+
+inline Uint8 IoRead( Cpu8080 & chip8, Uint8 port )
+{
+	return g_IoBus.Read[ port ]( chip8, port );
+}
+
+inline void IoWrite( Cpu8080 & chip8, Uint8 port, Uint8 value )
+{
+	g_IoBus.Write[ port ]( chip8, port, value );
+}
@@ -0,0 +1,509 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "Lockstep.h"
+#include "Hle.h"
+#include "Alu.h"
+#include "Aot.h"
+#include "Fuse.h"
+
+typedef Cpu8080::CommandProcessingUnit::Registers Registers;
+
+// ------------------------------------------------------------
+// Engines.
+// ------------------------------------------------------------
+
+// Every opcode decoded by the interpreter's switch, without the handler table: the reference the other engines (the
+// interpreter included) are checked against.
+static void StepReference( Cpu8080 & chip8 )
+{
+	const bool hleEnabled = chip8.HleEnabled;
+	chip8.HleEnabled = false;
+	StepCpuReference( chip8 );
+	chip8.HleEnabled = hleEnabled;
+}
+
+// The interpreter on its own.
+static void StepInterpreter( Cpu8080 & chip8 )
+{
+	const bool hleEnabled = chip8.HleEnabled;
+	chip8.HleEnabled = false;
+	StepCpu( chip8 );
+	chip8.HleEnabled = hleEnabled;
+}
+
+// The interpreter a straight-line block at a time.
+static void StepInterpreterBlocks( Cpu8080 & chip8 )
+{
+	const bool hleEnabled = chip8.HleEnabled;
+	chip8.HleEnabled = false;
+	StepCpuBlock( chip8 );
+	chip8.HleEnabled = hleEnabled;
+}
+
+// The interpreter with the installed HLE routines standing in for whole ROM routines at a time.
+static void StepHle( Cpu8080 & chip8 )
+{
+	StepCpu( chip8 );
+}
+
+// The interpreter taking ALU results and flags from the precomputed tables.
+static void StepAluTables( Cpu8080 & chip8 )
+{
+	assert( g_AluTables );
+	const bool hleEnabled = chip8.HleEnabled;
+	chip8.HleEnabled = false;
+	chip8.AluTablesEnabled = true;
+	StepCpu( chip8 );
+	chip8.AluTablesEnabled = false;
+	chip8.HleEnabled = hleEnabled;
+}
+
+static void InitAluTablesEngine( const Uint8 * )
+{
+	InitAluTables( );
+}
+
+static void InitAot( const Uint8 * rom )
+{
+	InitAotEngine( rom );
+}
+
+static void InitFused( const Uint8 * rom )
+{
+	InitFusedEngine( rom );
+}
+
+static const CpuEngine kCpuEngines[ ] =
+{
+	{ "reference",		StepReference,			NULL },
+	{ "interpreter",	StepInterpreter,		NULL },
+	{ "blocks",			StepInterpreterBlocks,	NULL },
+	{ "hle",			StepHle,				NULL },
+	{ "tables",			StepAluTables,			InitAluTablesEngine },
+	{ "aot",			StepAot,				InitAot },
+	{ "fused",			StepFused,				InitFused },
+};
+
+size_t GetNumCpuEngines( )
+{
+	return sizeof( kCpuEngines ) / sizeof( kCpuEngines[ 0 ] );
+}
+
+const CpuEngine & GetCpuEngine( size_t engine )
+{
+	assert( engine < GetNumCpuEngines( ) );
+	return kCpuEngines[ engine ];
+}
+
+void InitCpuEngine( const CpuEngine & engine, const Uint8 * rom )
+{
+	if ( engine.Init )
+	{
+		engine.Init( rom );
+	}
+}
+
+const CpuEngine * FindCpuEngine( const char * name )
+{
+	for ( size_t ix = 0; ix < GetNumCpuEngines( ); ++ix )
+	{
+		if ( strcmp( kCpuEngines[ ix ].Name, name ) == 0 )
+			return &kCpuEngines[ ix ];
+	}
+	return NULL;
+}
+
+Uint64 RunCpuEngine( const Cpu8080 & start, const CpuEngine & engine, Uint32 frames )
+{
+	const bool skipIdleLoops = g_SkipIdleLoops;
+	g_SkipIdleLoops = false;
+
+	Cpu8080 * chip8 = new Cpu8080( start );
+
+	// The clock restarts at each interrupt, so add it up as it does.
+	Uint64 instructions = 0;
+	const Uint32 endFrame = start.Frame + frames;
+	while ( chip8->Frame < endFrame )
+	{
+		if ( IsInterruptDue( *chip8 ) )
+		{
+			instructions += chip8->InstructionsSinceInterrupt;
+			RaiseInterrupt( *chip8 );
+			continue;
+		}
+
+		engine.Step( *chip8 );
+	}
+	instructions += chip8->InstructionsSinceInterrupt;
+	instructions -= start.InstructionsSinceInterrupt;
+
+	delete chip8;
+
+	g_SkipIdleLoops = skipIdleLoops;
+	return instructions;
+}
+
+// ------------------------------------------------------------
+// Comparison.
+// ------------------------------------------------------------
+
+static void PrintIfDiffers( const char * what, Uint32 expected, Uint32 actual )
+{
+	if ( expected != actual )
+	{
+		printf( "  %-22s expected %x actual %x\n", what, expected, actual );
+	}
+}
+
+static void PrintFlagsIfDiffer( const Registers::Flags & expected, const Registers::Flags & actual )
+{
+	if ( expected.u8 != actual.u8 )
+	{
+		printf( "  %-22s expected %02x (s%u z%u ac%u p%u cy%u) actual %02x (s%u z%u ac%u p%u cy%u)\n", "flags",
+			expected.u8, expected.s, expected.z, expected.ac, expected.p, expected.cy,
+			actual.u8, actual.s, actual.z, actual.ac, actual.p, actual.cy );
+	}
+}
+
+// Prints only what differs between the two machines after a step.
+static void PrintDivergence( const Cpu8080 & expected, const Cpu8080 & actual )
+{
+	const Registers & e = expected.Cpu.Regs;
+	const Registers & a = actual.Cpu.Regs;
+
+	static const char * kRegNames[ Registers::Gpr::___MEMORY ] = { "b", "c", "d", "e", "h", "l" };
+	for ( size_t ix = 0; ix < Registers::Gpr::___MEMORY; ++ix )
+	{
+		PrintIfDiffers( kRegNames[ ix ], e.gpr[ RegIndex( ( int )ix ) ], a.gpr[ RegIndex( ( int )ix ) ] );
+	}
+	PrintIfDiffers( "a", e.accumulator, a.accumulator );
+	PrintFlagsIfDiffer( e.flags, a.flags );
+	PrintIfDiffers( "sp", e.sp, a.sp );
+	PrintIfDiffers( "pc", e.pc, a.pc );
+
+	PrintIfDiffers( "interrupts enabled", expected.InterruptsEnabled, actual.InterruptsEnabled );
+	PrintIfDiffers( "interrupts delayed", expected.InterruptsDelayed, actual.InterruptsDelayed );
+	PrintIfDiffers( "VBlankStart waiting", expected.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ], actual.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] );
+	PrintIfDiffers( "VBlankEnd waiting", expected.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ], actual.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] );
+	PrintIfDiffers( "next interrupt", expected.NextInterrupt, actual.NextInterrupt );
+	PrintIfDiffers( "instruction clock", expected.InstructionsSinceInterrupt, actual.InstructionsSinceInterrupt );
+	PrintIfDiffers( "frame", expected.Frame, actual.Frame );
+
+	PrintIfDiffers( "IN 0", expected.Io.Inputs[ 0 ], actual.Io.Inputs[ 0 ] );
+	PrintIfDiffers( "IN 1", expected.Io.Inputs[ 1 ], actual.Io.Inputs[ 1 ] );
+	PrintIfDiffers( "IN 2", expected.Io.Inputs[ 2 ], actual.Io.Inputs[ 2 ] );
+	PrintIfDiffers( "shifter", expected.Io.Shifter.Value, actual.Io.Shifter.Value );
+	PrintIfDiffers( "shifter offset", expected.Io.Shifter.Offset, actual.Io.Shifter.Offset );
+	PrintIfDiffers( "OUT 3", expected.Io.Sound[ 0 ], actual.Io.Sound[ 0 ] );
+	PrintIfDiffers( "OUT 5", expected.Io.Sound[ 1 ], actual.Io.Sound[ 1 ] );
+	PrintIfDiffers( "watchdog", expected.Io.Watchdog, actual.Io.Watchdog );
+	PrintIfDiffers( "watchdog kicks", expected.Io.WatchdogKicks, actual.Io.WatchdogKicks );
+
+	// The first few bytes written differently.
+	Uint32 bytes = 0;
+	for ( size_t ix = 0x2000; ix < 0x4000 && expected.Memory.Hash != actual.Memory.Hash; ++ix )
+	{
+		if ( expected.Memory[ ix ] != actual.Memory[ ix ] && bytes++ < 8 )
+		{
+			printf( "  memory 0x%04x          expected %02x actual %02x\n", ( Uint32 )ix, expected.Memory[ ix ], actual.Memory[ ix ] );
+		}
+	}
+	if ( bytes > 8 )
+	{
+		printf( "  and %u more bytes of memory\n", bytes - 8 );
+	}
+}
+
+static bool MachinesMatch( const Cpu8080 & expected, const Cpu8080 & actual )
+{
+	// The hash covers everything a step can change but the frame count and watchdog kicks.
+	return HashMachineState( expected ) == HashMachineState( actual ) && expected.Frame == actual.Frame && expected.Io.WatchdogKicks == actual.Io.WatchdogKicks;
+}
+
+// ------------------------------------------------------------
+// Running.
+// ------------------------------------------------------------
+
+// One step of the candidate, and as many of the reference as it takes to catch up with it.
+static bool StepLockstep( Cpu8080 & expected, Cpu8080 & actual, const CpuEngine & reference, const CpuEngine & candidate, LockstepResult & result )
+{
+	if ( IsInterruptDue( expected ) )
+	{
+		RaiseInterrupt( expected );
+	}
+	if ( IsInterruptDue( actual ) )
+	{
+		RaiseInterrupt( actual );
+	}
+
+	const address pc = actual.Cpu.Regs.pc;
+	const Uint8 opcode = actual.Memory[ pc ];
+	const bool interrupt = actual.InterruptsEnabled && ( actual.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] || actual.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] );
+
+	candidate.Step( actual );
+
+	// Blocks never straddle an interrupt being raised, so the clocks line up again before the next one is.
+	do
+	{
+		reference.Step( expected );
+		result.Instructions++;
+	}
+	while ( expected.NextInterrupt == actual.NextInterrupt && expected.InstructionsSinceInterrupt < actual.InstructionsSinceInterrupt );
+
+	if ( MachinesMatch( expected, actual ) )
+	{
+		result.Steps++;
+		return true;
+	}
+
+	result.Diverged = true;
+	result.Pc = pc;
+	result.Opcode = opcode;
+
+	printf( "%s diverged from %s at step %llu (%llu instructions in)\n", candidate.Name, reference.Name, ( unsigned long long )result.Steps, ( unsigned long long )result.Instructions );
+	printf( "  pc %04x opcode", pc );
+	for ( Uint32 ix = 0; ix < InstructionSize[ opcode ] && pc + ix < 0x4000; ++ix )
+	{
+		printf( " %02x", expected.Memory[ pc + ix ] );
+	}
+	printf( interrupt ? " (taking an interrupt instead)\n" : "\n" );
+	PrintDivergence( expected, actual );
+	return false;
+}
+
+static void ResetResult( LockstepResult & result )
+{
+	result.Diverged = false;
+	result.Steps = 0;
+	result.Instructions = 0;
+	result.Pc = 0;
+	result.Opcode = 0;
+}
+
+bool RunLockstep( const Cpu8080 & start, const CpuEngine & reference, const CpuEngine & candidate, Uint32 frames, LockstepResult & result )
+{
+	ResetResult( result );
+
+	// Skipping changes the clock by however long the engine takes to notice the loop.
+	const bool skipIdleLoops = g_SkipIdleLoops;
+	g_SkipIdleLoops = false;
+
+	Cpu8080 * expected = new Cpu8080( start );
+	Cpu8080 * actual = new Cpu8080( start );
+
+	const Uint32 endFrame = start.Frame + frames;
+	while ( actual->Frame < endFrame && StepLockstep( *expected, *actual, reference, candidate, result ) )
+	{
+	}
+
+	delete expected;
+	delete actual;
+
+	g_SkipIdleLoops = skipIdleLoops;
+	return ! result.Diverged;
+}
+
+// ------------------------------------------------------------
+// Fuzzing.
+// ------------------------------------------------------------
+
+// Opcodes left out of the random streams.
+static const Uint8 kUnfuzzedOpcodes[ ] =
+{
+	0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38,	// Undocumented NOPs (the interpreter doesn't implement them).
+	0xcb, 0xd9, 0xdd, 0xed, 0xfd,				// Undocumented JMP, RET and CALLs (likewise).
+	0x76,										// HLT (asserts, the ROM never halts).
+	0xc7,										// RST 0 (restarts the machine).
+	0xf7,										// RST 6 (not implemented, the ROM never uses it).
+};
+
+// Lowest and highest addresses control may be transferred to (jumping to 0 asserts, as it is the reset vector).
+static const address kFuzzLowestPc = 0x0001;
+static const address kFuzzHighestPc = 0x1ffd;
+
+static inline Uint32 NextRandom( Uint32 & random )
+{
+	random = random * 1103515245 + 12345;
+	return random >> 16;
+}
+
+static inline bool IsReturn( Uint8 op )
+{
+	return op == 0xc9 || ( op & 0xc7 ) == 0xc0;
+}
+
+static inline bool IsJumpOrCall( Uint8 op )
+{
+	return op == 0xc3 || op == 0xcd || ( op & 0xc7 ) == 0xc2 || ( op & 0xc7 ) == 0xc4;
+}
+
+// Writes random instructions from the fuzzed set, with jump and call targets inside the ROM.
+static void GenerateInstructions( Uint8 * rom, address from, address to, const bool * fuzzed, Uint32 & random )
+{
+	address pc = from;
+	while ( pc + 2 < to )
+	{
+		Uint8 op;
+		do
+		{
+			op = ( Uint8 )NextRandom( random );
+		}
+		while ( ! fuzzed[ op ] );
+
+		rom[ pc ] = op;
+		rom[ pc + 1 ] = ( Uint8 )NextRandom( random );
+		rom[ pc + 2 ] = ( Uint8 )NextRandom( random );
+		if ( IsJumpOrCall( op ) )
+		{
+			const address target = ( address )( kFuzzLowestPc + NextRandom( random ) % ( kFuzzHighestPc - kFuzzLowestPc + 1 ) );
+			rom[ pc + 1 ] = ( Uint8 )target;
+			rom[ pc + 2 ] = ( Uint8 )( target >> 8 );
+		}
+		pc += InstructionSize[ op ];
+	}
+}
+
+static inline bool IsFuzzPc( Uint32 pc )
+{
+	return pc >= kFuzzLowestPc && pc <= kFuzzHighestPc;
+}
+
+// Can the next step run without leaving the ROM (or executing an opcode the streams leave out)?
+static bool IsFuzzableStep( const Cpu8080 & chip8, const bool * fuzzed )
+{
+	const Registers & regs = chip8.Cpu.Regs;
+	if ( ! IsFuzzPc( regs.pc ) )
+		return false;
+
+	// RST 1 or RST 2.
+	if ( chip8.InterruptsEnabled && ( chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] || chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] ) )
+		return true;
+
+	const Uint8 op = chip8.Memory[ regs.pc ];
+	if ( ! fuzzed[ op ] )
+		return false;
+	if ( IsReturn( op ) )
+		return IsFuzzPc( chip8.Memory.Read16( CheckAddress( regs.sp ) ) );
+	if ( IsJumpOrCall( op ) )
+		return IsFuzzPc( chip8.Memory.Read16( regs.pc + 1 ) );
+	if ( op == 0xe9 )
+		return IsFuzzPc( regs.gprPair[ Registers::GprPair::HL ] );
+	return true;
+}
+
+// As IsFuzzableStep, for every instruction of the block an engine may run in one go from here (see StepCpuBlock),
+// once StepLockstep has raised any interrupt that's due.
+static bool IsFuzzableBlock( const Cpu8080 & chip8, const bool * fuzzed, Cpu8080 & scratch )
+{
+	scratch = chip8;
+	scratch.HleEnabled = false;
+	if ( IsInterruptDue( scratch ) )
+	{
+		RaiseInterrupt( scratch );
+	}
+
+	const Uint32 length = GetCpuBlockLength( scratch );
+	if ( length == 1 || ! CanRunUninterrupted( scratch, length ) )
+		return IsFuzzableStep( scratch, fuzzed );
+
+	for ( Uint32 ix = 0; ix < length; ++ix )
+	{
+		if ( ! IsFuzzableStep( scratch, fuzzed ) )
+			return false;
+
+		StepCpu( scratch );
+	}
+	return true;
+}
+
+// Fresh registers, interrupt state and devices (RAM carries on from the last case).
+static void RandomiseMachine( Cpu8080 & chip8, address pc, Uint32 & random )
+{
+	Registers & regs = chip8.Cpu.Regs;
+	for ( size_t ix = 0; ix < Registers::Gpr::___MEMORY; ++ix )
+	{
+		regs.gpr[ ix ] = ( Uint8 )NextRandom( random );
+	}
+	regs.accumulator = ( Uint8 )NextRandom( random );
+	regs.flags.u8 = ( Uint8 )NextRandom( random );
+	regs.sp = ( Uint16 )( 0x2000 + NextRandom( random ) % 0x1fff );
+	regs.pc = pc;
+
+	chip8.InterruptsEnabled = ( NextRandom( random ) & 1 ) != 0;
+	chip8.InterruptsDelayed = false;
+	chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] = false;
+	chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] = false;
+	chip8.NextInterrupt = NextRandom( random ) & 1;
+	chip8.InstructionsSinceInterrupt = NextRandom( random ) % kInstructionsBeforeInterrupt[ chip8.NextInterrupt ];
+	chip8.Idle.Active = false;
+
+	for ( size_t ix = 0; ix < 3; ++ix )
+	{
+		chip8.Io.Inputs[ ix ] = ( Uint8 )NextRandom( random );
+	}
+	chip8.Io.Shifter.Value = ( Uint16 )NextRandom( random );
+	chip8.Io.Shifter.Offset = ( Uint8 )( NextRandom( random ) & 7 );
+}
+
+bool RunLockstepFuzz( const CpuEngine & reference, const CpuEngine & candidate, Uint32 seed, Uint32 cases, Uint32 instructions, LockstepResult & result )
+{
+	ResetResult( result );
+
+	bool fuzzed[ 256 ];
+	for ( size_t ix = 0; ix < 256; ++ix )
+	{
+		fuzzed[ ix ] = true;
+	}
+	for ( size_t ix = 0; ix < sizeof( kUnfuzzedOpcodes ); ++ix )
+	{
+		fuzzed[ kUnfuzzedOpcodes[ ix ] ] = false;
+	}
+
+	const bool skipIdleLoops = g_SkipIdleLoops;
+	g_SkipIdleLoops = false;
+
+	// Our own ROM, all random instructions (jumps land somewhere we generated), rewritten where each case starts. It is
+	// never given to InitCpuCaches, so blocks and loops are found in it afresh every time.
+	Uint32 random = seed;
+	std::vector< Uint8 > rom( kRomImageSize, 0 );
+	GenerateInstructions( &rom[ 0 ], 0, 0x2000, fuzzed, random );
+
+	Cpu8080 * expected = new Cpu8080;
+	Cpu8080 * actual = new Cpu8080;
+	Cpu8080 * scratch = new Cpu8080;
+	expected->Memory.Rom = &rom[ 0 ];
+	for ( size_t ix = 0; ix < sizeof( expected->Memory.Ram ); ++ix )
+	{
+		expected->Memory.Ram[ ix ] = ( Uint8 )NextRandom( random );
+	}
+	expected->Memory.Hash = HashRam( expected->Memory );
+
+	const Uint32 streamBytes = std::min< Uint32 >( instructions * 3, 0x1000 );
+	for ( Uint32 ix = 0; ix < cases && ! result.Diverged; ++ix )
+	{
+		const address pc = ( address )( kFuzzLowestPc + NextRandom( random ) % ( 0x2000 - kFuzzLowestPc - streamBytes ) );
+		GenerateInstructions( &rom[ 0 ], pc, ( address )( pc + streamBytes ), fuzzed, random );
+		RandomiseMachine( *expected, pc, random );
+		*actual = *expected;
+
+		for ( Uint32 instruction = 0; instruction < instructions && IsFuzzableBlock( *actual, fuzzed, *scratch ); ++instruction )
+		{
+			if ( ! StepLockstep( *expected, *actual, reference, candidate, result ) )
+			{
+				printf( "  in case %u of seed %u\n", ix, seed );
+				break;
+			}
+		}
+	}
+
+	delete expected;
+	delete actual;
+	delete scratch;
+
+	g_SkipIdleLoops = skipIdleLoops;
+	return ! result.Diverged;
+}
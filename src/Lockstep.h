@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SDL.h>
+
+#include "Cpu8080.h"
+
+// ------------------------------------------------------------
+// Differential lockstep runner.
+//
+// Runs a candidate CPU engine alongside a reference one from the same
+// machine and compares them after every step of the candidate: registers,
+// interrupt state, the instruction clock, devices and RAM (by
+// HashMachineState, then field by field to say what differs). A step may be
+// one instruction or a whole block (HLE routines, a JIT); the reference
+// steps until its clock catches up, so blocks are compared at their ends.
+// The fuzzer runs short random instruction streams from random registers
+// and RAM, covering opcodes the ROM rarely or never executes (DAA, XTHL,
+// SBB M, ...).
+// ------------------------------------------------------------
+
+struct CpuEngine
+{
+	const char *	Name;
+	void			( * Step )( Cpu8080 & chip8 );	// Executes one instruction or block (taking a waiting interrupt first).
+	void			( * Init )( const Uint8 * rom );	// Sets up what Step needs for the ROM (NULL if nothing).
+};
+
+size_t GetNumCpuEngines( );
+const CpuEngine & GetCpuEngine( size_t engine );
+
+// Returns NULL if there is no engine of that name.
+const CpuEngine * FindCpuEngine( const char * name );
+
+// Sets up the engine for the ROM (the ALU tables, compiled blocks or fused handlers), only needed before it first
+// runs. Not thread safe, so before any threads are started.
+void InitCpuEngine( const CpuEngine & engine, const Uint8 * rom );
+
+// Runs the engine on its own from start until frames more have ended, raising interrupts as RunFrame does (to time
+// engines). Idle loops are never skipped while running. Returns the instructions executed.
+Uint64 RunCpuEngine( const Cpu8080 & start, const CpuEngine & engine, Uint32 frames );
+
+struct LockstepResult
+{
+	bool	Diverged;
+	Uint64	Steps;			// Candidate steps that matched.
+	Uint64	Instructions;	// Reference instructions over them.
+	address	Pc;				// Start of the step that diverged.
+	Uint8	Opcode;
+};
+
+// Runs both engines from start until frames more have ended, raising interrupts as RunFrame does. Stops at the
+// first divergence, printing what differs. Idle loops are never skipped while running. Returns false if they diverged.
+bool RunLockstep( const Cpu8080 & start, const CpuEngine & reference, const CpuEngine & candidate, Uint32 frames, LockstepResult & result );
+
+// Long enough to wander through a few branches, short enough that most cases don't leave the ROM first.
+static const Uint32 kLockstepFuzzInstructions = 64;
+
+// Runs cases random instruction streams of up to instructions each. Jump targets and the like are kept inside the
+// ROM, so cases end early if one would leave it. HLE routines should be removed (they are keyed by ROM address,
+// not by what is there). Returns false if the engines diverged.
+bool RunLockstepFuzz( const CpuEngine & reference, const CpuEngine & candidate, Uint32 seed, Uint32 cases, Uint32 instructions, LockstepResult & result );
@@ -0,0 +1,110 @@
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+
+MappedFile::MappedFile( ) : m_pData( NULL ), m_Size( 0 ), m_File( NULL ), m_Mapping( NULL )
+{
+}
+
+MappedFile::~MappedFile( )
+{
+	Close( );
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open( const char * file )
+{
+	Close( );
+
+	HANDLE fh = CreateFileA( file, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL );
+	if ( fh == INVALID_HANDLE_VALUE )
+		return false;
+	m_File = fh;
+
+	LARGE_INTEGER size;
+	if ( ! GetFileSizeEx( fh, &size ) || size.QuadPart == 0 || ( Uint64 )size.QuadPart > ( size_t )-1 )
+	{
+		Close( );
+		return false;
+	}
+
+	m_Mapping = CreateFileMappingA( fh, NULL, PAGE_READONLY, 0, 0, NULL );
+	m_pData = m_Mapping ? ( const Uint8 * )MapViewOfFile( m_Mapping, FILE_MAP_READ, 0, 0, 0 ) : NULL;
+	if ( ! m_pData )
+	{
+		Close( );
+		return false;
+	}
+
+	m_Size = ( size_t )size.QuadPart;
+	return true;
+}
+
+void MappedFile::Close( )
+{
+	if ( m_pData )
+	{
+		UnmapViewOfFile( m_pData );
+	}
+	if ( m_Mapping )
+	{
+		CloseHandle( m_Mapping );
+	}
+	if ( m_File )
+	{
+		CloseHandle( m_File );
+	}
+
+	m_pData = NULL;
+	m_Size = 0;
+	m_File = NULL;
+	m_Mapping = NULL;
+}
+
+#else
+
+// POSIX builds, the descriptor is closed as soon as the file is mapped.
+bool MappedFile::Open( const char * file )
+{
+	Close( );
+
+	int fd = open( file, O_RDONLY );
+	if ( fd < 0 )
+		return false;
+
+	struct stat info;
+	void * data = MAP_FAILED;
+	if ( fstat( fd, &info ) == 0 && info.st_size > 0 )
+	{
+		data = mmap( NULL, ( size_t )info.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	}
+	close( fd );
+
+	if ( data == MAP_FAILED )
+		return false;
+
+	m_pData = ( const Uint8 * )data;
+	m_Size = ( size_t )info.st_size;
+	return true;
+}
+
+void MappedFile::Close( )
+{
+	if ( m_pData )
+	{
+		munmap( ( void * )m_pData, m_Size );
+	}
+
+	m_pData = NULL;
+	m_Size = 0;
+}
+
+#endif
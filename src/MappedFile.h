@@ -0,0 +1,38 @@
+#pragma once
+
+#include <SDL.h>
+
+// ------------------------------------------------------------
+// Read only memory mapped files.
+//
+// The OS pages the file in as it is touched, so a long movie can be opened
+// and read from anywhere in it without reading (or allocating) the rest.
+// ------------------------------------------------------------
+
+class MappedFile
+{
+public:
+
+	MappedFile( );
+	~MappedFile( );
+
+	bool Open( const char * file );
+	void Close( );
+	bool IsOpen( ) const { return m_pData != NULL; }
+
+	const Uint8 * GetData( ) const { return m_pData; }
+	size_t GetSize( ) const { return m_Size; }
+
+private:
+
+	// Not copyable, it owns the mapping.
+	MappedFile( const MappedFile & );
+	MappedFile & operator=( const MappedFile & );
+
+	const Uint8 *	m_pData;
+	size_t			m_Size;
+
+	// The file and mapping handles on Windows (kept as void * so windows.h stays out of here).
+	void *			m_File;
+	void *			m_Mapping;
+};
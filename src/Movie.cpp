@@ -0,0 +1,516 @@
+#include <algorithm>
+#include <SDL_thread.h>
+
+#include "Delta.h"
+#include "Movie.h"
+
+// Keyframes are run length encoded against this.
+static const Uint8 kZeroState[ sizeof( Cpu8080 ) ] = { 0 };
+
+// Records after a keyframe stay 8 byte aligned, so the mapped file can be read in place.
+static size_t PadTo8( size_t size )
+{
+	return ( size + 7 ) & ~( size_t )7;
+}
+
+// ------------------------------------------------------------
+// Recording.
+// ------------------------------------------------------------
+
+MovieRecorder::MovieRecorder( ) : m_pFile( NULL ), m_Offset( 0 ), m_KeyframeInterval( 0 ), m_LastFrame( 0 )
+{
+	memset( m_Inputs, 0, sizeof( m_Inputs ) );
+}
+
+MovieRecorder::~MovieRecorder( )
+{
+	Close( );
+}
+
+bool MovieRecorder::Open( const char * file, const Uint8 * rom, Uint32 flags, Uint32 keyframeInterval )
+{
+	Close( );
+	m_KeyframeInterval = keyframeInterval;
+	m_Offset = 0;
+	m_LastFrame = 0;
+	m_Index.clear( );
+
+	if ( fopen_s( &m_pFile, file, "wb" ) != 0 )
+	{
+		m_pFile = NULL;
+		return false;
+	}
+
+	MovieHeader header;
+	memcpy( header.Magic, kMovieMagic, sizeof( header.Magic ) );
+	header.Version = kMovieVersion;
+	header.Flags = flags;
+	header.RomHash = HashBytes( kHashSeed, rom, 0x2000 );
+	header.StateSize = sizeof( Cpu8080 );
+	Write( &header, sizeof( header ) );
+
+	// Machines start with every port at 0, so the first RecordInputs picks up anything else.
+	memset( m_Inputs, 0, sizeof( m_Inputs ) );
+	return true;
+}
+
+void MovieRecorder::Close( )
+{
+	if ( m_pFile )
+	{
+		MovieIndexTrailer trailer;
+		trailer.IndexOffset = m_Offset;
+		memcpy( trailer.Magic, kMovieIndexMagic, sizeof( trailer.Magic ) );
+
+		MovieRecord record;
+		record.Type = MovieRecord::Index;
+		record.Port = 0;
+		record.Value = 0;
+		record.Pad = 0;
+		record.Frame = m_LastFrame;
+		record.Data = m_Index.size( );
+		Write( record );
+		if ( ! m_Index.empty( ) )
+		{
+			Write( &m_Index[ 0 ], m_Index.size( ) * sizeof( m_Index[ 0 ] ) );
+		}
+		Write( &trailer, sizeof( trailer ) );
+
+		fclose( m_pFile );
+		m_pFile = NULL;
+	}
+}
+
+void MovieRecorder::RecordInputs( const Cpu8080 & chip8 )
+{
+	if ( ! m_pFile )
+		return;
+
+	for ( Uint8 port = 0; port < 3; ++port )
+	{
+		if ( chip8.Io.Inputs[ port ] != m_Inputs[ port ] )
+		{
+			m_Inputs[ port ] = chip8.Io.Inputs[ port ];
+
+			MovieRecord record;
+			record.Type = MovieRecord::Input;
+			record.Port = port;
+			record.Value = m_Inputs[ port ];
+			record.Pad = 0;
+			record.Frame = chip8.Frame;
+			record.Data = FrameCycle( chip8 );
+			Write( record );
+		}
+	}
+}
+
+void MovieRecorder::EndFrame( const Cpu8080 & chip8 )
+{
+	if ( ! m_pFile )
+		return;
+
+	MovieRecord record;
+	record.Type = MovieRecord::FrameHash;
+	record.Port = 0;
+	record.Value = 0;
+	record.Pad = 0;
+	record.Frame = chip8.Frame;
+	record.Data = HashMachineState( chip8 );
+	Write( record );
+	m_LastFrame = chip8.Frame;
+
+	if ( m_KeyframeInterval && chip8.Frame % m_KeyframeInterval == 0 )
+	{
+		// The ROM pointer means nothing to whoever loads it, and zeros encode to nothing.
+		Cpu8080 state = chip8;
+		state.Memory.Rom = NULL;
+		EncodeDelta( ( const Uint8 * )&state, kZeroState, sizeof( state ), m_Scratch );
+		const size_t size = m_Scratch.size( );
+		m_Scratch.resize( PadTo8( size ) );
+
+		MovieIndexEntry entry;
+		entry.Frame = chip8.Frame;
+		entry.Size = ( Uint32 )( sizeof( record ) + m_Scratch.size( ) );
+		entry.Offset = m_Offset;
+		m_Index.push_back( entry );
+
+		record.Type = MovieRecord::Keyframe;
+		record.Data = size;
+		Write( record );
+		if ( ! m_Scratch.empty( ) )
+		{
+			Write( &m_Scratch[ 0 ], m_Scratch.size( ) );
+		}
+	}
+
+	// Once a frame, so a session that is killed still leaves a usable movie.
+	fflush( m_pFile );
+}
+
+void MovieRecorder::Write( const void * data, size_t size )
+{
+	fwrite( data, size, 1, m_pFile );
+	m_Offset += size;
+}
+
+// ------------------------------------------------------------
+// Playback.
+// ------------------------------------------------------------
+
+MoviePlayer::MoviePlayer( ) : m_RecordsEnd( 0 ), m_Next( 0 ), m_Frames( 0 )
+{
+	memset( &m_Header, 0, sizeof( m_Header ) );
+}
+
+bool MoviePlayer::Load( const char * file )
+{
+	m_Keyframes.clear( );
+	m_RecordsEnd = 0;
+	m_Next = 0;
+	m_Frames = 0;
+
+	if ( ! m_File.Open( file ) || m_File.GetSize( ) < sizeof( m_Header ) )
+	{
+		m_File.Close( );
+		return false;
+	}
+
+	const Uint8 * data = m_File.GetData( );
+	const size_t size = m_File.GetSize( );
+	memcpy( &m_Header, data, sizeof( m_Header ) );
+	if ( memcmp( m_Header.Magic, kMovieMagic, sizeof( kMovieMagic ) ) != 0 || m_Header.Version != kMovieVersion )
+	{
+		m_File.Close( );
+		return false;
+	}
+	m_Next = sizeof( m_Header );
+
+	// Closed properly? Then the index says where everything is.
+	MovieIndexTrailer trailer;
+	const MovieRecord * index = NULL;
+	if ( size >= sizeof( m_Header ) + sizeof( MovieRecord ) + sizeof( trailer ) )
+	{
+		memcpy( &trailer, data + size - sizeof( trailer ), sizeof( trailer ) );
+		if ( memcmp( trailer.Magic, kMovieIndexMagic, sizeof( kMovieIndexMagic ) ) == 0
+			&& trailer.IndexOffset >= sizeof( m_Header ) && trailer.IndexOffset % 8 == 0
+			&& trailer.IndexOffset + sizeof( MovieRecord ) + sizeof( trailer ) <= size )
+		{
+			index = ( const MovieRecord * )( data + trailer.IndexOffset );
+			if ( index->Type != MovieRecord::Index
+				|| index->Data != ( size - trailer.IndexOffset - sizeof( MovieRecord ) - sizeof( trailer ) ) / sizeof( MovieIndexEntry ) )
+			{
+				index = NULL;
+			}
+		}
+	}
+
+	if ( ! index )
+	{
+		return ScanKeyframes( );
+	}
+
+	m_RecordsEnd = ( size_t )trailer.IndexOffset;
+	m_Frames = index->Frame;
+
+	// Keyframes from another build are no use (everything else still is).
+	if ( m_Header.StateSize != sizeof( Cpu8080 ) )
+		return true;
+
+	const MovieIndexEntry * entries = ( const MovieIndexEntry * )( index + 1 );
+	for ( size_t ix = 0; ix < index->Data; ++ix )
+	{
+		const MovieIndexEntry & entry = entries[ ix ];
+		const MovieRecord * record = entry.Offset % 8 == 0 ? GetRecord( ( size_t )entry.Offset ) : NULL;
+		if ( ! record || record->Type != MovieRecord::Keyframe || record->Frame != entry.Frame
+			|| entry.Offset + entry.Size != GetNextRecord( ( size_t )entry.Offset ) )
+		{
+			return false;
+		}
+
+		Keyframe keyframe;
+		keyframe.Frame = entry.Frame;
+		keyframe.Offset = ( size_t )entry.Offset;
+		keyframe.Next = ( size_t )( entry.Offset + entry.Size );
+		m_Keyframes.push_back( keyframe );
+	}
+	return true;
+}
+
+bool MoviePlayer::ScanKeyframes( )
+{
+	// Up to the last whole record.
+	m_RecordsEnd = m_File.GetSize( );
+
+	size_t offset = sizeof( m_Header );
+	for ( const MovieRecord * record = GetRecord( offset ); record; record = GetRecord( offset ) )
+	{
+		size_t next = GetNextRecord( offset );
+		if ( next > m_File.GetSize( ) || record->Type == MovieRecord::Index )
+			break;
+
+		if ( record->Type == MovieRecord::FrameHash )
+		{
+			m_Frames = record->Frame;
+		}
+		else if ( record->Type == MovieRecord::Keyframe && m_Header.StateSize == sizeof( Cpu8080 ) )
+		{
+			Keyframe keyframe;
+			keyframe.Frame = record->Frame;
+			keyframe.Offset = offset;
+			keyframe.Next = next;
+			m_Keyframes.push_back( keyframe );
+		}
+		offset = next;
+	}
+
+	m_RecordsEnd = offset;
+	return true;
+}
+
+const MovieRecord * MoviePlayer::GetRecord( size_t offset ) const
+{
+	if ( offset + sizeof( MovieRecord ) > m_RecordsEnd )
+		return NULL;
+
+	return ( const MovieRecord * )( m_File.GetData( ) + offset );
+}
+
+size_t MoviePlayer::GetNextRecord( size_t offset ) const
+{
+	const MovieRecord & record = *GetRecord( offset );
+	offset += sizeof( record );
+	if ( record.Type == MovieRecord::Keyframe )
+	{
+		// Past the end if it is too big, which ends playback.
+		offset += PadTo8( ( size_t )std::min( record.Data, ( Uint64 )m_File.GetSize( ) ) );
+	}
+	return offset;
+}
+
+void MoviePlayer::ApplyInputs( size_t & next, Cpu8080 & chip8 ) const
+{
+	// Records are in the order they were made, so stop at the first one that is not due yet.
+	for ( const MovieRecord * record = GetRecord( next ); record; record = GetRecord( next ) )
+	{
+		if ( record->Type != MovieRecord::Input || record->Frame > chip8.Frame || ( record->Frame == chip8.Frame && record->Data > FrameCycle( chip8 ) ) )
+			break;
+
+		if ( record->Port < 3 )
+		{
+			chip8.Io.Inputs[ record->Port ] = record->Value;
+		}
+		next += sizeof( MovieRecord );
+	}
+}
+
+bool MoviePlayer::EndFrame( size_t & next, const Cpu8080 & chip8 ) const
+{
+	// Every frame has its hash, anything else in its place means the inputs went wrong too.
+	const MovieRecord * record = GetRecord( next );
+	if ( record )
+	{
+		if ( record->Type != MovieRecord::FrameHash || record->Frame != chip8.Frame || record->Data != HashMachineState( chip8 ) )
+		{
+			return false;
+		}
+		next += sizeof( MovieRecord );
+	}
+
+	// Keyframes are only for Verify and Seek.
+	for ( record = GetRecord( next ); record && record->Type == MovieRecord::Keyframe; record = GetRecord( next ) )
+	{
+		next = GetNextRecord( next );
+	}
+	return true;
+}
+
+bool MoviePlayer::Play( size_t & next, Cpu8080 & chip8, Uint32 endFrame ) const
+{
+	// Same order as the main loop: raise a due interrupt, let inputs change, execute.
+	while ( next < m_RecordsEnd )
+	{
+		if ( IsInterruptDue( chip8 ) && RaiseInterrupt( chip8 ) )
+		{
+			if ( ! EndFrame( next, chip8 ) )
+			{
+				return false;
+			}
+			if ( chip8.Frame == endFrame )
+			{
+				break;
+			}
+			continue;
+		}
+
+		ApplyInputs( next, chip8 );
+
+		// Inputs may change part way through a block, so not while any more are due this frame.
+		const MovieRecord * record = GetRecord( next );
+		if ( record && record->Type == MovieRecord::Input && record->Frame == chip8.Frame )
+		{
+			StepCpu( chip8 );
+		}
+		else
+		{
+			g_StepCpuEngine( chip8 );
+		}
+	}
+	return true;
+}
+
+bool MoviePlayer::LoadKeyframe( const Keyframe & keyframe, Cpu8080 & chip8 ) const
+{
+	const MovieRecord & record = *GetRecord( keyframe.Offset );
+	const size_t size = keyframe.Next - keyframe.Offset - sizeof( record );
+	if ( record.Data > size )
+		return false;
+
+	const Uint8 * rom = chip8.Memory.Rom;
+	const bool hleEnabled = chip8.HleEnabled;
+	const bool aluTablesEnabled = chip8.AluTablesEnabled;
+	memcpy( &chip8, kZeroState, sizeof( chip8 ) );
+	bool okay = ApplyDelta( ( const Uint8 * )( &record + 1 ), ( size_t )record.Data, sizeof( chip8 ), ( Uint8 * )&chip8 );
+
+	// From the file, so don't trust the pointers, the options or the hash that came with it.
+	chip8.Memory.Rom = rom;
+	chip8.Memory.Flat = NULL;
+	chip8.HleEnabled = hleEnabled;
+	chip8.AluTablesEnabled = aluTablesEnabled;
+	chip8.Memory.Hash = HashRam( chip8.Memory );
+
+	// Nor anything used as an index or a shift (the watchdog takes any byte OUT 6 writes).
+	okay &= chip8.NextInterrupt >= 0 && chip8.NextInterrupt < Cpu8080::Interrupt::Num;
+	okay &= chip8.Io.Shifter.Offset <= 7;
+	okay &= chip8.Cpu.Regs.pc < 0x2000;
+	return okay;
+}
+
+// ------------------------------------------------------------
+// Seeking.
+// ------------------------------------------------------------
+
+bool MoviePlayer::Seek( const Cpu8080 & start, Uint32 frame, Cpu8080 & chip8 )
+{
+	// The last keyframe at or before the frame (they are in frame order).
+	size_t ix = m_Keyframes.size( );
+	while ( ix > 0 && m_Keyframes[ ix - 1 ].Frame > frame )
+	{
+		ix--;
+	}
+	const Keyframe * keyframe = ix > 0 ? &m_Keyframes[ ix - 1 ] : NULL;
+	const Uint32 keyframeFrame = keyframe ? keyframe->Frame : start.Frame;
+
+	// Playing on from where we are is quicker if that is past the keyframe.
+	if ( chip8.Frame > frame || chip8.Frame < keyframeFrame )
+	{
+		chip8 = start;
+		m_Next = sizeof( m_Header );
+		if ( keyframe && ! LoadKeyframe( *keyframe, chip8 ) )
+		{
+			return false;
+		}
+		if ( keyframe )
+		{
+			m_Next = keyframe->Next;
+		}
+	}
+
+	if ( chip8.Frame == frame )
+		return true;
+
+	return Play( m_Next, chip8, frame ) && chip8.Frame == frame;
+}
+
+// ------------------------------------------------------------
+// Verifying a keyframe at a time.
+// ------------------------------------------------------------
+
+struct MoviePlayer::VerifyJob
+{
+	const MoviePlayer *	Player;
+	const Cpu8080 *		Start;
+	SDL_mutex *			Lock;
+	size_t				NextSegment;	// Guarded by Lock, segment ix runs from keyframe ix - 1 (or the start) to keyframe ix (or the end).
+	Uint32				DesyncFrame;	// Guarded by Lock, the earliest found.
+};
+
+int SDLCALL MoviePlayer::VerifyThread( void * userData )
+{
+	VerifyJob & shared = *( VerifyJob * )userData;
+	const MoviePlayer & player = *shared.Player;
+	const size_t numSegments = player.m_Keyframes.size( ) + 1;
+
+	Cpu8080 * chip8 = new Cpu8080;
+	Cpu8080 * expected = new Cpu8080;
+
+	for ( ; ; )
+	{
+		SDL_LockMutex( shared.Lock );
+		size_t segment = shared.NextSegment++;
+		SDL_UnlockMutex( shared.Lock );
+
+		if ( segment >= numSegments )
+			break;
+
+		*chip8 = *shared.Start;
+		size_t next = sizeof( MovieHeader );
+		bool inSync = true;
+		if ( segment > 0 )
+		{
+			const Keyframe & keyframe = player.m_Keyframes[ segment - 1 ];
+			inSync = player.LoadKeyframe( keyframe, *chip8 );
+			next = keyframe.Next;
+		}
+
+		const Keyframe * end = segment < player.m_Keyframes.size( ) ? &player.m_Keyframes[ segment ] : NULL;
+		inSync = inSync && player.Play( next, *chip8, end ? end->Frame : ~0u );
+
+		// Ended up where the next segment starts from?
+		if ( inSync && end )
+		{
+			*expected = *chip8;
+			inSync = player.LoadKeyframe( *end, *expected ) && HashMachineState( *chip8 ) == HashMachineState( *expected );
+		}
+
+		if ( ! inSync )
+		{
+			SDL_LockMutex( shared.Lock );
+			shared.DesyncFrame = std::min( shared.DesyncFrame, chip8->Frame );
+			SDL_UnlockMutex( shared.Lock );
+		}
+	}
+
+	delete expected;
+	delete chip8;
+	return 0;
+}
+
+bool MoviePlayer::Verify( const Cpu8080 & start, Uint32 threads, Uint32 & desyncFrame ) const
+{
+	VerifyJob shared;
+	shared.Player = this;
+	shared.Start = &start;
+	shared.Lock = SDL_CreateMutex( );
+	shared.NextSegment = 0;
+	shared.DesyncFrame = ~0u;
+
+	std::vector< SDL_Thread * > workers( std::max( threads, 1u ) );
+	for ( size_t ix = 0; ix < workers.size( ); ++ix )
+	{
+		workers[ ix ] = SDL_CreateThread( VerifyThread, &shared );
+	}
+	for ( size_t ix = 0; ix < workers.size( ); ++ix )
+	{
+		SDL_WaitThread( workers[ ix ], NULL );
+	}
+
+	SDL_DestroyMutex( shared.Lock );
+
+	desyncFrame = shared.DesyncFrame;
+	return desyncFrame == ~0u;
+}
+
+bool PlayMovie( Cpu8080 & chip8, MoviePlayer & player )
+{
+	return player.Play( chip8 );
+}
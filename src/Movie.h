@@ -0,0 +1,191 @@
+#pragma once
+
+#include <stdio.h>
+#include <vector>
+#include <SDL.h>
+
+#include "Cpu8080.h"
+#include "MappedFile.h"
+
+// ------------------------------------------------------------
+// Input movies.
+//
+// A movie records every change to the input ports keyed by the emulated
+// position it happened at (Cpu8080::Frame and FrameCycle), plus a hash of the
+// machine at the end of every frame. Played back, the inputs land on exactly
+// the same instruction, so a session replays identically (headless and as
+// fast as the host can go) and a desync is reported at the first frame whose
+// hash differs.
+//
+// Every kMovieKeyframeInterval frames the whole machine is stored too, run
+// length encoded (see Delta.h) and only loadable by builds with the same
+// StateSize. A long movie can then be verified a segment per keyframe, each
+// segment on its own thread, checking that it ends in the state the next
+// keyframe has, or seeked by loading the keyframe before a frame and playing
+// on from it.
+//
+// Closing a recording appends an index of its keyframes and a trailer that
+// points at it, so a player maps the file and finds any keyframe without
+// reading the rest. A movie with no trailer (the session was killed) is
+// scanned for its keyframes instead.
+// ------------------------------------------------------------
+
+// Options that change how the machine runs, a movie is only in sync when played back with the same ones.
+static const Uint32 kMovieFlagHle = 1 << 0;
+static const Uint32 kMovieFlagIdleSkip = 1 << 1;
+
+struct MovieHeader
+{
+	char	Magic[ 8 ];		// kMovieMagic
+	Uint32	Version;		// kMovieVersion
+	Uint32	Flags;			// kMovieFlag...
+	Uint32	RomHash;		// HashBytes of the 8K ROM.
+	Uint32	StateSize;		// sizeof( Cpu8080 ) in the build that recorded it.
+};
+
+static const char kMovieMagic[ 8 ] = { 'I', 'N', 'V', 'M', 'O', 'V', 'I', 'E' };
+static const Uint32 kMovieVersion = 5;
+
+// Ten seconds.
+static const Uint32 kMovieKeyframeInterval = 600;
+
+struct MovieRecord
+{
+	enum Type
+	{
+		Input = 0,		// Port = Value at Frame, Data = FrameCycle.
+		FrameHash,		// Data = HashMachineState when Frame started.
+		Keyframe,		// The machine when Frame started, Data bytes of it follow the record (padded to 8).
+		Index,			// Data MovieIndexEntry follow the record, Frame is the last frame recorded.
+	};
+
+	Uint8	Type;
+	Uint8	Port;
+	Uint8	Value;
+	Uint8	Pad;
+	Uint32	Frame;
+	Uint64	Data;
+};
+
+struct MovieIndexEntry
+{
+	Uint32	Frame;
+	Uint32	Size;			// Of the record and the keyframe after it.
+	Uint64	Offset;			// Of the Keyframe record in the file.
+};
+
+// The last bytes of a closed movie.
+struct MovieIndexTrailer
+{
+	Uint64	IndexOffset;	// Of the Index record.
+	char	Magic[ 8 ];		// kMovieIndexMagic
+};
+
+static const char kMovieIndexMagic[ 8 ] = { 'I', 'N', 'V', 'I', 'N', 'D', 'E', 'X' };
+
+class MovieRecorder
+{
+public:
+
+	MovieRecorder( );
+	~MovieRecorder( );
+
+	// Stores a keyframe every keyframeInterval frames (0 for none).
+	bool Open( const char * file, const Uint8 * rom, Uint32 flags, Uint32 keyframeInterval = kMovieKeyframeInterval );
+
+	// Writes the index, after which the movie is complete.
+	void Close( );
+	bool IsOpen( ) const { return m_pFile != NULL; }
+
+	// Records any input ports that changed since the last call. Call after the inputs are updated.
+	void RecordInputs( const Cpu8080 & chip8 );
+
+	// Records the state hash. Call when RaiseInterrupt ends a frame.
+	void EndFrame( const Cpu8080 & chip8 );
+
+private:
+
+	void Write( const void * data, size_t size );
+	void Write( const MovieRecord & record ) { Write( &record, sizeof( record ) ); }
+
+	FILE *							m_pFile;
+	Uint64							m_Offset;		// Bytes written.
+	Uint8							m_Inputs[ 3 ];
+	Uint32							m_KeyframeInterval;
+	Uint32							m_LastFrame;
+	std::vector< MovieIndexEntry >	m_Index;
+	std::vector< Uint8 >			m_Scratch;
+};
+
+class MoviePlayer
+{
+public:
+
+	MoviePlayer( );
+
+	// Maps the movie, only its header and index are read.
+	bool Load( const char * file );
+
+	const MovieHeader & GetHeader( ) const { return m_Header; }
+	bool IsFinished( ) const { return m_Next >= m_RecordsEnd; }
+	Uint32 GetFrames( ) const { return m_Frames; }
+
+	// Applies the inputs due at the machine's position. Call before every StepCpu.
+	void ApplyInputs( Cpu8080 & chip8 ) { ApplyInputs( m_Next, chip8 ); }
+
+	// Checks the state hash, returns false on a desync. Call when RaiseInterrupt ends a frame.
+	bool EndFrame( const Cpu8080 & chip8 ) { return EndFrame( m_Next, chip8 ); }
+
+	// Plays the rest of the movie, see PlayMovie.
+	bool Play( Cpu8080 & chip8 ) { return Play( m_Next, chip8, ~0u ); }
+
+	// Plays the whole movie from start (the machine it was recorded from) a keyframe to the next at a time, on
+	// up to threads threads. Returns false (with the first frame that differed in desyncFrame) on a desync.
+	bool Verify( const Cpu8080 & start, Uint32 threads, Uint32 & desyncFrame ) const;
+
+	// Takes chip8 to the start of frame, from the keyframe before it (or start, the machine it was recorded from)
+	// unless chip8 is already between the two. Playback carries on from there. Returns false on a desync, or if the
+	// movie ends first.
+	bool Seek( const Cpu8080 & start, Uint32 frame, Cpu8080 & chip8 );
+
+	size_t GetNumKeyframes( ) const { return m_Keyframes.size( ); }
+
+private:
+
+	struct Keyframe
+	{
+		Uint32	Frame;
+		size_t	Offset;		// Of its record.
+		size_t	Next;		// The record after it.
+	};
+
+	struct VerifyJob;
+	static int SDLCALL VerifyThread( void * userData );
+
+	// The record at offset (NULL at the end), and the offset of the one after it.
+	const MovieRecord * GetRecord( size_t offset ) const;
+	size_t GetNextRecord( size_t offset ) const;
+
+	// Finds the keyframes by reading every record, for movies without an index.
+	bool ScanKeyframes( );
+
+	void ApplyInputs( size_t & next, Cpu8080 & chip8 ) const;
+	bool EndFrame( size_t & next, const Cpu8080 & chip8 ) const;
+
+	// Plays from record next until the movie ends or the machine gets to endFrame, returns false on a desync.
+	bool Play( size_t & next, Cpu8080 & chip8, Uint32 endFrame ) const;
+
+	// Loads a keyframe over the machine, keeping its ROM and options (HLE, ALU tables). Returns false if it is corrupt.
+	bool LoadKeyframe( const Keyframe & keyframe, Cpu8080 & chip8 ) const;
+
+	MappedFile					m_File;
+	MovieHeader					m_Header;
+	size_t						m_RecordsEnd;	// Offset of the index (or the end of the last whole record).
+	std::vector< Keyframe >		m_Keyframes;
+	size_t						m_Next;
+	Uint32						m_Frames;
+};
+
+// Plays a movie from the machine's current state, unthrottled and without rendering.
+// Returns false (with chip8.Frame at the frame that differed) if the machine desyncs.
+bool PlayMovie( Cpu8080 & chip8, MoviePlayer & player );
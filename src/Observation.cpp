@@ -0,0 +1,174 @@
+#include <assert.h>
+#include <string.h>
+
+#include "Observation.h"
+
+static const Uint32 kVramRows = 224;
+static const Uint32 kVramRowBits = 256;
+static const Uint32 kVramRowWords = kVramRowBits / 32;
+
+// Bits set in a word (SWAR, so it is branch free on any compiler).
+static inline Uint32 PopCount( Uint32 v )
+{
+	v = v - ( ( v >> 1 ) & 0x55555555 );
+	v = ( v & 0x33333333 ) + ( ( v >> 2 ) & 0x33333333 );
+	v = ( v + ( v >> 4 ) ) & 0x0f0f0f0f;
+	return ( v * 0x01010101 ) >> 24;
+}
+
+// Mask of the bits in [lo, hi) that fall in the given word of a row.
+static inline Uint32 WordMask( Uint32 word, Uint32 lo, Uint32 hi )
+{
+	Uint32 first = word * 32;
+	if ( hi <= first || lo >= first + 32 )
+		return 0;
+
+	Uint32 from = lo > first ? lo - first : 0;
+	Uint32 to = hi < first + 32 ? hi - first : 32;
+	Uint32 below = to == 32 ? 0xffffffff : ( 1u << to ) - 1;
+	return below & ~( ( 1u << from ) - 1 );
+}
+
+// Range [lo, hi) of a cell when size source units are split into cells (at least one unit wide).
+static inline void CellRange( Uint32 cell, Uint32 cells, Uint32 size, Uint32 & lo, Uint32 & hi )
+{
+	lo = cell * size / cells;
+	hi = ( cell + 1 ) * size / cells;
+	if ( hi == lo )
+		hi = lo + 1;
+}
+
+bool IsValidObservationFormat( const ObservationFormat & format )
+{
+	const Uint32 rowCells = format.Upright ? format.Width : format.Height;
+	const Uint32 bitCells = format.Upright ? format.Height : format.Width;
+	return format.OutputMode <= ObservationFormat::Packed && rowCells >= 1 && rowCells <= kVramRows && bitCells >= 1 && bitCells <= kVramRowBits;
+}
+
+size_t ObservationSize( const ObservationFormat & format )
+{
+	if ( format.OutputMode == ObservationFormat::Packed )
+		return ( ( format.Width + 7 ) / 8 ) * format.Height;
+	else
+		return format.Width * format.Height;
+}
+
+void BuildObservation( const ObservationFormat & format, const Uint8 * vram, const Uint8 * previousVram, Uint8 * out )
+{
+	// VRAM rows as words (bit n of a row is bit n % 32 of word n / 32), with last frame ORed in if asked.
+	Uint32 rows[ kVramRows ][ kVramRowWords ];
+	for ( Uint32 row = 0; row < kVramRows; ++row )
+	{
+		for ( Uint32 word = 0; word < kVramRowWords; ++word )
+		{
+			const Uint8 * b = &vram[ row * 32 + word * 4 ];
+			rows[ row ][ word ] = b[ 0 ] | ( b[ 1 ] << 8 ) | ( b[ 2 ] << 16 ) | ( ( Uint32 )b[ 3 ] << 24 );
+
+			if ( format.MaxOfLastTwoFrames )
+			{
+				const Uint8 * p = &previousVram[ row * 32 + word * 4 ];
+				rows[ row ][ word ] |= p[ 0 ] | ( p[ 1 ] << 8 ) | ( p[ 2 ] << 16 ) | ( ( Uint32 )p[ 3 ] << 24 );
+			}
+		}
+	}
+
+	bool packed = format.OutputMode == ObservationFormat::Packed;
+	size_t stride = packed ? ( format.Width + 7 ) / 8 : format.Width;
+	if ( packed )
+	{
+		memset( out, 0, ObservationSize( format ) );
+	}
+
+	// Upright, output columns walk VRAM rows and output rows walk the bits (from the top, so downwards);
+	// otherwise output rows walk VRAM rows and output columns walk the bits.
+	Uint32 rowCells = format.Upright ? format.Width : format.Height;
+	Uint32 bitCells = format.Upright ? format.Height : format.Width;
+	assert( IsValidObservationFormat( format ) );
+
+	// The bits each cell covers are the same on every row, so work out their words and masks once.
+	struct BitCell
+	{
+		Uint32	FirstWord;
+		Uint32	LastWord;
+		Uint32	Bits;
+		Uint32	Masks[ kVramRowWords ];
+	};
+	BitCell cells[ kVramRowBits ];
+	for ( Uint32 bitCell = 0; bitCell < bitCells; ++bitCell )
+	{
+		Uint32 lo, hi;
+		CellRange( bitCell, bitCells, kVramRowBits, lo, hi );
+		if ( format.Upright )
+		{
+			Uint32 top = lo;
+			lo = kVramRowBits - hi;
+			hi = kVramRowBits - top;
+		}
+
+		BitCell & cell = cells[ bitCell ];
+		cell.FirstWord = lo / 32;
+		cell.LastWord = ( hi - 1 ) / 32;
+		cell.Bits = hi - lo;
+		for ( Uint32 word = cell.FirstWord; word <= cell.LastWord; ++word )
+		{
+			cell.Masks[ word ] = WordMask( word, lo, hi );
+		}
+	}
+
+	for ( Uint32 rowCell = 0; rowCell < rowCells; ++rowCell )
+	{
+		Uint32 firstRow, endRow;
+		CellRange( rowCell, rowCells, kVramRows, firstRow, endRow );
+
+		// Every row of the cell ORed together, for the max pooled modes.
+		Uint32 any[ kVramRowWords ] = { 0 };
+		for ( Uint32 row = firstRow; row < endRow; ++row )
+		{
+			for ( Uint32 word = 0; word < kVramRowWords; ++word )
+			{
+				any[ word ] |= rows[ row ][ word ];
+			}
+		}
+
+		for ( Uint32 bitCell = 0; bitCell < bitCells; ++bitCell )
+		{
+			const BitCell & cell = cells[ bitCell ];
+			Uint32 x = format.Upright ? rowCell : bitCell;
+			Uint32 y = format.Upright ? bitCell : rowCell;
+
+			if ( format.OutputMode == ObservationFormat::Average )
+			{
+				Uint32 lit = 0;
+				for ( Uint32 word = cell.FirstWord; word <= cell.LastWord; ++word )
+				{
+					Uint32 mask = cell.Masks[ word ];
+					for ( Uint32 row = firstRow; row < endRow; ++row )
+					{
+						lit += PopCount( rows[ row ][ word ] & mask );
+					}
+				}
+				out[ y * stride + x ] = ( Uint8 )( lit * 255 / ( ( endRow - firstRow ) * cell.Bits ) );
+			}
+			else
+			{
+				Uint32 lit = 0;
+				for ( Uint32 word = cell.FirstWord; word <= cell.LastWord; ++word )
+				{
+					lit |= any[ word ] & cell.Masks[ word ];
+				}
+
+				if ( packed )
+				{
+					if ( lit )
+					{
+						out[ y * stride + x / 8 ] |= 1 << ( x & 7 );
+					}
+				}
+				else
+				{
+					out[ y * stride + x ] = lit ? 0xff : 0x00;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stddef.h>
+#include <SDL.h>
+
+// ------------------------------------------------------------
+// Observations built straight from the packed VRAM.
+//
+// VRAM is 224 rows of 32 bytes, each row 256 pixels with the lowest bit
+// first; the monitor is mounted on its side, so upright the rows are the
+// columns of the picture (left to right) and the bits run bottom to top.
+// Each output pixel covers a rectangle of VRAM pixels and is reduced from
+// the bits directly (ORs of whole words, popcounts of masked words) with no
+// intermediate full size image.
+// ------------------------------------------------------------
+
+struct ObservationFormat
+{
+	enum Mode
+	{
+		MaxPool = 0,	// One byte per pixel, 255 if any pixel in the rectangle is lit.
+		Average,		// One byte per pixel, 0-255 for the share of the rectangle lit.
+		Packed,			// One bit per pixel (lowest bit first, rows padded to bytes), set if any pixel is lit.
+	};
+
+	ObservationFormat( ) : OutputMode( MaxPool ), Width( 84 ), Height( 84 ), Upright( true ), MaxOfLastTwoFrames( false ) { }
+
+	Mode	OutputMode;
+	Uint32	Width;				// Up to the VRAM size (224 x 256 upright, 256 x 224 otherwise).
+	Uint32	Height;
+	bool	Upright;			// Rotate to the picture the player sees (224 x 256), otherwise VRAM order (256 x 224).
+	bool	MaxOfLastTwoFrames;	// Combine with the previous frame, so sprites drawn on alternate frames are not lost.
+};
+
+// True if the mode is known and the size is at least 1 x 1 and no more than the VRAM's (see Width).
+bool IsValidObservationFormat( const ObservationFormat & format );
+
+// Bytes needed for one observation.
+size_t ObservationSize( const ObservationFormat & format );
+
+// vram is the 0x1c00 bytes from 0x2400; previousVram is last frame's (only read if MaxOfLastTwoFrames is set).
+void BuildObservation( const ObservationFormat & format, const Uint8 * vram, const Uint8 * previousVram, Uint8 * out );
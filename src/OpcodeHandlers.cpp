@@ -0,0 +1,319 @@
+#include "OpcodeHandlers.h"
+#include "Alu.h"
+
+typedef Cpu8080::CommandProcessingUnit::Registers Registers;
+
+// ------------------------------------------------------------
+// Operands.
+// ------------------------------------------------------------
+
+// Folds the mirrors back into the 16K address space (or leaves the address alone in flat memory), as the interpreter does.
+static inline Uint16 MapAddress( const Cpu8080 & chip8, Uint16 addr )
+{
+	return chip8.Memory.Flat ? addr : CheckAddress( addr );
+}
+
+// The register an opcode's 3 bit field names (B to L are stored swapped in pairs, see RegIndex).
+template< int R >
+struct Operand
+{
+	static inline Uint8 Get( const Cpu8080 & chip8 )
+	{
+		return chip8.Cpu.Regs.gpr[ R ^ 1 ];
+	}
+
+	static inline void Set( Cpu8080 & chip8, Uint8 value )
+	{
+		chip8.Cpu.Regs.gpr[ R ^ 1 ] = value;
+	}
+};
+
+// M, the byte at HL.
+template< >
+struct Operand< Registers::Gpr::___MEMORY >
+{
+	static inline Uint8 Get( const Cpu8080 & chip8 )
+	{
+		return chip8.Memory[ MapAddress( chip8, chip8.Cpu.Regs.gprPair[ Registers::GprPair::HL ] ) ];
+	}
+
+	static inline void Set( Cpu8080 & chip8, Uint8 value )
+	{
+		chip8.Memory.Write8( MapAddress( chip8, chip8.Cpu.Regs.gprPair[ Registers::GprPair::HL ] ), value );
+	}
+};
+
+template< >
+struct Operand< Registers::Gpr::___ACCUMULATOR >
+{
+	static inline Uint8 Get( const Cpu8080 & chip8 )
+	{
+		return chip8.Cpu.Regs.accumulator;
+	}
+
+	static inline void Set( Cpu8080 & chip8, Uint8 value )
+	{
+		chip8.Cpu.Regs.accumulator = value;
+	}
+};
+
+// The register pair an opcode's 2 bit field names (BC, DE, HL, then SP).
+template< int P >
+struct PairOperand
+{
+	static inline Uint16 & Location( Cpu8080 & chip8 )
+	{
+		return chip8.Cpu.Regs.gprPair[ P ];
+	}
+};
+
+template< >
+struct PairOperand< 3 >
+{
+	static inline Uint16 & Location( Cpu8080 & chip8 )
+	{
+		return chip8.Cpu.Regs.sp;
+	}
+};
+
+// ADD to CMP (AluOp::T) on the accumulator, with the interpreter's flags.
+template< int Op >
+struct AluOperation;
+
+template< > struct AluOperation< AluOp::Add > { static inline void Run( Registers & regs, Uint8 value ) { AluAdd( regs, value, 0 ); } };
+template< > struct AluOperation< AluOp::Adc > { static inline void Run( Registers & regs, Uint8 value ) { AluAdd( regs, value, regs.flags.cy ); } };
+template< > struct AluOperation< AluOp::Sub > { static inline void Run( Registers & regs, Uint8 value ) { regs.accumulator = AluSubtract( regs, value, 0 ); } };
+template< > struct AluOperation< AluOp::Sbb > { static inline void Run( Registers & regs, Uint8 value ) { regs.accumulator = AluSubtract( regs, value, regs.flags.cy ); } };
+template< > struct AluOperation< AluOp::Ana > { static inline void Run( Registers & regs, Uint8 value ) { AluAnd( regs, value ); } };
+template< > struct AluOperation< AluOp::Xra > { static inline void Run( Registers & regs, Uint8 value ) { AluXor( regs, value ); } };
+template< > struct AluOperation< AluOp::Ora > { static inline void Run( Registers & regs, Uint8 value ) { AluOr( regs, value ); } };
+template< > struct AluOperation< AluOp::Cmp > { static inline void Run( Registers & regs, Uint8 value ) { AluSubtract( regs, value, 0 ); } };
+
+// Moves pc past an instruction that carries on to the next one.
+template< int Size >
+static inline void Advance( Cpu8080 & chip8 )
+{
+	chip8.Cpu.Regs.pc += Size;
+}
+
+static inline Uint8 Immediate( const Cpu8080 & chip8 )
+{
+	const address operandPc = chip8.Cpu.Regs.pc + 1;
+	return chip8.Memory.Rom[ operandPc ];
+}
+
+static inline Uint16 Immediate16( const Cpu8080 & chip8 )
+{
+	const address operandPc = chip8.Cpu.Regs.pc + 1;
+	return ( Uint16 )( ( chip8.Memory.Rom[ operandPc + 1 ] << 8 ) | chip8.Memory.Rom[ operandPc ] );
+}
+
+// ------------------------------------------------------------
+// Handlers.
+// ------------------------------------------------------------
+
+struct OpcodeGroup
+{
+	enum T
+	{
+		Interpreted = 0,
+		Nop,
+		Move,				// MOV d,s (d in bits 3-5, s in bits 0-2).
+		MoveImmediate,		// MVI d.
+		Increment,			// INR d.
+		Decrement,			// DCR d.
+		Alu,				// ADD s to CMP s (the op in bits 3-5).
+		AluImmediate,		// ADI to CPI.
+		LoadPair,			// LXI p (p in bits 4-5).
+		IncrementPair,		// INX p.
+		DecrementPair,		// DCX p.
+		AddPair,			// DAD p.
+		StoreIndirect,		// STAX B, STAX D.
+		LoadIndirect,		// LDAX B, LDAX D.
+	};
+};
+
+template< int Op >
+struct OpcodeGroupOf
+{
+	enum
+	{
+		Value =
+			Op == 0x00					? OpcodeGroup::Nop :
+			Op == 0x76					? OpcodeGroup::Interpreted :
+			( Op & 0xc0 ) == 0x40		? OpcodeGroup::Move :
+			( Op & 0xc7 ) == 0x06		? OpcodeGroup::MoveImmediate :
+			( Op & 0xc7 ) == 0x04		? OpcodeGroup::Increment :
+			( Op & 0xc7 ) == 0x05		? OpcodeGroup::Decrement :
+			( Op & 0xc0 ) == 0x80		? OpcodeGroup::Alu :
+			( Op & 0xc7 ) == 0xc6		? OpcodeGroup::AluImmediate :
+			( Op & 0xcf ) == 0x01		? OpcodeGroup::LoadPair :
+			( Op & 0xcf ) == 0x03		? OpcodeGroup::IncrementPair :
+			( Op & 0xcf ) == 0x0b		? OpcodeGroup::DecrementPair :
+			( Op & 0xcf ) == 0x09		? OpcodeGroup::AddPair :
+			( Op & 0xef ) == 0x02		? OpcodeGroup::StoreIndirect :
+			( Op & 0xef ) == 0x0a		? OpcodeGroup::LoadIndirect :
+										  OpcodeGroup::Interpreted
+	};
+};
+
+// The handler for each opcode, by its group. The ones not specialised are run by the interpreter's switch, and their
+// table entries are NULL (Run is only there to be named, it is never called).
+template< int Op, int Group = OpcodeGroupOf< Op >::Value >
+struct Opcode
+{
+	static void Run( Cpu8080 & )
+	{
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::Nop >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		Advance< 1 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::Move >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		Operand< ( Op >> 3 ) & 7 >::Set( chip8, Operand< Op & 7 >::Get( chip8 ) );
+		Advance< 1 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::MoveImmediate >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		Operand< ( Op >> 3 ) & 7 >::Set( chip8, Immediate( chip8 ) );
+		Advance< 2 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::Increment >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		typedef Operand< ( Op >> 3 ) & 7 > Destination;
+		Destination::Set( chip8, AluIncrement( chip8.Cpu.Regs, Destination::Get( chip8 ) ) );
+		Advance< 1 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::Decrement >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		typedef Operand< ( Op >> 3 ) & 7 > Destination;
+		Destination::Set( chip8, AluDecrement( chip8.Cpu.Regs, Destination::Get( chip8 ) ) );
+		Advance< 1 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::Alu >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		AluOperation< ( Op >> 3 ) & 7 >::Run( chip8.Cpu.Regs, Operand< Op & 7 >::Get( chip8 ) );
+		Advance< 1 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::AluImmediate >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		AluOperation< ( Op >> 3 ) & 7 >::Run( chip8.Cpu.Regs, Immediate( chip8 ) );
+		Advance< 2 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::LoadPair >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		PairOperand< ( Op >> 4 ) & 3 >::Location( chip8 ) = Immediate16( chip8 );
+		Advance< 3 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::IncrementPair >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		PairOperand< ( Op >> 4 ) & 3 >::Location( chip8 ) += 1;
+		Advance< 1 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::DecrementPair >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		PairOperand< ( Op >> 4 ) & 3 >::Location( chip8 ) -= 1;
+		Advance< 1 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::AddPair >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		AluDoubleAdd( chip8.Cpu.Regs, PairOperand< ( Op >> 4 ) & 3 >::Location( chip8 ) );
+		Advance< 1 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::StoreIndirect >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		chip8.Memory.Write8( MapAddress( chip8, PairOperand< ( Op >> 4 ) & 3 >::Location( chip8 ) ), chip8.Cpu.Regs.accumulator );
+		Advance< 1 >( chip8 );
+	}
+};
+
+template< int Op >
+struct Opcode< Op, OpcodeGroup::LoadIndirect >
+{
+	static void Run( Cpu8080 & chip8 )
+	{
+		chip8.Cpu.Regs.accumulator = chip8.Memory[ MapAddress( chip8, PairOperand< ( Op >> 4 ) & 3 >::Location( chip8 ) ) ];
+		Advance< 1 >( chip8 );
+	}
+};
+
+// ------------------------------------------------------------
+// Table.
+// ------------------------------------------------------------
+
+#define _OpcodeHandler( _Op )		( ( int )OpcodeGroupOf< _Op >::Value == ( int )OpcodeGroup::Interpreted ? NULL : &Opcode< _Op >::Run )
+#define _OpcodeHandlers4( _Base )	_OpcodeHandler( _Base ), _OpcodeHandler( _Base + 1 ), _OpcodeHandler( _Base + 2 ), _OpcodeHandler( _Base + 3 )
+#define _OpcodeHandlers16( _Base )	_OpcodeHandlers4( _Base ), _OpcodeHandlers4( _Base + 4 ), _OpcodeHandlers4( _Base + 8 ), _OpcodeHandlers4( _Base + 12 )
+
+const OpcodeHandler kOpcodeHandlers[ 256 ] =
+{
+	_OpcodeHandlers16( 0x00 ), _OpcodeHandlers16( 0x10 ), _OpcodeHandlers16( 0x20 ), _OpcodeHandlers16( 0x30 ),
+	_OpcodeHandlers16( 0x40 ), _OpcodeHandlers16( 0x50 ), _OpcodeHandlers16( 0x60 ), _OpcodeHandlers16( 0x70 ),
+	_OpcodeHandlers16( 0x80 ), _OpcodeHandlers16( 0x90 ), _OpcodeHandlers16( 0xa0 ), _OpcodeHandlers16( 0xb0 ),
+	_OpcodeHandlers16( 0xc0 ), _OpcodeHandlers16( 0xd0 ), _OpcodeHandlers16( 0xe0 ), _OpcodeHandlers16( 0xf0 ),
+};
+
+#undef _OpcodeHandlers16
+#undef _OpcodeHandlers4
+#undef _OpcodeHandler
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <SDL.h>
+
+#include "Cpu8080.h"
+
+// ------------------------------------------------------------
+// Opcode handlers specialised at compile time.
+//
+// The interpreter's switch decodes register fields as it runs: a MOV
+// finds its source and destination with RegIndex (an assert and an XOR
+// each), and then checks for M. Here every opcode gets its own instance of
+// a handler template, with the registers, the memory operand and the ALU
+// op all template arguments. So a MOV is one load and one store at fixed
+// offsets, and an ADD only works out the flags that ADD sets.
+//
+// Covered: MOV, MVI, INR, DCR, the ALU ops and their immediates, LXI,
+// INX, DCX, DAD, STAX, LDAX and NOP. ExecuteInstruction runs these through
+// the table, and everything else (jumps, calls, the stack, I/O, EI/DI,
+// ...) through its switch. So StepCpu, StepCpuBlock and the engines built
+// on them all use the handlers.
+//
+// The table is filled in by the compiler (addresses of template instances,
+// no code runs to build it).
+// ------------------------------------------------------------
+
+typedef void ( * OpcodeHandler )( Cpu8080 & chip8 );
+
+// Indexed by opcode, NULL for the ones left to the switch. Executes the instruction at pc and moves pc on, nothing
+// else: keeping the clock, taking interrupts and idle loops are left to the caller, as for ExecuteInstruction.
+extern const OpcodeHandler kOpcodeHandlers[ 256 ];
@@ -0,0 +1,133 @@
+#include "RamProbe.h"
+
+#define Field( _Name, _Address, _Length, _Type, _Match, _Member ) { _Name, _Address, _Length, RamField::_Type, _Match, offsetof( InvadersRamState, _Member ) }
+
+const RamField kInvadersRamFields[] =
+{
+	Field( "Score",				0x20f8, 2,	Bcd,		0,		Score ),
+	Field( "HighScore",			0x20f4, 2,	Bcd,		0,		HighScore ),
+	Field( "Credits",			0x20eb, 1,	Bcd,		0,		Credits ),
+	Field( "Playing",			0x20ef, 1,	NonZero,	0,		Playing ),
+	Field( "PlayerAlive",		0x2015, 1,	Flag,		0xff,	PlayerAlive ),
+	Field( "ShipsRemaining",	0x21ff, 1,	Byte,		0,		ShipsRemaining ),
+	Field( "PlayerX",			0x201b, 1,	Byte,		0,		PlayerX ),
+	Field( "ShotStatus",		0x2025, 1,	Byte,		0,		ShotStatus ),
+	Field( "ShotX",				0x202a, 1,	Byte,		0,		ShotX ),
+	Field( "ShotY",				0x2029, 1,	Byte,		0,		ShotY ),
+	Field( "AliensRemaining",	0x2082, 1,	Byte,		0,		AliensRemaining ),
+	Field( "RackX",				0x200a, 1,	Byte,		0,		RackX ),
+	Field( "RackY",				0x2009, 1,	Byte,		0,		RackY ),
+	Field( "RackDirection",		0x200d, 1,	Byte,		0,		RackDirection ),
+	Field( "SaucerActive",		0x2084, 1,	NonZero,	0,		SaucerActive ),
+	Field( "Aliens",			0x2100, 55,	Bytes,		0,		Aliens ),
+};
+
+#undef Field
+
+const size_t kNumInvadersRamFields = sizeof( kInvadersRamFields ) / sizeof( kInvadersRamFields[ 0 ] );
+
+// One feature per field, Length for Bytes fields.
+static size_t CountRamFeatures( const RamField * fields, size_t numFields )
+{
+	size_t features = 0;
+	for ( size_t ix = 0; ix < numFields; ++ix )
+	{
+		features += fields[ ix ].Type == RamField::Bytes ? fields[ ix ].Length : 1;
+	}
+	return features;
+}
+
+const size_t kNumInvadersRamFeatures = CountRamFeatures( kInvadersRamFields, kNumInvadersRamFields );
+
+// Value of a (non Bytes) field.
+static Uint32 DecodeField( const Cpu8080 & chip8, const RamField & field )
+{
+	const Uint8 * ram = &chip8.Memory[ field.Address ];
+
+	switch ( field.Type )
+	{
+		case RamField::Flag:
+		{
+			return ram[ 0 ] == field.Match;
+		}
+		break;
+		case RamField::NonZero:
+		{
+			return ram[ 0 ] != 0;
+		}
+		break;
+		case RamField::Bcd:
+		{
+			Uint32 value = 0;
+			for ( int ix = field.Length - 1; ix >= 0; --ix )
+			{
+				value = value * 100 + ( ram[ ix ] >> 4 ) * 10 + ( ram[ ix ] & 0xf );
+			}
+			return value;
+		}
+		break;
+	}
+
+	return ram[ 0 ];
+}
+
+void ProbeInvadersRam( const Cpu8080 & chip8, InvadersRamState & state )
+{
+	Uint8 * base = ( Uint8 * )&state;
+
+	for ( size_t ix = 0; ix < kNumInvadersRamFields; ++ix )
+	{
+		const RamField & field = kInvadersRamFields[ ix ];
+		Uint8 * member = base + field.Offset;
+
+		if ( field.Type == RamField::Bytes )
+		{
+			memcpy( member, &chip8.Memory[ field.Address ], field.Length );
+		}
+		else if ( field.Type == RamField::Bcd )
+		{
+			*( Uint32 * )member = DecodeField( chip8, field );
+		}
+		else
+		{
+			*member = ( Uint8 )DecodeField( chip8, field );
+		}
+	}
+}
+
+void ReadRamFeatures( const Cpu8080 & chip8, float * features )
+{
+	float * out = features;
+
+	for ( size_t ix = 0; ix < kNumInvadersRamFields; ++ix )
+	{
+		const RamField & field = kInvadersRamFields[ ix ];
+
+		if ( field.Type == RamField::Bytes )
+		{
+			for ( size_t jx = 0; jx < field.Length; ++jx )
+			{
+				*out++ = chip8.Memory[ field.Address + jx ];
+			}
+		}
+		else
+		{
+			*out++ = ( float )DecodeField( chip8, field );
+		}
+	}
+
+	assert( ( size_t )( out - features ) == kNumInvadersRamFeatures );
+}
+
+Uint32 PointsScored( const InvadersRamState & before, const InvadersRamState & after )
+{
+	if ( after.Score >= before.Score )
+		return after.Score - before.Score;
+	else
+		return after.Score + 10000 - before.Score;
+}
+
+bool LostLife( const InvadersRamState & before, const InvadersRamState & after )
+{
+	return before.PlayerAlive && ! after.PlayerAlive;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "Cpu8080.h"
+
+// ------------------------------------------------------------
+// RAM probe for the invaders ROM.
+//
+// The game keeps its state at fixed addresses in work RAM (the X20xx/X21xx
+// labels in data/invaders.asm). kInvadersRamFields names them, says how each
+// is encoded and where it goes in InvadersRamState; ProbeInvadersRam decodes
+// the whole table in one pass, and ReadRamFeatures flattens the same table
+// into a feature vector. Adding a field is a table entry plus a member.
+// ------------------------------------------------------------
+
+struct InvadersRamState
+{
+	Uint32	Score;				// Player 1.
+	Uint32	HighScore;
+	Uint32	Credits;
+	Uint8	Playing;			// Game mode (0 in attract).
+	Uint8	PlayerAlive;		// 0 while the player's ship is exploding.
+	Uint8	ShipsRemaining;		// Player 1, not counting the one on screen.
+	Uint8	PlayerX;
+	Uint8	ShotStatus;			// Player's shot: 0 ready, 1 fired, 2 moving, 3+ hit something.
+	Uint8	ShotX;
+	Uint8	ShotY;
+	Uint8	AliensRemaining;
+	Uint8	RackX;				// Reference alien (bottom left of the rack).
+	Uint8	RackY;
+	Uint8	RackDirection;		// 0 right, 1 left.
+	Uint8	SaucerActive;
+	Uint8	Aliens[ 55 ];		// Player 1, 1 if alive, 11 per row from the bottom.
+};
+
+struct RamField
+{
+	enum Encoding
+	{
+		Byte = 0,		// Uint8 as is.
+		Flag,			// Uint8, 1 if the byte equals Match.
+		NonZero,		// Uint8, 1 if the byte is not 0.
+		Bcd,			// Uint32 from Length bytes of BCD, low byte first.
+		Bytes,			// Length Uint8s as they are.
+	};
+
+	const char *	Name;
+	address			Address;
+	Uint8			Length;
+	Uint8			Type;		// Encoding
+	Uint8			Match;		// For Flag.
+	size_t			Offset;		// Into InvadersRamState.
+};
+
+extern const RamField kInvadersRamFields[];
+extern const size_t kNumInvadersRamFields;
+
+// Number of values ReadRamFeatures writes (one per field, Length for Bytes fields).
+extern const size_t kNumInvadersRamFeatures;
+
+void ProbeInvadersRam( const Cpu8080 & chip8, InvadersRamState & state );
+
+// Writes kNumInvadersRamFeatures values, in table order.
+void ReadRamFeatures( const Cpu8080 & chip8, float * features );
+
+// Points scored between two states (the score rolls over at 10000).
+Uint32 PointsScored( const InvadersRamState & before, const InvadersRamState & after );
+
+// True if the player's ship was destroyed between two states.
+bool LostLife( const InvadersRamState & before, const InvadersRamState & after );
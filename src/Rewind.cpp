@@ -0,0 +1,242 @@
+#include <stdio.h>
+
+#include "Rewind.h"
+#include "Delta.h"
+
+// ------------------------------------------------------------
+// States.
+// ------------------------------------------------------------
+
+// The machine as is (the ROM is shared, Memory only points at it).
+static const size_t kStateSize = sizeof( Cpu8080 );
+
+static void SaveState( const Cpu8080 & chip8, Uint8 * state )
+{
+	memcpy( state, &chip8, kStateSize );
+}
+
+static void LoadState( const Uint8 * state, Cpu8080 & chip8 )
+{
+	memcpy( &chip8, state, kStateSize );
+}
+
+// ------------------------------------------------------------
+// Buffer.
+// ------------------------------------------------------------
+
+RewindBuffer::RewindBuffer( Uint32 frames )
+: m_MaxFrames( frames )
+, m_NumFrames( 0 )
+, m_Quit( false )
+, m_SeekState( Seek::None )
+, m_SeekFrame( 0 )
+{
+	m_Scratch.resize( kStateSize );
+	m_SeekResult.resize( kStateSize );
+
+	m_pLock = SDL_CreateMutex( );
+	m_pWake = SDL_CreateCond( );
+	m_pWorker = SDL_CreateThread( WorkerThread, this );
+}
+
+RewindBuffer::~RewindBuffer( )
+{
+	SDL_LockMutex( m_pLock );
+	m_Quit = true;
+	SDL_CondSignal( m_pWake );
+	SDL_UnlockMutex( m_pLock );
+
+	SDL_WaitThread( m_pWorker, NULL );
+	SDL_DestroyCond( m_pWake );
+	SDL_DestroyMutex( m_pLock );
+}
+
+void RewindBuffer::Capture( const Cpu8080 & chip8 )
+{
+	// Encode outside the lock, the worker only reads what is already in the buffer.
+	SaveState( chip8, &m_Scratch[ 0 ] );
+
+	bool startSegment = m_Segments.empty( ) || chip8.Frame != GetNewestFrame( ) + 1 || m_Segments.back( ).Deltas.size( ) + 1 >= kRewindKeyframeInterval;
+
+	std::vector< Uint8 > delta;
+	if ( ! startSegment )
+	{
+		EncodeDelta( &m_Scratch[ 0 ], &m_Segments.back( ).Keyframe[ 0 ], kStateSize, delta );
+	}
+
+	SDL_LockMutex( m_pLock );
+
+	if ( ! m_Segments.empty( ) && chip8.Frame != GetNewestFrame( ) + 1 )
+	{
+		// Not following on from the last frame, so the history no longer leads here.
+		m_Segments.clear( );
+		m_NumFrames = 0;
+	}
+
+	if ( startSegment )
+	{
+		m_Segments.push_back( Segment( ) );
+		m_Segments.back( ).FirstFrame = chip8.Frame;
+		m_Segments.back( ).Keyframe = m_Scratch;
+	}
+	else
+	{
+		m_Segments.back( ).Deltas.push_back( std::vector< Uint8 >( ) );
+		m_Segments.back( ).Deltas.back( ).swap( delta );
+	}
+	m_NumFrames++;
+
+	// Drop whole segments, so we keep between N and N + kRewindKeyframeInterval frames.
+	while ( m_Segments.size( ) > 1 && m_NumFrames - ( m_Segments.front( ).Deltas.size( ) + 1 ) >= m_MaxFrames )
+	{
+		m_NumFrames -= ( Uint32 )m_Segments.front( ).Deltas.size( ) + 1;
+		m_Segments.pop_front( );
+	}
+
+	SDL_UnlockMutex( m_pLock );
+}
+
+bool RewindBuffer::IsEmpty( ) const
+{
+	return m_Segments.empty( );
+}
+
+Uint32 RewindBuffer::GetOldestFrame( ) const
+{
+	assert( ! IsEmpty( ) );
+	return m_Segments.front( ).FirstFrame;
+}
+
+Uint32 RewindBuffer::GetNewestFrame( ) const
+{
+	assert( ! IsEmpty( ) );
+	return m_Segments.back( ).FirstFrame + ( Uint32 )m_Segments.back( ).Deltas.size( );
+}
+
+size_t RewindBuffer::GetMemoryUsed( ) const
+{
+	size_t used = 0;
+	for ( size_t ix = 0; ix < m_Segments.size( ); ++ix )
+	{
+		used += m_Segments[ ix ].Keyframe.size( );
+		for ( size_t jx = 0; jx < m_Segments[ ix ].Deltas.size( ); ++jx )
+		{
+			used += m_Segments[ ix ].Deltas[ jx ].size( );
+		}
+	}
+	return used;
+}
+
+bool RewindBuffer::StartSeek( Uint32 frame )
+{
+	if ( IsEmpty( ) || frame < GetOldestFrame( ) || frame > GetNewestFrame( ) )
+		return false;
+
+	SDL_LockMutex( m_pLock );
+	bool idle = m_SeekState == Seek::None;
+	if ( idle )
+	{
+		m_SeekFrame = frame;
+		m_SeekState = Seek::Requested;
+		SDL_CondSignal( m_pWake );
+	}
+	SDL_UnlockMutex( m_pLock );
+
+	return idle;
+}
+
+bool RewindBuffer::IsSeeking( ) const
+{
+	SDL_LockMutex( m_pLock );
+	bool seeking = m_SeekState != Seek::None;
+	SDL_UnlockMutex( m_pLock );
+
+	return seeking;
+}
+
+bool RewindBuffer::FinishSeek( Cpu8080 & chip8 )
+{
+	SDL_LockMutex( m_pLock );
+	bool ready = m_SeekState == Seek::Ready;
+	if ( ready )
+	{
+		LoadState( &m_SeekResult[ 0 ], chip8 );
+		Truncate( m_SeekFrame );
+		m_SeekState = Seek::None;
+	}
+	else if ( m_SeekState == Seek::Failed )
+	{
+		printf( "Rewind: couldn't decode frame %u\n", m_SeekFrame );
+		m_SeekState = Seek::None;
+	}
+	SDL_UnlockMutex( m_pLock );
+
+	return ready;
+}
+
+int SDLCALL RewindBuffer::WorkerThread( void * userData )
+{
+	RewindBuffer * thisPtr = ( RewindBuffer * )userData;
+
+	SDL_LockMutex( thisPtr->m_pLock );
+	for ( ; ; )
+	{
+		while ( ! thisPtr->m_Quit && thisPtr->m_SeekState != Seek::Requested )
+		{
+			SDL_CondWait( thisPtr->m_pWake, thisPtr->m_pLock );
+		}
+
+		if ( thisPtr->m_Quit )
+			break;
+
+		// Copy out what the frame is made of and decode it without the lock, so the main thread isn't held up. The result
+		// is ours until the state says otherwise.
+		std::vector< Uint8 > delta;
+		thisPtr->FindFrame( thisPtr->m_SeekFrame, thisPtr->m_SeekResult, delta );
+		SDL_UnlockMutex( thisPtr->m_pLock );
+
+		bool decoded = ApplyDelta( delta, kStateSize, &thisPtr->m_SeekResult[ 0 ] );
+
+		SDL_LockMutex( thisPtr->m_pLock );
+		thisPtr->m_SeekState = decoded ? Seek::Ready : Seek::Failed;
+	}
+	SDL_UnlockMutex( thisPtr->m_pLock );
+
+	return 0;
+}
+
+// The keyframe of the frame's segment and the frame's delta against it (empty for the keyframe itself).
+void RewindBuffer::FindFrame( Uint32 frame, std::vector< Uint8 > & keyframe, std::vector< Uint8 > & delta ) const
+{
+	// Segments are in frame order, find the last one starting at or before the frame.
+	size_t ix = m_Segments.size( ) - 1;
+	while ( m_Segments[ ix ].FirstFrame > frame )
+	{
+		ix--;
+	}
+
+	const Segment & segment = m_Segments[ ix ];
+	keyframe = segment.Keyframe;
+	delta.clear( );
+	if ( frame > segment.FirstFrame )
+	{
+		delta = segment.Deltas[ frame - segment.FirstFrame - 1 ];
+	}
+}
+
+void RewindBuffer::Truncate( Uint32 frame )
+{
+	while ( ! m_Segments.empty( ) && m_Segments.back( ).FirstFrame > frame )
+	{
+		m_NumFrames -= ( Uint32 )m_Segments.back( ).Deltas.size( ) + 1;
+		m_Segments.pop_back( );
+	}
+
+	if ( ! m_Segments.empty( ) )
+	{
+		Segment & segment = m_Segments.back( );
+		size_t keep = frame - segment.FirstFrame;
+		m_NumFrames -= ( Uint32 )( segment.Deltas.size( ) - keep );
+		segment.Deltas.resize( keep );
+	}
+}
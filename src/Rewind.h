@@ -0,0 +1,85 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <SDL.h>
+#include <SDL_thread.h>
+
+#include "Cpu8080.h"
+
+// ------------------------------------------------------------
+// Rewind buffer.
+//
+// Keeps the machine state at the end of each of the last N frames (a state
+// is the Cpu8080 itself, which only points at its ROM). Every
+// kRewindKeyframeInterval frames a keyframe is stored as is; the frames
+// after it are stored as the XOR against it, run length encoded (only a few
+// hundred bytes of RAM change per frame, so these are tiny).
+//
+// Seeking decodes on a worker thread: StartSeek queues the frame and
+// FinishSeek applies it once it is ready, without blocking the caller.
+// ------------------------------------------------------------
+
+static const Uint32 kRewindKeyframeInterval = 60;
+
+class RewindBuffer
+{
+public:
+
+	RewindBuffer( Uint32 frames );
+	~RewindBuffer( );
+
+	// Stores the machine's state. Call when RaiseInterrupt ends a frame.
+	void Capture( const Cpu8080 & chip8 );
+
+	bool IsEmpty( ) const;
+	Uint32 GetOldestFrame( ) const;
+	Uint32 GetNewestFrame( ) const;
+	size_t GetMemoryUsed( ) const;
+
+	// Starts decoding the state of a frame, returns false if it is not in the buffer (or a seek is in progress).
+	bool StartSeek( Uint32 frame );
+	bool IsSeeking( ) const;
+
+	// Applies the state being sought once it has been decoded (returns false until then) and forgets every later frame.
+	// If it couldn't be decoded the seek is dropped and the machine left as it was.
+	bool FinishSeek( Cpu8080 & chip8 );
+
+private:
+
+	struct Segment
+	{
+		Uint32							FirstFrame;
+		std::vector< Uint8 >			Keyframe;
+		std::vector< std::vector< Uint8 > >	Deltas;
+	};
+
+	struct Seek
+	{
+		enum T
+		{
+			None = 0,
+			Requested,
+			Ready,
+			Failed,
+		};
+	};
+
+	static int SDLCALL WorkerThread( void * userData );
+	void FindFrame( Uint32 frame, std::vector< Uint8 > & keyframe, std::vector< Uint8 > & delta ) const;
+	void Truncate( Uint32 frame );
+
+	Uint32					m_MaxFrames;
+	Uint32					m_NumFrames;
+	std::deque< Segment >	m_Segments;
+	std::vector< Uint8 >	m_Scratch;
+
+	// Shared with the worker (guarded by m_pLock).
+	SDL_mutex *				m_pLock;
+	SDL_cond *				m_pWake;
+	SDL_Thread *			m_pWorker;
+	bool					m_Quit;
+	int						m_SeekState;
+	Uint32					m_SeekFrame;
+	std::vector< Uint8 >	m_SeekResult;
+};
@@ -0,0 +1,419 @@
+#include <algorithm>
+#include <SDL.h>
+#include <SDL_thread.h>
+
+#include "Search.h"
+#include "Env.h"
+#include "RamProbe.h"
+#include "Snapshot.h"
+
+// Jobs (a node and an action) a thread takes at a time.
+static const Uint32 kJobsPerClaim = 8;
+
+// Score of a child that is out of the running.
+static const float kDeadScore = -1e30f;
+
+struct SearchNode
+{
+	MachineSnapshot	State;
+	Uint32			Parent;		// Into the previous step's nodes.
+	Uint8			Action;
+	bool			Reached;
+	float			Score;
+	Uint64			Hash;
+};
+
+// How a node was reached, kept for every step behind the beam.
+struct SearchTrail
+{
+	Uint32	Parent;
+	Uint8	Action;
+};
+
+struct SearchShared
+{
+	const SearchOptions *				Options;
+	const std::vector< SearchNode > *	Parents;
+	std::vector< SearchNode > *			Children;
+
+	// Guarded by Lock.
+	SDL_mutex *	Lock;
+	SDL_cond *	Wake;
+	SDL_cond *	Finished;
+	Uint32		NextJob;
+	Uint32		NumJobs;
+	Uint32		Busy;
+	bool		Quit;
+};
+
+struct SearchThread
+{
+	SearchShared *	Shared;
+	Cpu8080 *		Machine;
+	SnapshotPool	Pool;		// Pages of the children this thread expanded.
+	Uint64			Frames;
+	SDL_Thread *	Thread;
+};
+
+// ------------------------------------------------------------
+// Expanding nodes.
+// ------------------------------------------------------------
+
+static bool IsGoalReached( const SearchGoal & goal, const Cpu8080 & chip8, const InvadersRamState & ram )
+{
+	switch ( goal.Goal )
+	{
+		case SearchGoal::ClearWave:
+		{
+			return ram.Playing && ram.AliensRemaining == 0;
+		}
+		break;
+		case SearchGoal::RamValue:
+		{
+			return chip8.Memory[ CheckAddress( goal.Address ) ] == goal.Value;
+		}
+		break;
+	}
+
+	return false;
+}
+
+// Progress through the game: aliens destroyed first, then points, then ships in hand.
+static float ScoreState( const InvadersRamState & ram )
+{
+	return ( 55 - ram.AliensRemaining ) * 1000.f + ram.Score + ram.ShipsRemaining * 100000.f;
+}
+
+static void ExpandNode( SearchThread & thread, Uint32 job )
+{
+	const SearchShared & shared = *thread.Shared;
+	const SearchGoal & goal = shared.Options->Goal;
+	const Uint32 parentIndex = job / InvadersActionNum;
+	const SearchNode & parent = ( *shared.Parents )[ parentIndex ];
+	SearchNode & child = ( *shared.Children )[ job ];
+	Cpu8080 & chip8 = *thread.Machine;
+
+	RestoreSnapshot( parent.State, chip8 );
+	child.Parent = parentIndex;
+	child.Action = ( Uint8 )( job % InvadersActionNum );
+	child.Reached = false;
+
+	InvadersRamState previous;
+	InvadersRamState ram;
+	ProbeInvadersRam( chip8, previous );
+
+	bool dead = false;
+	chip8.Io.Inputs[ 1 ] = InvadersActionToInputs( child.Action );
+	for ( Uint32 frame = 0; frame < shared.Options->FramesPerStep; ++frame )
+	{
+		RunFrame( chip8 );
+		thread.Frames++;
+
+		ProbeInvadersRam( chip8, ram );
+		if ( IsGoalReached( goal, chip8, ram ) )
+		{
+			child.Reached = true;
+			break;
+		}
+
+		// Clearing a wave "as soon as possible" means not dying on the way, reproducing a bug might need to.
+		if ( ! ram.Playing || ( goal.Goal == SearchGoal::ClearWave && LostLife( previous, ram ) ) )
+		{
+			dead = true;
+			break;
+		}
+		previous = ram;
+	}
+
+	child.Score = dead ? kDeadScore : ScoreState( ram );
+	child.Hash = HashMachineState( chip8 );
+	SaveSnapshot( chip8, &parent.State, thread.Pool, child.State );
+}
+
+static int SDLCALL SearchWorker( void * userData )
+{
+	SearchThread & thread = *( SearchThread * )userData;
+	SearchShared & shared = *thread.Shared;
+
+	SDL_LockMutex( shared.Lock );
+	for ( ; ; )
+	{
+		while ( ! shared.Quit && shared.NextJob >= shared.NumJobs )
+		{
+			SDL_CondWait( shared.Wake, shared.Lock );
+		}
+
+		if ( shared.Quit )
+			break;
+
+		Uint32 first = shared.NextJob;
+		Uint32 last = std::min( first + kJobsPerClaim, shared.NumJobs );
+		shared.NextJob = last;
+		shared.Busy++;
+		SDL_UnlockMutex( shared.Lock );
+
+		for ( Uint32 job = first; job < last; ++job )
+		{
+			ExpandNode( thread, job );
+		}
+
+		SDL_LockMutex( shared.Lock );
+		shared.Busy--;
+		if ( shared.NextJob >= shared.NumJobs && shared.Busy == 0 )
+		{
+			SDL_CondSignal( shared.Finished );
+		}
+	}
+	SDL_UnlockMutex( shared.Lock );
+
+	return 0;
+}
+
+// Expands every parent with every action, returning once all the children are in.
+static void ExpandAll( SearchShared & shared, const std::vector< SearchNode > & parents, std::vector< SearchNode > & children )
+{
+	children.resize( parents.size( ) * InvadersActionNum );
+
+	SDL_LockMutex( shared.Lock );
+	shared.Parents = &parents;
+	shared.Children = &children;
+	shared.NextJob = 0;
+	shared.NumJobs = ( Uint32 )children.size( );
+	SDL_CondBroadcast( shared.Wake );
+
+	while ( shared.NextJob < shared.NumJobs || shared.Busy )
+	{
+		SDL_CondWait( shared.Finished, shared.Lock );
+	}
+	SDL_UnlockMutex( shared.Lock );
+}
+
+// ------------------------------------------------------------
+// Selection.
+// ------------------------------------------------------------
+
+// Same states next to each other, the best of each first (ties on the lower index, so results never depend on timing).
+struct ByHashThenScore
+{
+	ByHashThenScore( const std::vector< SearchNode > & nodes ) : Nodes( nodes ) { }
+
+	bool operator()( Uint32 a, Uint32 b ) const
+	{
+		if ( Nodes[ a ].Hash != Nodes[ b ].Hash )
+			return Nodes[ a ].Hash < Nodes[ b ].Hash;
+		if ( Nodes[ a ].Score != Nodes[ b ].Score )
+			return Nodes[ a ].Score > Nodes[ b ].Score;
+		return a < b;
+	}
+
+	const std::vector< SearchNode > & Nodes;
+};
+
+// Best first, ties on the hash (an arbitrary but repeatable pick, which keeps the beam varied while nothing scores).
+struct ByScore
+{
+	ByScore( const std::vector< SearchNode > & nodes ) : Nodes( nodes ) { }
+
+	bool operator()( Uint32 a, Uint32 b ) const
+	{
+		if ( Nodes[ a ].Score != Nodes[ b ].Score )
+			return Nodes[ a ].Score > Nodes[ b ].Score;
+		return Nodes[ a ].Hash < Nodes[ b ].Hash;
+	}
+
+	const std::vector< SearchNode > & Nodes;
+};
+
+// Actions from the start to a child of the last step.
+static void Backtrack( const std::vector< std::vector< SearchTrail > > & trails, const SearchNode & child, std::vector< Uint8 > & actions )
+{
+	actions.clear( );
+	actions.push_back( child.Action );
+
+	Uint32 node = child.Parent;
+	for ( size_t depth = trails.size( ); depth > 0; --depth )
+	{
+		const SearchTrail & trail = trails[ depth - 1 ][ node ];
+		actions.push_back( trail.Action );
+		node = trail.Parent;
+	}
+
+	std::reverse( actions.begin( ), actions.end( ) );
+}
+
+bool RunSearch( const Cpu8080 & chip8, const SearchOptions & options, SearchResult & result )
+{
+	assert( options.BeamWidth > 0 && options.FramesPerStep > 0 && options.Threads > 0 );
+
+	result.Found = false;
+	result.Actions.clear( );
+	result.FramesEmulated = 0;
+	result.StatesMerged = 0;
+
+	SearchShared shared;
+	shared.Options = &options;
+	shared.Parents = NULL;
+	shared.Children = NULL;
+	shared.Lock = SDL_CreateMutex( );
+	shared.Wake = SDL_CreateCond( );
+	shared.Finished = SDL_CreateCond( );
+	shared.NextJob = 0;
+	shared.NumJobs = 0;
+	shared.Busy = 0;
+	shared.Quit = false;
+
+	std::vector< SearchThread * > threads( options.Threads );
+	for ( size_t ix = 0; ix < threads.size( ); ++ix )
+	{
+		threads[ ix ] = new SearchThread;
+		threads[ ix ]->Shared = &shared;
+		threads[ ix ]->Machine = new Cpu8080( chip8 );
+		threads[ ix ]->Frames = 0;
+		threads[ ix ]->Thread = SDL_CreateThread( SearchWorker, threads[ ix ] );
+	}
+
+	// The beam's pages live in one pool per step (the previous step's are freed once the next is built).
+	SnapshotPool beamPools[ 2 ];
+	Uint32 beamPool = 0;
+	Cpu8080 * scratch = new Cpu8080( chip8 );
+
+	std::vector< SearchNode > beam( 1 );
+	std::vector< SearchNode > children;
+	std::vector< std::vector< SearchTrail > > trails;
+	SaveSnapshot( chip8, NULL, beamPools[ beamPool ], beam[ 0 ].State );
+
+	std::vector< Uint32 > order;
+	for ( Uint32 step = 0; step < options.MaxSteps && ! beam.empty( ); ++step )
+	{
+		ExpandAll( shared, beam, children );
+
+		// Done once any child gets there (the best of them if several do).
+		int reached = -1;
+		for ( Uint32 ix = 0; ix < children.size( ); ++ix )
+		{
+			if ( children[ ix ].Reached && ( reached < 0 || children[ ix ].Score > children[ reached ].Score ) )
+			{
+				reached = ix;
+			}
+		}
+		if ( reached >= 0 )
+		{
+			Backtrack( trails, children[ reached ], result.Actions );
+			result.Found = true;
+			break;
+		}
+
+		// Drop the dead, then every state reached more than once but the best.
+		order.clear( );
+		for ( Uint32 ix = 0; ix < children.size( ); ++ix )
+		{
+			if ( children[ ix ].Score != kDeadScore )
+			{
+				order.push_back( ix );
+			}
+		}
+		std::sort( order.begin( ), order.end( ), ByHashThenScore( children ) );
+		size_t unique = 0;
+		for ( size_t ix = 0; ix < order.size( ); ++ix )
+		{
+			if ( unique == 0 || children[ order[ ix ] ].Hash != children[ order[ unique - 1 ] ].Hash )
+			{
+				order[ unique++ ] = order[ ix ];
+			}
+		}
+		result.StatesMerged += order.size( ) - unique;
+		order.resize( unique );
+
+		// Keep the best, in child order (siblings are then next to each other and share most of their pages).
+		if ( order.size( ) > options.BeamWidth )
+		{
+			std::partial_sort( order.begin( ), order.begin( ) + options.BeamWidth, order.end( ), ByScore( children ) );
+			order.resize( options.BeamWidth );
+		}
+		std::sort( order.begin( ), order.end( ) );
+
+		// Copy the survivors' pages into the next step's pool, so the children's can go.
+		const Uint32 nextPool = beamPool ^ 1;
+		beam.resize( order.size( ) );
+		trails.push_back( std::vector< SearchTrail >( order.size( ) ) );
+		for ( size_t ix = 0; ix < order.size( ); ++ix )
+		{
+			const SearchNode & child = children[ order[ ix ] ];
+
+			RestoreSnapshot( child.State, *scratch );
+			SaveSnapshot( *scratch, ix ? &beam[ ix - 1 ].State : NULL, beamPools[ nextPool ], beam[ ix ].State );
+			beam[ ix ].Score = child.Score;
+			beam[ ix ].Hash = child.Hash;
+
+			trails.back( )[ ix ].Parent = child.Parent;
+			trails.back( )[ ix ].Action = child.Action;
+		}
+
+		beamPools[ beamPool ].Clear( );
+		beamPool = nextPool;
+		for ( size_t ix = 0; ix < threads.size( ); ++ix )
+		{
+			threads[ ix ]->Pool.Clear( );
+		}
+	}
+
+	SDL_LockMutex( shared.Lock );
+	shared.Quit = true;
+	SDL_CondBroadcast( shared.Wake );
+	SDL_UnlockMutex( shared.Lock );
+
+	for ( size_t ix = 0; ix < threads.size( ); ++ix )
+	{
+		SDL_WaitThread( threads[ ix ]->Thread, NULL );
+		result.FramesEmulated += threads[ ix ]->Frames;
+		delete threads[ ix ]->Machine;
+		delete threads[ ix ];
+	}
+
+	delete scratch;
+	SDL_DestroyCond( shared.Finished );
+	SDL_DestroyCond( shared.Wake );
+	SDL_DestroyMutex( shared.Lock );
+
+	return result.Found;
+}
+
+// ------------------------------------------------------------
+// Driving the machine.
+// ------------------------------------------------------------
+
+void RunFramesWithInputs( Cpu8080 & chip8, Uint8 inputs, Uint32 frames, MovieRecorder * recorder )
+{
+	chip8.Io.Inputs[ 1 ] = inputs;
+	for ( Uint32 ix = 0; ix < frames; ++ix )
+	{
+		if ( recorder )
+		{
+			recorder->RecordInputs( chip8 );
+		}
+
+		RunFrame( chip8 );
+
+		if ( recorder )
+		{
+			recorder->EndFrame( chip8 );
+		}
+	}
+}
+
+void StartOnePlayerGame( Cpu8080 & chip8, MovieRecorder * recorder )
+{
+	// Each held for a few frames, as the ROM debounces them.
+	RunFramesWithInputs( chip8, 0, 10, recorder );
+	RunFramesWithInputs( chip8, kInputCoin, 4, recorder );
+	RunFramesWithInputs( chip8, 0, 16, recorder );
+	RunFramesWithInputs( chip8, kInputOnePlayerStart, 4, recorder );
+
+	InvadersRamState ram;
+	do
+	{
+		RunFramesWithInputs( chip8, 0, 1, recorder );
+		ProbeInvadersRam( chip8, ram );
+	}
+	while ( ! ram.Playing );
+}
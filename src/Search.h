@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+
+#include "Cpu8080.h"
+#include "Movie.h"
+
+// ------------------------------------------------------------
+// Input search.
+//
+// Beam search over player 1's controls from a given machine. A step holds
+// one InvadersAction (see Env.h) for FramesPerStep frames. Each step expands
+// every node of the beam with every action on a pool of SDL threads, drops
+// states another node already reached (same HashMachineState) and keeps the
+// best BeamWidth by score. Nodes are page-shared snapshots (see Snapshot.h),
+// so a wide beam costs a few megabytes, and only the actions taken are kept
+// for the steps behind it.
+// ------------------------------------------------------------
+
+struct SearchGoal
+{
+	enum Type
+	{
+		ClearWave = 0,	// Destroy every alien without losing a life, as soon as possible.
+		RamValue,		// Reach a state where the byte at Address holds Value (e.g. to reproduce a bug).
+	};
+
+	SearchGoal( ) : Goal( ClearWave ), Address( 0 ), Value( 0 ) { }
+
+	Type	Goal;
+	address	Address;
+	Uint8	Value;
+};
+
+struct SearchOptions
+{
+	SearchOptions( ) : BeamWidth( 256 ), FramesPerStep( 4 ), MaxSteps( 3000 ), Threads( 4 ) { }
+
+	SearchGoal	Goal;
+	Uint32		BeamWidth;
+	Uint32		FramesPerStep;
+	Uint32		MaxSteps;
+	Uint32		Threads;
+};
+
+struct SearchResult
+{
+	bool					Found;
+	std::vector< Uint8 >	Actions;			// One InvadersAction per step, from the start.
+	Uint64					FramesEmulated;		// Over every thread.
+	Uint64					StatesMerged;		// Children dropped as duplicates of another.
+};
+
+// Searches from chip8 (which is left as it was). Returns false if nothing reached the goal within MaxSteps.
+bool RunSearch( const Cpu8080 & chip8, const SearchOptions & options, SearchResult & result );
+
+// Holds IN 1 at inputs for a number of frames, recording them (and the frame hashes) if there is a recorder.
+void RunFramesWithInputs( Cpu8080 & chip8, Uint8 inputs, Uint32 frames, MovieRecorder * recorder );
+
+// Boots, inserts a coin and starts a one player game, returning as soon as it is being played.
+void StartOnePlayerGame( Cpu8080 & chip8, MovieRecorder * recorder );
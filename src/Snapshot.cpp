@@ -0,0 +1,98 @@
+#include <string.h>
+
+#include "Snapshot.h"
+
+// Pages are allocated this many at a time.
+static const size_t kPagesPerBlock = 256;
+
+// Shared by every snapshot (RAM is mostly zeros), never owned by a pool.
+static const Uint8 kZeroPage[ kSnapshotPageSize ] = { 0 };
+
+// ------------------------------------------------------------
+// Pool.
+// ------------------------------------------------------------
+
+SnapshotPool::SnapshotPool( ) : m_PagesUsed( 0 )
+{
+}
+
+SnapshotPool::~SnapshotPool( )
+{
+	Clear( );
+}
+
+const Uint8 * SnapshotPool::AddPage( const Uint8 * bytes )
+{
+	if ( m_PagesUsed == m_Blocks.size( ) * kPagesPerBlock )
+	{
+		m_Blocks.push_back( new Uint8[ kPagesPerBlock * kSnapshotPageSize ] );
+	}
+
+	Uint8 * page = m_Blocks.back( ) + ( m_PagesUsed % kPagesPerBlock ) * kSnapshotPageSize;
+	memcpy( page, bytes, kSnapshotPageSize );
+	m_PagesUsed++;
+
+	return page;
+}
+
+void SnapshotPool::Clear( )
+{
+	for ( size_t ix = 0; ix < m_Blocks.size( ); ++ix )
+	{
+		delete [] m_Blocks[ ix ];
+	}
+	m_Blocks.clear( );
+	m_PagesUsed = 0;
+}
+
+// ------------------------------------------------------------
+// Snapshots.
+// ------------------------------------------------------------
+
+static size_t RamOffset( const Cpu8080 & chip8 )
+{
+	return ( const Uint8 * )chip8.Memory.Ram - ( const Uint8 * )&chip8;
+}
+
+void SaveSnapshot( const Cpu8080 & chip8, const MachineSnapshot * parent, SnapshotPool & pool, MachineSnapshot & snapshot )
+{
+	const Uint8 * machine = ( const Uint8 * )&chip8;
+	size_t ramOffset = RamOffset( chip8 );
+	size_t ramEnd = ramOffset + sizeof( chip8.Memory.Ram );
+
+	memcpy( snapshot.Machine, machine, ramOffset );
+	memcpy( snapshot.Machine + ramOffset, machine + ramEnd, sizeof( Cpu8080 ) - ramEnd );
+
+	for ( Uint32 ix = 0; ix < kSnapshotPages; ++ix )
+	{
+		const Uint8 * ram = &chip8.Memory.Ram[ ix * kSnapshotPageSize ];
+
+		if ( parent && memcmp( parent->Pages[ ix ], ram, kSnapshotPageSize ) == 0 )
+		{
+			snapshot.Pages[ ix ] = parent->Pages[ ix ];
+		}
+		else if ( memcmp( kZeroPage, ram, kSnapshotPageSize ) == 0 )
+		{
+			snapshot.Pages[ ix ] = kZeroPage;
+		}
+		else
+		{
+			snapshot.Pages[ ix ] = pool.AddPage( ram );
+		}
+	}
+}
+
+void RestoreSnapshot( const MachineSnapshot & snapshot, Cpu8080 & chip8 )
+{
+	Uint8 * machine = ( Uint8 * )&chip8;
+	size_t ramOffset = RamOffset( chip8 );
+	size_t ramEnd = ramOffset + sizeof( chip8.Memory.Ram );
+
+	memcpy( machine, snapshot.Machine, ramOffset );
+	memcpy( machine + ramEnd, snapshot.Machine + ramOffset, sizeof( Cpu8080 ) - ramEnd );
+
+	for ( Uint32 ix = 0; ix < kSnapshotPages; ++ix )
+	{
+		memcpy( &chip8.Memory.Ram[ ix * kSnapshotPageSize ], snapshot.Pages[ ix ], kSnapshotPageSize );
+	}
+}
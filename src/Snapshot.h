@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include "Cpu8080.h"
+
+// ------------------------------------------------------------
+// Sparse machine snapshots.
+//
+// A snapshot keeps the machine's registers and devices as they are and its
+// RAM as pages of kSnapshotPageSize bytes. Pages are never written once
+// stored (they live in a SnapshotPool), so a snapshot taken with a parent
+// just points at every page that has not changed since the parent, and
+// copying a snapshot only copies the page pointers. A search tree of
+// thousands of nodes costs a few hundred bytes per node rather than a
+// machine each.
+// ------------------------------------------------------------
+
+static const Uint32 kSnapshotPageSize = 256;
+static const Uint32 kSnapshotPages = sizeof( MachineMemory( ).Ram ) / kSnapshotPageSize;
+
+// Owns the pages of every snapshot saved with it. Not thread safe, give each thread its own.
+class SnapshotPool
+{
+public:
+
+	SnapshotPool( );
+	~SnapshotPool( );
+
+	// Stores a copy of a page.
+	const Uint8 * AddPage( const Uint8 * bytes );
+
+	// Frees every page (so every snapshot saved with this pool becomes invalid).
+	void Clear( );
+
+	size_t GetPagesUsed( ) const { return m_PagesUsed; }
+
+private:
+
+	std::vector< Uint8 * >	m_Blocks;
+	size_t					m_PagesUsed;
+};
+
+struct MachineSnapshot
+{
+	// Everything in the Cpu8080 before and after Memory.Ram.
+	Uint8			Machine[ sizeof( Cpu8080 ) - sizeof( MachineMemory( ).Ram ) ];
+	const Uint8 *	Pages[ kSnapshotPages ];
+};
+
+// Saves the machine, sharing the pages that match the parent's (if there is one).
+void SaveSnapshot( const Cpu8080 & chip8, const MachineSnapshot * parent, SnapshotPool & pool, MachineSnapshot & snapshot );
+
+void RestoreSnapshot( const MachineSnapshot & snapshot, Cpu8080 & chip8 );
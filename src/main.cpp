@@ -5,200 +5,35 @@
 #include <string.h>
 #include <SDL.h>
 #include <math.h>
+#include <algorithm>
+
+#include "Cpu8080.h"
+#include "Hle.h"
+#include "Movie.h"
+#include "Rewind.h"
+#include "Search.h"
+#include "Env.h"
+#include "Golden.h"
+#include "Lockstep.h"
+#include "Cpm.h"
+#include "Alu.h"
+#include "Cfg.h"
+#include "Aot.h"
+#include "Fuse.h"
 
-#if !defined(NDEBUG) || defined(_DEBUG) || defined(DEBUG)
-//#define _DUMP_INSTRUCTIONS
-#define _DUMP_DISASSEMBLY
-#endif
-
-#if defined(_DUMP_INSTRUCTIONS)
-#	define DumpInstruction( _Message, ... )	do { printf( _Message "\n", __VA_ARGS__ ); } while ( 0 )
-#else
-#	define DumpInstruction( _Message, ... )	do { } while ( 0 )
-#endif
-
-#if defined(_DUMP_DISASSEMBLY)
-#	define DumpDisassembly( _Message, ... )	do { printf( "%04x. %02x. "_Message "\n", chip8.Cpu.Regs.pc, chip8.Memory[ chip8.Cpu.Regs.pc ], __VA_ARGS__ ); } while ( 0 )
-#else
-#	define DumpDisassembly( _Message, ... ) do { } while ( 0 )
-#endif
-
-static inline const char * RegName( int ix )
-{
-	assert( ( ix >= 0 && ix < 6 ) || ix == 7 );
-	static const char * kRegNames[ ] = {
-		"B",
-		"C",
-		"D",
-		"E",
-		"H",
-		"L",
-		"M",
-		"A"
-	};
-	return kRegNames[ ix ];
-}
-
-static inline int RegIndex( int ix )
-{
-	assert( ( ix >= 0 && ix < 6 ) || ix == 7 );
-
-	if ( ix == 7 )
-		return ix;
-	else
-		return ix ^ 1;
-}
-
-typedef Uint16 address;
-typedef Uint8 instruction;
-
-static const bool ParityTable256[ 256 ] = 
-{
-#   define ParityTable256_2(n) n, n^1, n^1, n
-#   define ParityTable256_4(n) ParityTable256_2(n), ParityTable256_2(n^1), ParityTable256_2(n^1), ParityTable256_2(n)
-#   define ParityTable256_6(n) ParityTable256_4(n), ParityTable256_4(n^1), ParityTable256_4(n^1), ParityTable256_4(n)
-	ParityTable256_6(0), ParityTable256_6(1), ParityTable256_6(1), ParityTable256_6(0)
-#	undef ParityTable256_6
-#	undef ParityTable256_4
-#	undef ParityTable256_2
-};
-
-struct Cpu8080
-{
-	Cpu8080( )
-	: InterruptsEnabled( true )
-	, EnableInterruptsCountdown( 0 )
-	, DisableInterruptsCountdown( 0 )
-	, NextInterrupt( Interrupt::VBlankStart )
-	{
-		memset( DataBusRead, 0, sizeof( DataBusRead ) );
-		memset( DataBusWrite, 0, sizeof( DataBusWrite ) );
-		InterruptWaiting[ Interrupt::VBlankStart] = false;
-		InterruptWaiting[ Interrupt::VBlankEnd ] = false;
-	}
-
-	struct CommandProcessingUnit
-	{
-		struct Registers
-		{
-			Registers( )
-			{
-				for ( size_t ix = 0; ix < Gpr::Num; ++ix )
-				{
-					gpr[ ix ] = 0;
-				}
-				flags.u8 = 0;
-				sp = 0;
-				accumulator = 0;
-				pc          = 0x0;
-
-				// Double check...
-				assert( sizeof( Flags ) == 1 );
-				assert( sizeof( __int8 ) == 1 );
-				assert( sizeof( __int16 ) == 2 );
-				assert( sizeof( Sint8 ) == 1 );
-				assert( sizeof( Sint16 ) == 2 );
-				assert( sizeof( Uint8 ) == 1 );
-				assert( sizeof( Uint16 ) == 2 );
-			}
-			// B, C, D, E, H, L (accessible as pairs AB, DE, HL).
-			struct Gpr
-			{
-				enum T
-				{
-					B = 0,
-					C,
-					D,
-					E,
-					H,
-					L,
-					___MEMORY,		// Not a register, 0x6 as a register destination means a memory address
-					___ACCUMULATOR,	// Convenient, as 0x7 as a register destination actually means accumulator
-					Num
-				};
-			};
-
-			// BC, DE, HL pairs.
-			struct GprPair
-			{
-				enum T
-				{
-					BC,
-					DE,
-					HL,
-					Num
-				};
-			};
-
-			// CPU flags.
-			union Flags
-			{
-				struct  
-				{
-					unsigned __int8  s:1;
-					unsigned __int8  z:1;
-					unsigned __int8  pad:1;
-					unsigned __int8  ac:1;
-					unsigned __int8  pad2:1;
-					unsigned __int8  p:1;
-					unsigned __int8  pad3:1;
-					unsigned __int8  cy:1;
-				};
-				unsigned __int8  u8;
-			};
-
-			union
-			{
-				struct 
-				{
-					unsigned __int8  gpr[ 6 ];
-					Flags			 flags;
-					unsigned __int8  accumulator;
-				};
-
-				struct  
-				{
-					unsigned __int16 gprPair[ GprPair::Num ];
-					unsigned __int16 pad[ 1 ];
-				};
-			};
-
-			unsigned __int16 sp;
-			unsigned __int16 pc;
-		};
-
-		Registers			Regs;
-	};
-
-	CommandProcessingUnit Cpu;
-
-	Uint8	Memory[ 16 * 1024 ];
+static Cpu8080 chip8;
 
-	Uint8	DataBusRead[ 4 ];
-	Uint8	DataBusWrite[ 7 ];
-	bool	InterruptsEnabled;
-	Uint8	EnableInterruptsCountdown;
-	Uint8	DisableInterruptsCountdown;
-	struct Interrupt
-	{
-		enum T
-		{
-			VBlankStart = 0,
-			VBlankEnd,
-			Num
-		};
-	};
-	bool	InterruptWaiting[ Interrupt::Num ];
-	int		NextInterrupt;
-};
+// Seconds of history kept for rewinding (hold backspace).
+static const Uint32 kRewindSeconds = 10;
 
-static Cpu8080 chip8;
+// Copy of the machine run ahead of it to show the effect of input sooner (see -runahead).
+static Cpu8080 s_RunAhead;
 
 class Api
 {
 public:
 
-	Api( ) : m_pScreen( NULL ), m_pPixels( NULL ), m_SoundOn( false )
+	Api( ) : m_pScreen( NULL ), m_pPixels( NULL ), m_SoundOn( false ), m_Rewinding( false )
 	{
 		memset( m_Keys, 0, sizeof( bool ) * 16 );
 	}
@@ -273,7 +108,24 @@ public:
 		m_pPixels[ rotatedY * ( m_pScreen->pitch / 4 ) + rotatedX ] = clr;
 	}
 
-	void Tick( )
+	// Converts the packed 1bpp VRAM (0x2400-0x3fff) into the screen, every pixel is written.
+	void DrawVram( const Uint8 * vram )
+	{
+		for ( size_t y = 0; y < 224; ++y )
+		{
+			for ( size_t x = 0; x < 256; x += 8 )
+			{
+				Uint8 b = *vram++;
+
+				for ( size_t ix = 0; ix < 8; ++ix )
+				{
+					DrawAt( x + ix, y, ( ( b >> ix ) & 0x1 ) ? 0xffffffff : 0x00000000 );
+				}
+			}
+		}
+	}
+
+	void Present( )
 	{
 		if( SDL_MUSTLOCK( m_pScreen ) )
 		{
@@ -292,9 +144,12 @@ public:
 		}
 
 		m_pPixels = ( Uint32 * )m_pScreen->pixels;
+	}
 
+	void Tick( )
+	{
 		// Input.
-		chip8.DataBusRead[ 1 ] = 0;
+		chip8.Io.Inputs[ 1 ] = 0;
 
 		SDL_Event e;
 		while ( SDL_PollEvent( &e ) )
@@ -309,32 +164,37 @@ public:
 
 				if ( e.key.keysym.sym == SDLK_3 )
 				{
-					chip8.DataBusRead[ 1 ] |= 1 << 0;
+					chip8.Io.Inputs[ 1 ] |= kInputCoin;
 				}
 
 				if ( e.key.keysym.sym == SDLK_1 )
 				{
-					chip8.DataBusRead[ 1 ] |= 1 << 2;
+					chip8.Io.Inputs[ 1 ] |= kInputOnePlayerStart;
 				}
 
 				if ( e.key.keysym.sym == SDLK_2 )
 				{
-					chip8.DataBusRead[ 1 ] |= 1 << 1;
+					chip8.Io.Inputs[ 1 ] |= kInputTwoPlayerStart;
 				}
 
 				if ( e.key.keysym.sym == SDLK_LCTRL )
 				{
-					chip8.DataBusRead[ 1 ] |= 1 << 4;
+					chip8.Io.Inputs[ 1 ] |= kInputFire;
 				}
 
 				if ( e.key.keysym.sym == SDLK_LEFT )
 				{
-					chip8.DataBusRead[ 1 ] |= 1 << 5;
+					chip8.Io.Inputs[ 1 ] |= kInputLeft;
 				}
 
 				if ( e.key.keysym.sym == SDLK_RIGHT )
 				{
-					chip8.DataBusRead[ 1 ] |= 1 << 6;
+					chip8.Io.Inputs[ 1 ] |= kInputRight;
+				}
+
+				if ( e.key.keysym.sym == SDLK_BACKSPACE )
+				{
+					m_Rewinding = true;
 				}
 			}
 			else if ( e.type == SDL_KEYUP )
@@ -344,6 +204,11 @@ public:
 				{
 					m_Keys[ index ] = false;
 				}
+
+				if ( e.key.keysym.sym == SDLK_BACKSPACE )
+				{
+					m_Rewinding = false;
+				}
 			}
 		}
 	}
@@ -377,6 +242,11 @@ public:
 		return false;
 	}
 
+	bool IsRewinding( ) const
+	{
+		return m_Rewinding;
+	}
+
 	void SetSound( bool on )
 	{
 		m_SoundOn = on;
@@ -506,6 +376,7 @@ private:
 	Uint32 * m_pPixels;
 	bool m_Keys[ 16 ];
 	bool m_SoundOn;
+	bool m_Rewinding;
 };
 
 bool ReadFileIntoMemory( const char * file, Uint8 * memory, size_t expectedSize )
@@ -529,2517 +400,622 @@ bool ReadFileIntoMemory( const char * file, Uint8 * memory, size_t expectedSize
 		return false;
 	}
 }
-
-Uint16 CheckAddress( Uint16 addr, bool write = false )
-{
-	if ( write )
-		assert( addr >= 0x2000 );
-	
-	assert( addr < 64 * 1024 );
-
-	while ( addr >= 0x4000 )
-		addr -= 0x2000;
-
-	if ( write )
-		assert( addr >= 0x2000 );
-
-	assert( addr < 64 * 1024 );
-
-	return addr;
-}
-
-Uint16 CheckProgramCounter( Uint16 addr )
-{
-	assert( addr >= 0 && addr < 0x2000 );
-
-	return addr;
-}
-
-#define IncrementPc( )						chip8.Cpu.Regs.pc += 1
-#define DoubleIncrementPc( )				chip8.Cpu.Regs.pc += 2
-
-#define GetHlMemory8( )						chip8.Memory[ CheckAddress( chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::HL ] ) ]
-#define SetHlMemory8( _Val )				GetHlMemory8( ) = _Val
-
-#define GetRegisterBc( )					chip8.Cpu.Regs.gprPair[ CheckAddress( Cpu8080::CommandProcessingUnit::Registers::GprPair::BC ) ]
-#define SetRegisterBc( _Val )				GetRegisterBc( ) = _Val
-#define GetBcMemory8( )						chip8.Memory[ CheckAddress( GetRegisterBc( ) ) ]
-#define GetBcMemory16( )					( Uint16 &)GetBcMemory8( )
-#define SetBcMemory8( _Val )				GetBcMemory8( ) = _Val
-#define SetBcMemory16( _Val )				GetBcMemory16( ) = _Val
-
-#define GetRegisterDe( )					chip8.Cpu.Regs.gprPair[ CheckAddress( Cpu8080::CommandProcessingUnit::Registers::GprPair::DE ) ]
-#define SetRegisterDe( _Val )				GetRegisterDe( ) = _Val
-#define GetDeMemory8( )						chip8.Memory[ CheckAddress( GetRegisterDe( ) ) ]
-#define GetDeMemory16( )					( Uint16 &)GetDeMemory8( )
-#define SetDeMemory8( _Val )				GetDeMemory8( ) = _Val
-#define SetDeMemory16( _Val )				GetDeMemory16( ) = _Val
-
-#define GetRegisterHl( )					chip8.Cpu.Regs.gprPair[ CheckAddress( Cpu8080::CommandProcessingUnit::Registers::GprPair::HL ) ]
-#define SetRegisterHl( _Val )				GetRegisterHl( ) = _Val
-
-#define GetAccumulator( )					chip8.Cpu.Regs.accumulator
-#define SetAccumulator( _Val )				GetAccumulator( ) = _Val
-
-#define GetMemory8AtAddress( _Addr )		chip8.Memory[ CheckAddress( _Addr ) ]
-#define SetMemory8AtAddress( _Addr, _Val )	GetMemory8AtAddress( _Addr ) = _Val
-
-#define GetMemory16AtAddress( _Addr )		( ( Uint16 &)chip8.Memory[ CheckAddress( _Addr ) ] )
-#define SetMemory16AtAddress( _Addr, _Val )	GetMemory16AtAddress( _Addr ) = _Val
-
-#define GetRegisterSp( )					chip8.Cpu.Regs.sp
-#define SetRegisterSp( _Val )				GetRegisterSp( ) = _Val
-#define DecrementSp( )						GetRegisterSp( ) -= 1
-#define DoubleDecrementSp( )				GetRegisterSp( ) -= 2
-#define IncrementSp( )						GetRegisterSp( ) += 1
-#define DoubleIncrementSp( )				GetRegisterSp( ) += 2
-#define PushAndDecrementStack8( _Val )		SetMemory8AtAddress( GetRegisterSp( ) - 1, _Val ); DecrementSp( )
-#define PushAndDecrementStack16( _Val )		SetMemory16AtAddress( GetRegisterSp( ) - 2, _Val ); DoubleDecrementSp( )
-
-#define PopStack8( )						GetMemory8AtAddress( GetRegisterSp( ) )
-#define PopStack16( )						GetMemory16AtAddress( GetRegisterSp( ) )
-
-#define GetFlags( )							chip8.Cpu.Regs.flags
-#define SetFlags( _Val )					GetFlags( ).u8 = _Val
-
-#define SetRegisterPc( _Val )				chip8.Cpu.Regs.pc = CheckProgramCounter( _Val )
-
-// For the given base value, generation case statements for each source register variation (assuming source is in bits 0-2)
-#define _GenSrcVariations( _Base )	\
-			_Base:					\
-			case _Base + 1:			\
-			case _Base + 2:			\
-			case _Base + 3:			\
-			case _Base + 4:			\
-			case _Base + 5:			\
-			case _Base + 7
-
-// For the given base value, generation case statements for each destination register variation (assuming destination is in bits 3-5)
-#define _GenDstVariations( _Base )	\
-			_Base:					\
-			case _Base + 8:			\
-			case _Base + 16:		\
-			case _Base + 24:		\
-			case _Base + 32:		\
-			case _Base + 40:		\
-			case _Base + 56
-
-// For the given base value, generation case statements for each source/destination register variation (assuming source is in bits 0-2 and destination is in bits 3-5)
-#define _GenDstSrcVariations( _Base )				\
-			_GenSrcVariations( _Base ):				\
-			case _GenSrcVariations( _Base + 8 ):	\
-			case _GenSrcVariations( _Base + 16 ):	\
-			case _GenSrcVariations( _Base + 24 ):	\
-			case _GenSrcVariations( _Base + 32 ):	\
-			case _GenSrcVariations( _Base + 40 ):	\
-			case _GenSrcVariations( _Base + 56 )
-
-
-bool g_InRst = false;
-int g_StartCount = 0;
-int g_EndCount = 0;
-
 int main( int numArgs, char ** args )
 {
 	_CrtSetReportMode( _CRT_ASSERT, _CRTDBG_MODE_DEBUG );
 
-	Api api;
-	api.Initialise( );
-
+	Uint8 rom[ 0x2000 ];
 	bool okay = true;
-	okay &= ReadFileIntoMemory( "invaders.h", &chip8.Memory[ 0x0000 ], 2048 );
-	okay &= ReadFileIntoMemory( "invaders.g", &chip8.Memory[ 0x0800 ], 2048 );
-	okay &= ReadFileIntoMemory( "invaders.f", &chip8.Memory[ 0x1000 ], 2048 );
-	okay &= ReadFileIntoMemory( "invaders.e", &chip8.Memory[ 0x1800 ], 2048 );
+	okay &= ReadFileIntoMemory( "invaders.h", &rom[ 0x0000 ], 2048 );
+	okay &= ReadFileIntoMemory( "invaders.g", &rom[ 0x0800 ], 2048 );
+	okay &= ReadFileIntoMemory( "invaders.f", &rom[ 0x1000 ], 2048 );
+	okay &= ReadFileIntoMemory( "invaders.e", &rom[ 0x1800 ], 2048 );
 	assert( okay );
+	chip8.Memory.Rom = InternRom( rom );
+
+	// Options.
+	bool useHle = true;
+	const char * recordFile = NULL;
+	const char * playFile = NULL;
+	const char * verifyFile = NULL;
+	Uint32 threads = 4;
+	Uint32 seekFrame = ~0u;
+	Uint32 keyframeInterval = kMovieKeyframeInterval;
+	Uint32 runAheadFrames = 0;
+	Uint32 displayFrameSkip = 0;
+	const char * searchFile = NULL;
+	SearchOptions search;
+	const char * goldenFile = NULL;
+	bool makeGolden = false;
+	const char * lockstepEngine = NULL;
+	Uint32 lockstepFrames = 0;
+	const char * fuzzEngine = NULL;
+	Uint32 fuzzCases = 0;
+	Uint32 fuzzSeed = 1;
+	const char * cpmFile = NULL;
+#if defined(INVADERS_AOT)
+	const char * engineName = "aot";
+#else
+	const char * engineName = NULL;
+#endif
+	bool verifyAlu = false;
+	const char * aluTablesFile = NULL;
+	Uint32 benchFrames = 0;
+	const char * cfgFile = NULL;
+	Uint32 cfgFrames = 0;
+	const char * aotFile = NULL;
+	Uint32 fuseProfileFrames = 0;
+	for ( int ix = 1; ix < numArgs; ++ix )
+	{
+		if ( strcmp( args[ ix ], "-nohle" ) == 0 )
+		{
+			useHle = false;
+		}
+		else if ( strcmp( args[ ix ], "-verifyhle" ) == 0 )
+		{
+			g_HleVerify = true;
+		}
+		else if ( strcmp( args[ ix ], "-noidleskip" ) == 0 )
+		{
+			g_SkipIdleLoops = false;
+		}
+		else if ( strcmp( args[ ix ], "-record" ) == 0 && ix + 1 < numArgs )
+		{
+			recordFile = args[ ++ix ];
+		}
+		else if ( strcmp( args[ ix ], "-play" ) == 0 && ix + 1 < numArgs )
+		{
+			playFile = args[ ++ix ];
+		}
+		else if ( strcmp( args[ ix ], "-verify" ) == 0 && ix + 1 < numArgs )
+		{
+			verifyFile = args[ ++ix ];
+		}
+		else if ( strcmp( args[ ix ], "-runahead" ) == 0 && ix + 1 < numArgs )
+		{
+			runAheadFrames = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-frameskip" ) == 0 && ix + 1 < numArgs )
+		{
+			displayFrameSkip = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-search" ) == 0 && ix + 1 < numArgs )
+		{
+			searchFile = args[ ++ix ];
+		}
+		else if ( strcmp( args[ ix ], "-searchram" ) == 0 && ix + 2 < numArgs )
+		{
+			search.Goal.Goal = SearchGoal::RamValue;
+			search.Goal.Address = ( address )strtol( args[ ++ix ], NULL, 16 );
+			search.Goal.Value = ( Uint8 )strtol( args[ ++ix ], NULL, 16 );
+		}
+		else if ( strcmp( args[ ix ], "-beam" ) == 0 && ix + 1 < numArgs )
+		{
+			search.BeamWidth = std::max( atoi( args[ ++ix ] ), 1 );
+		}
+		else if ( strcmp( args[ ix ], "-threads" ) == 0 && ix + 1 < numArgs )
+		{
+			threads = std::max( atoi( args[ ++ix ] ), 1 );
+		}
+		else if ( strcmp( args[ ix ], "-seek" ) == 0 && ix + 1 < numArgs )
+		{
+			seekFrame = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-keyframes" ) == 0 && ix + 1 < numArgs )
+		{
+			keyframeInterval = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-golden" ) == 0 && ix + 1 < numArgs )
+		{
+			goldenFile = args[ ++ix ];
+		}
+		else if ( strcmp( args[ ix ], "-makegolden" ) == 0 && ix + 1 < numArgs )
+		{
+			goldenFile = args[ ++ix ];
+			makeGolden = true;
+		}
+		else if ( strcmp( args[ ix ], "-lockstep" ) == 0 && ix + 2 < numArgs )
+		{
+			lockstepEngine = args[ ++ix ];
+			lockstepFrames = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-fuzz" ) == 0 && ix + 2 < numArgs )
+		{
+			fuzzEngine = args[ ++ix ];
+			fuzzCases = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-seed" ) == 0 && ix + 1 < numArgs )
+		{
+			fuzzSeed = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-cpm" ) == 0 && ix + 1 < numArgs )
+		{
+			cpmFile = args[ ++ix ];
+		}
+		else if ( strcmp( args[ ix ], "-engine" ) == 0 && ix + 1 < numArgs )
+		{
+			engineName = args[ ++ix ];
+		}
+		else if ( strcmp( args[ ix ], "-verifyalu" ) == 0 )
+		{
+			verifyAlu = true;
+		}
+		else if ( strcmp( args[ ix ], "-alutables" ) == 0 && ix + 1 < numArgs )
+		{
+			aluTablesFile = args[ ++ix ];
+		}
+		else if ( strcmp( args[ ix ], "-bench" ) == 0 && ix + 1 < numArgs )
+		{
+			benchFrames = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-cfg" ) == 0 && ix + 2 < numArgs )
+		{
+			cfgFile = args[ ++ix ];
+			cfgFrames = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-aot" ) == 0 && ix + 2 < numArgs )
+		{
+			aotFile = args[ ++ix ];
+			cfgFrames = atoi( args[ ++ix ] );
+		}
+		else if ( strcmp( args[ ix ], "-fuseprofile" ) == 0 && ix + 1 < numArgs )
+		{
+			fuseProfileFrames = atoi( args[ ++ix ] );
+		}
+	}
 
-	// Previous instruction (for debugging).
-	address lastInstruction = 0x0000;
+	// Write the ALU lookup tables built from the reference model.
+	if ( aluTablesFile )
+	{
+		AluTables * tables = new AluTables;
+		BuildAluTables( *tables );
+		bool saved = SaveAluTables( aluTablesFile, *tables );
+		delete tables;
 
-	// Last time we did our 60Hz update.
-	Uint32 last60HzTime = SDL_GetTicks( );
+		printf( saved ? "Saved ALU tables to %s\n" : "Unable to save ALU tables to %s\n", aluTablesFile );
+		return saved ? 0 : 1;
+	}
+
+	// The engine asked for runs the game (and everything else stepping it a frame at a time), -verifyalu and -cpm.
+	// Without one the game steps StepCpuBlock and the other two the interpreter.
+	const CpuEngine * engine = FindCpuEngine( engineName ? engineName : "interpreter" );
+	if ( ! engine )
+	{
+		printf( "Unknown CPU engine %s\n", engineName );
+		return 1;
+	}
+	if ( engineName )
+	{
+		g_StepCpuEngine = engine->Step;
+	}
 
-	// Instructions processed since last 60hz interval.
-	Uint32 instructionsProcessedSinceLast60Update = 0;
+	// Only the engines that will run are set up (the ALU tables alone are 2MB), this one before any threads.
+	InitCpuEngine( *engine, chip8.Memory.Rom );
 
-	// Loop forever.
-	for ( ; ; )
+	// Check every ALU opcode of an engine against the reference model.
+	if ( verifyAlu )
 	{
-		// Get time (in milliseconds).
-		Uint32 timeNow = SDL_GetTicks( );
+		Uint32 startTime = SDL_GetTicks( );
+		AluReport report;
+		bool matched = VerifyAlu( *engine, threads, report );
+		Uint32 elapsed = SDL_GetTicks( ) - startTime;
+
+		printf( "Verified %u ALU opcodes (%llu cases) on %s in %u ms, %llu mismatches in %u opcodes\n", report.Opcodes, ( unsigned long long )report.Cases, engine->Name,
+			elapsed, ( unsigned long long )report.Mismatches, report.OpcodesMismatched );
+		return matched ? 0 : 1;
+	}
 
-		if ( ( chip8.NextInterrupt == Cpu8080::Interrupt::VBlankEnd && instructionsProcessedSinceLast60Update >= 5705 ) || ( chip8.NextInterrupt == Cpu8080::Interrupt::VBlankStart && instructionsProcessedSinceLast60Update >= 968 ) )
+	// Run a CP/M program (e.g. an instruction exerciser) instead of the game.
+	if ( cpmFile )
+	{
+		Uint32 startTime = SDL_GetTicks( );
+		CpmResult result;
+		if ( ! RunCpmProgram( cpmFile, *engine, 0, result ) )
 		{
-			if ( chip8.NextInterrupt == Cpu8080::Interrupt::VBlankEnd )
-			{
-				while ( timeNow - last60HzTime <= 1000.f / 60.f )
-				{
-					SDL_Delay( 0 );
-					timeNow = SDL_GetTicks( );
-				}
-			}
+			printf( "Unable to load CP/M program %s\n", cpmFile );
+			return 1;
+		}
+		Uint32 elapsed = std::max( SDL_GetTicks( ) - startTime, 1u );
 
-			// Need to do a VBLANK end interrupt when we can.
-			chip8.InterruptWaiting[ chip8.NextInterrupt ] = true;
-			chip8.NextInterrupt ^= 1;
+		printf( "\n%s %s after %llu instructions in %u ms (%llu instructions/s) on %s\n", cpmFile, ! result.Finished ? "stopped" : result.Failed ? "reported errors" : "passed",
+			( unsigned long long )result.Instructions, elapsed, ( unsigned long long )( result.Instructions * 1000 / elapsed ), engine->Name );
+		return result.Finished && ! result.Failed ? 0 : 1;
+	}
 
-			instructionsProcessedSinceLast60Update = 0;
+	// Play back (or verify) a movie headless, as fast as we can (or seek into it, see -seek).
+	if ( playFile || verifyFile )
+	{
+		const char * movieFile = playFile ? playFile : verifyFile;
+		MoviePlayer player;
+		if ( ! player.Load( movieFile ) )
+		{
+			printf( "Unable to load movie %s\n", movieFile );
+			return 1;
 		}
 
-		// If it has been 60Hz since our last update...
-		if ( timeNow - last60HzTime > 1000.f / 60.f )
+		// Run the way it was recorded.
+		const MovieHeader & header = player.GetHeader( );
+		if ( header.RomHash != HashBytes( kHashSeed, chip8.Memory.Rom, 0x2000 ) )
 		{
-			// Update to know when next 60Hz timer should be issued.
-			last60HzTime = timeNow;
+			printf( "Warning: movie was recorded with different ROMs\n" );
+		}
+		g_SkipIdleLoops = ( header.Flags & kMovieFlagIdleSkip ) != 0;
+		useHle = ( header.Flags & kMovieFlagHle ) != 0;
+		if ( useHle )
+		{
+			InstallHleRoutines( chip8.Memory.Rom );
+		}
+		InitCpuCaches( chip8.Memory.Rom );
 
-			// Write image to screen.
-			api.ClearScreen( );
+		Uint32 startTime = SDL_GetTicks( );
 
-			uint32_t vramPos = 0x2400;
-			for ( size_t y = 0; y < 224; ++y )
+		// Jump to a frame of the movie and carry on from there interactively.
+		if ( playFile && seekFrame != ~0u )
+		{
+			if ( recordFile )
 			{
-				for ( size_t x = 0; x < 256; x += 8 )
-				{
-					Uint8 b = chip8.Memory[ vramPos++ ];
-
-					for ( size_t ix = 0; ix < 8; ++ix )
-					{
-						api.DrawAt( x + ix, y, ( ( b >> ix ) & 0x1 ) ? 0xffffffff : 0x00000000 );
-					}
-				}
+				printf( "A movie can't be recorded from part way through another\n" );
+				return 1;
 			}
 
-			// Update API (render to screen, process keys, etc.)
-			api.Tick( );
+			Cpu8080 * start = new Cpu8080( chip8 );
+			bool seeked = player.Seek( *start, seekFrame, chip8 );
+			delete start;
+
+			if ( ! seeked )
+			{
+				printf( "Unable to seek to frame %u of %u (got to %u)\n", seekFrame, player.GetFrames( ), chip8.Frame );
+				return 1;
+			}
+			printf( "Seeked to frame %u (%u ms, %u keyframes)\n", chip8.Frame, SDL_GetTicks( ) - startTime, ( Uint32 )player.GetNumKeyframes( ) );
 		}
+		else
+		{
+			Uint32 desyncFrame = 0;
+			bool inSync = false;
+			if ( playFile )
+			{
+				inSync = PlayMovie( chip8, player );
+				desyncFrame = chip8.Frame;
+			}
+			else
+			{
+				inSync = player.Verify( chip8, threads, desyncFrame );
+			}
+			Uint32 elapsed = SDL_GetTicks( ) - startTime;
 
-		Uint8  instruction = chip8.Memory[ CheckProgramCounter( chip8.Cpu.Regs.pc ) ];
+			if ( ! inSync )
+			{
+				printf( "Movie desynced at frame %u of %u\n", desyncFrame, player.GetFrames( ) );
+				return 1;
+			}
+
+			printf( "Movie played %u frames in sync (%u ms, %u keyframes)\n", player.GetFrames( ), elapsed, ( Uint32 )player.GetNumKeyframes( ) );
+			return 0;
+		}
+	}
 
-		Uint8  s = instruction & 7;
-		Uint8  d = ( instruction >> 3 ) & 7;
-		Uint8  immediate = chip8.Memory[ chip8.Cpu.Regs.pc + 1 ];
-		Uint16 immediate16 = ( chip8.Memory[ chip8.Cpu.Regs.pc + 2 ] << 8 ) | chip8.Memory[ chip8.Cpu.Regs.pc + 1 ];
+	if ( useHle )
+	{
+		InstallHleRoutines( chip8.Memory.Rom );
+	}
+	InitCpuCaches( chip8.Memory.Rom );
 
-		// Interrupts.
-		if ( chip8.InterruptsEnabled )
+	// Find the ROM's code, resolving indirect jumps by running the game for a while, and write it out as a listing.
+	if ( cfgFile )
+	{
+		Uint32 startTime = SDL_GetTicks( );
+		RomCfg * cfg = new RomCfg;
+		std::vector< address > targets;
+		Uint32 resolved = BuildResolvedRomCfg( chip8, cfgFrames, *cfg, targets );
+		Uint32 elapsed = SDL_GetTicks( ) - startTime;
+
+		printf( "Found %u blocks (%u instructions, %u bytes of code) in %u routines in %u ms, %u of %u indirect jumps taken to %u targets\n", ( Uint32 )cfg->Blocks.size( ),
+			cfg->Instructions, cfg->CodeBytes, cfg->Routines, elapsed, resolved, ( Uint32 )cfg->IndirectJumps.size( ), ( Uint32 )targets.size( ) );
+
+		bool written = WriteCfgListing( cfgFile, chip8.Memory.Rom, *cfg );
+		delete cfg;
+		if ( ! written )
 		{
-			if ( chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] )
-			{
-				chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankStart ] = false;
+			printf( "Unable to write listing %s\n", cfgFile );
+			return 1;
+		}
+		return 0;
+	}
 
-				// RST 1.
-				instruction = 0xc7;
-				d = 1;
+	// Translate the ROM's blocks to C++ for the Release AOT configuration (InvadersAot.cpp).
+	if ( aotFile )
+	{
+		RomCfg * cfg = new RomCfg;
+		std::vector< address > targets;
+		BuildResolvedRomCfg( chip8, cfgFrames, *cfg, targets );
+
+		Uint32 blocks = 0;
+		Uint32 instructions = 0;
+		bool written = WriteAotSource( aotFile, chip8.Memory.Rom, *cfg, blocks, instructions );
+		if ( written )
+		{
+			printf( "Translated %u of %u blocks (%u of %u instructions) to %s\n", blocks, ( Uint32 )cfg->Blocks.size( ), instructions, cfg->Instructions, aotFile );
+		}
+		else
+		{
+			printf( "Unable to write %s\n", aotFile );
+		}
+		delete cfg;
+		return written ? 0 : 1;
+	}
 
-				g_InRst = true;
-				g_StartCount++;
+	// List the instruction sequences executed most often, for picking which to fuse.
+	if ( fuseProfileFrames )
+	{
+		RomCfg * cfg = new RomCfg;
+		std::vector< address > targets;
+		BuildResolvedRomCfg( chip8, fuseProfileFrames, *cfg, targets );
 
-				chip8.InterruptsEnabled = false;
+		std::vector< OpcodeSequence > sequences;
+		ProfileOpcodeSequences( chip8, *cfg, fuseProfileFrames, sequences );
+		delete cfg;
 
-				// Haven't processed this instruction yet.
-				chip8.Cpu.Regs.pc--;
-			}
-			else if ( chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] )
-			{
-				chip8.InterruptWaiting[ Cpu8080::Interrupt::VBlankEnd ] = false;
+		for ( size_t ix = 0; ix < sequences.size( ) && ix < 40; ++ix )
+		{
+			char text[ 128 ];
+			FormatOpcodeSequence( sequences[ ix ], text, sizeof( text ) );
+			printf( "%12llu %4u sites %s %s\n", ( unsigned long long )sequences[ ix ].Executions, sequences[ ix ].Sites, sequences[ ix ].Fused ? "fused" : "     ", text );
+		}
+		return 0;
+	}
 
-				// RST 2.
-				instruction = 0xc7;
-				d = 2;
+	// Time every CPU engine running the game from reset.
+	if ( benchFrames )
+	{
+		for ( size_t ix = 0; ix < GetNumCpuEngines( ); ++ix )
+		{
+			const CpuEngine & timed = GetCpuEngine( ix );
+			InitCpuEngine( timed, chip8.Memory.Rom );
 
-				g_InRst = true;
-				g_EndCount++;
+			Uint32 startTime = SDL_GetTicks( );
+			Uint64 instructions = RunCpuEngine( chip8, timed, benchFrames );
+			Uint32 elapsed = std::max( SDL_GetTicks( ) - startTime, 1u );
 
-				chip8.InterruptsEnabled = false;
+			printf( "%-12s %u frames (%llu instructions) in %u ms, %llu instructions/s\n", timed.Name, benchFrames, ( unsigned long long )instructions, elapsed,
+				( unsigned long long )( instructions * 1000 / elapsed ) );
+		}
+		return 0;
+	}
 
-				// Haven't processed this instruction yet.
-				chip8.Cpu.Regs.pc--;
+	// Run a CPU engine against the reference interpreter from reset, or on random instruction streams.
+	if ( lockstepEngine || fuzzEngine )
+	{
+		const CpuEngine * reference = FindCpuEngine( "reference" );
+		const CpuEngine * candidate = FindCpuEngine( lockstepEngine ? lockstepEngine : fuzzEngine );
+		if ( ! candidate )
+		{
+			printf( "Unknown CPU engine %s, there is", lockstepEngine ? lockstepEngine : fuzzEngine );
+			for ( size_t ix = 0; ix < GetNumCpuEngines( ); ++ix )
+			{
+				printf( " %s", GetCpuEngine( ix ).Name );
 			}
+			printf( "\n" );
+			return 1;
 		}
+		InitCpuEngine( *candidate, chip8.Memory.Rom );
 
-		if ( chip8.Cpu.Regs.pc == 0x0682 )
+		Uint32 startTime = SDL_GetTicks( );
+		LockstepResult result;
+		if ( lockstepEngine )
 		{
-			static int a = 5;
-			++a;
+			RunLockstep( chip8, *reference, *candidate, lockstepFrames, result );
 		}
-
-		switch ( instruction )
+		else
 		{
-			// ------------------------------------------------------------
-			// Move, Load & Store.
-			// ------------------------------------------------------------
+			// HLE routines are keyed by address and would stand in for random code.
+			RemoveHleRoutines( );
+			RunLockstepFuzz( *reference, *candidate, fuzzSeed, fuzzCases, kLockstepFuzzInstructions, result );
+		}
+		Uint32 elapsed = SDL_GetTicks( ) - startTime;
 
-			// Source + Destination variations.
-			case _GenDstSrcVariations( 0x40 ):
-			{
-				// Move register.
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "MOV %s, %s", RegName( d ), RegName( s ) );
-				DumpInstruction( "r%d = r%d", d, s );
-				chip8.Cpu.Regs.gpr[ RegIndex( d ) ] = chip8.Cpu.Regs.gpr[ RegIndex( s ) ];
-			}
-			break;
+		printf( "%s %s %llu steps (%llu instructions) in %u ms\n", candidate->Name, result.Diverged ? "diverged after" : "matched the reference for",
+			( unsigned long long )result.Steps, ( unsigned long long )result.Instructions, elapsed );
+		return result.Diverged ? 1 : 0;
+	}
 
-			// Just source variations.
-			case _GenSrcVariations( 0x70 ):
+	// Run the golden frame scenarios headless, checking them against (or saving) a file of their hashes.
+	if ( goldenFile )
+	{
+		GoldenHashes golden;
+		Uint32 goldenFlags = ( useHle ? kMovieFlagHle : 0 ) | ( g_SkipIdleLoops ? kMovieFlagIdleSkip : 0 );
+		if ( ! makeGolden )
+		{
+			if ( ! LoadGoldenHashes( goldenFile, golden, goldenFlags ) )
 			{
-				// Move register to memory.
-				// Cycles : 2
-				// States : 7
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "MOV M, %s", RegName( s ) );
-				DumpInstruction( "(HL) = r%d", s );
-				SetHlMemory8( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
+				printf( "Unable to load golden hashes %s\n", goldenFile );
+				return 1;
 			}
-			break;
 
-			// Just destination variations.
-			case _GenDstVariations( 0x46 ):
+			// Check the way they were made.
+			g_SkipIdleLoops = ( goldenFlags & kMovieFlagIdleSkip ) != 0;
+			RemoveHleRoutines( );
+			if ( goldenFlags & kMovieFlagHle )
 			{
-				// Move memory to register.
-				// Cycles : 2
-				// States : 7
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "MOV %s, M", RegName( d ) );
-				DumpInstruction( "r%d = (HL)", d );
-				chip8.Cpu.Regs.gpr[ RegIndex( d ) ] = GetHlMemory8( );
+				InstallHleRoutines( chip8.Memory.Rom );
 			}
-			break;
-
-			// Just destination variations.
-			case _GenDstVariations( 0x6 ):
-			{
-				// Move intermediate to register.
-				// Cycles : 2
-				// States : 7
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "MVI %s, 0x%x", RegName( d ), immediate );
-				DumpInstruction( "r%d = 0x%x", d, immediate );
-				chip8.Cpu.Regs.gpr[ RegIndex( d ) ] = immediate;
-
-				if ( chip8.Cpu.Regs.pc == 0x08F1 )
-				{
-					static int a = 5;
-					++a;
-				}
+			InitCpuCaches( chip8.Memory.Rom );
+		}
 
-				// Skip over immediate we read into register.
-				IncrementPc( );
-			}
-			break;
+		Uint32 startTime = SDL_GetTicks( );
+		GoldenHashes results;
+		GoldenReport report;
+		bool passed = RunGoldenScenarios( chip8, makeGolden ? NULL : &golden, threads, results, report );
+		Uint32 elapsed = SDL_GetTicks( ) - startTime;
 
-			case 0x36:
+		printf( "Ran %u scenarios (%u checkpoints) in %u ms, %u unfinished\n", report.Scenarios, report.Checkpoints, elapsed, report.Unfinished );
+		if ( makeGolden )
+		{
+			if ( ! SaveGoldenHashes( goldenFile, results, goldenFlags ) )
 			{
-				// Move immediate memory.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "MVI M, 0x%x", immediate );
-				DumpInstruction( "(HL) = 0x%x", immediate );
-				SetHlMemory8( immediate );
-
-				// Next instruction is immediate we just used.
-				IncrementPc( );
+				printf( "Unable to save golden hashes %s\n", goldenFile );
+				return 1;
 			}
-			break;
+			printf( "Saved golden hashes to %s\n", goldenFile );
+			return 0;
+		}
 
-			case 0x1:
-			{
-				// Load immediate into register pair BC
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "LXI B, 0x%x", immediate16 );
-				DumpInstruction( "BC = 0x%x", immediate16 );
-				SetRegisterBc( immediate16 );
-
-				// Next two instruction are immediates we just used.
-				DoubleIncrementPc( );
-			}
-			break;
-
-			case 0x11:
-			{
-				// Load immediate into register pair DE
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "LXI D, 0x%x", immediate16 );
-				DumpInstruction( "DE = 0x%x", immediate16 );
-				SetRegisterDe( immediate16 );
-
-				// Next two instruction are immediates we just used.
-				DoubleIncrementPc( );
-			}
-			break;
-
-			case 0x21:
-			{
-				// Load immediate into register pair HL
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "LXI H, 0x%x", immediate16 );
-				DumpInstruction( "HL = 0x%x", immediate16 );
-				SetRegisterHl( immediate16 );
-
-				// Next two instruction are immediates we just used.
-				DoubleIncrementPc( );
-			}
-			break;
-
-			case 0x2:
-			{
-				// Store accumulator into (BC).
-				// Cycles : 2
-				// States : 7
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "STAX B" );
-				DumpInstruction( "(BC) = accumulator" );
-				SetBcMemory8( GetAccumulator( ) );
-			}
-			break;
-
-			case 0x12:
-			{
-				// Store accumulator into (DE).
-				// Cycles : 2
-				// States : 7
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "STAX D" );
-				DumpInstruction( "(DE) = accumulator" );
-				SetDeMemory8( GetAccumulator( ) );
-			}
-			break;
-
-			case 0xa:
-			{
-				// Load accumulator from (BC).
-				// Cycles : 2
-				// States : 7
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "LDAX B" );
-				DumpInstruction( "accumulator = (BC)" );
-				SetAccumulator( GetBcMemory8( ) );
-			}
-			break;
-
-			case 0x1a:
-			{
-				// Load accumulator from (DE).
-				// Cycles : 2
-				// States : 7
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "LDAX D" );
-				DumpInstruction( "accumulator = (DE)" );
-				SetAccumulator( GetDeMemory8( ) );
-			}
-			break;
-
-			case 0x32:
-			{
-				// Store accumulator to address.
-				// Cycles : 4
-				// States : 13
-				// Flags  : none
-				// Addressing : direct
-				DumpDisassembly( "STA 0x%x", immediate16 );
-				DumpInstruction( "(immediate16) = accumulator" );
-				SetMemory8AtAddress( immediate16, GetAccumulator( ) );
-
-				// Next two instruction are address we just used.
-				DoubleIncrementPc( );
-			}
-			break;
-
-			case 0x3a:
-			{
-				// Load accumulator from address.
-				// Cycles : 4
-				// States : 13
-				// Flags  : none
-				// Addressing : direct
-				DumpDisassembly( "LDA 0x%x", immediate16 );
-				DumpInstruction( "accumulator = (immediate16)" );
-				SetAccumulator( GetMemory8AtAddress( immediate16 ) );
-
-				// Next two instruction are address we just used.
-				DoubleIncrementPc( );
-			}
-			break;
-
-			case 0x22:
-			{
-				// Store HL direct.
-				// Cycles : 5
-				// States : 16
-				// Flags  : none
-				// Addressing : direct
-				DumpDisassembly( "SHLD" );
-				DumpInstruction( "(immediate16) = HL" );
-				SetMemory16AtAddress( immediate16, GetRegisterHl( ) );
-
-				// Next two instruction are address we just used.
-				DoubleIncrementPc( );
-			}
-			break;
-
-			case 0x2a:
-			{
-				// Load HL direct.
-				// Cycles : 5
-				// States : 16
-				// Flags  : none
-				// Addressing : direct
-				DumpDisassembly( "LHLD" );
-				DumpInstruction( "HL = (immediate16)" );
-				SetRegisterHl( GetMemory16AtAddress( immediate16 ) );
-
-				// Next two instruction are address we just used.
-				DoubleIncrementPc( );
-			}
-			break;
-
-			case 0xeb:
-			{
-				// Exchange DE and HL.
-				// Cycles : 1
-				// States : 4
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "XCHG" );
-				DumpInstruction( "DE <=> HL" );
-				Uint16 de = GetRegisterDe( );
-				Uint16 hl = GetRegisterHl( );
-				SetRegisterDe( hl );
-				SetRegisterHl( de );
-
-				if ( chip8.Cpu.Regs.pc == 0x090A )
-				{
-					static int a = 5;
-					++a;
-				}
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Stack operations.
-			// ------------------------------------------------------------
-			case 0xc5:
-			{
-				// Push BC onto stack.
-				// Cycles : 3
-				// States : 11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "PUSH B" );
-				DumpInstruction( "(SP-2) = BC ; SP -= 2" );
-				PushAndDecrementStack16( GetRegisterBc( ) );
-			}
-			break;
-
-			case 0xd5:
-			{
-				// Push DE onto stack.
-				// Cycles : 3
-				// States : 11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "PUSH D" );
-				DumpInstruction( "(SP-2) = DE ; SP -= 2" );
-				PushAndDecrementStack16( GetRegisterDe( ) );
-			}
-			break;
-
-			case 0xe5:
-			{
-				// Push HL onto stack.
-				// Cycles : 3
-				// States : 11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "PUSH H" );
-				DumpInstruction( "(SP-2) = HL ; SP -= 2" );
-				PushAndDecrementStack16( GetRegisterHl( ) );
-			}
-			break;
-
-			case 0xf5:
-			{
-				// Push A and flags onto stack.
-				// Cycles : 3
-				// States : 11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "PUSH PSW" );
-				DumpInstruction( "(SP-1) = A ; (SP-2) = FLAGS ; SP -= 2" );
-				PushAndDecrementStack8( GetAccumulator( ) );
-				PushAndDecrementStack8( GetFlags( ).u8 );
-			}
-			break;
-
-			case 0xc1:
-			{
-				// Pop BC from stack.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "POP B" );
-				DumpInstruction( "BC = (SP) ; SP += 2" );
-				SetRegisterBc( PopStack16( ) );
-				DoubleIncrementSp( );
-			}
-			break;
-
-			case 0xd1:
-			{
-				// Pop DE from stack.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "POP D" );
-				DumpInstruction( "DE = (SP) ; SP += 2" );
-				SetRegisterDe( PopStack16( ) );
-				DoubleIncrementSp( );
-			}
-			break;
-
-			case 0xe1:
-			{
-				// Pop HL from stack.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "POP H" );
-				DumpInstruction( "HL = (SP) ; SP += 2" );
-				SetRegisterHl( PopStack16( ) );
-				DoubleIncrementSp( );
-			}
-			break;
-
-			case 0xf1:
-			{
-				// Pop A and flags from stack.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "POP PSW" );
-				DumpInstruction( "FLAGS = (SP) ; A = (SP+1) ; SP += 2" );
-				SetFlags( PopStack8( ) );
-				IncrementSp( );
-				SetAccumulator( PopStack8( ) );
-				IncrementSp( );
-			}
-			break;
-
-			case 0xe3:
-			{
-				// (SP) <=> HL.
-				// Cycles : 5
-				// States : 18
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "XTHL" );
-				DumpInstruction( "(SP) <=> HL" );
-				Uint16 hl = GetRegisterHl( );
-				Uint16 derefSp = GetMemory16AtAddress( GetRegisterSp( ) );
-				SetRegisterHl( derefSp );
-				SetMemory16AtAddress( GetRegisterSp( ), hl );
-			}
-			break;
-
-			case 0xf9:
-			{
-				// SP = HL.
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "SPHL" );
-				DumpInstruction( "SP = HL" );
-				SetRegisterSp( GetRegisterHl( ) );
-			}
-			break;
-
-			case 0x31:
-			{
-				// Load immediate into SP
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "LXI SP, 0x%x", immediate16 );
-				DumpInstruction( "SP = 0x%x", immediate16 );
-				SetRegisterSp( immediate16 );
-
-				// Next two instruction are immediates we just used.
- 				DoubleIncrementPc( );
-			}
-			break;
-
-			case 0x33:
-			{
-				// Increments SP by one
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "INX SP" );
-				DumpInstruction( "SP++" );
-				SetRegisterSp( GetRegisterSp( ) + 1 );
-			}
-			break;
-
-			case 0x3b:
-			{
-				// Decrements SP by one
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "DCX SP" );
-				DumpInstruction( "SP--" );
-				SetRegisterSp( GetRegisterSp( ) - 1 );
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Jump.
-			// ------------------------------------------------------------
-			case 0xc3:
-			{
-				// Jump to specified address.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "JMP 0x%x", immediate16 );
-				DumpInstruction( "PC = immediate16" );
-
-				// -1 to take account of the increment at the end of the loop.
-				SetRegisterPc( immediate16 - 1 );
-			}
-			break;
-
-			case 0xda:
-			{
-				// Jump to specified address if carry flag is set.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "JC 0x%x", immediate16 );
-				DumpInstruction( "If carry bit set then PC = immediate16" );
-
-				if ( chip8.Cpu.Regs.flags.cy )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xd2:
-			{
-				// Jump to specified address if carry flag is not set.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "JNC 0x%x", immediate16 );
-				DumpInstruction( "If carry bit not set then PC = immediate16" );
-
-				if ( ! chip8.Cpu.Regs.flags.cy )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xca:
-			{
-				// Jump to specified address if zero flag is set.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "JZ 0x%x", immediate16 );
-				DumpInstruction( "If zero bit set then PC = immediate16" );
-
-				if ( chip8.Cpu.Regs.flags.z )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xc2:
-			{
-				// Jump to specified address if zero flag is not set.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "JNZ 0x%x", immediate16 );
-				DumpInstruction( "If zero bit not set then PC = immediate16" );
-
-				if ( ! chip8.Cpu.Regs.flags.z )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xf2:
-			{
-				// Jump to specified address if positive.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "JP 0x%x", immediate16 );
-				DumpInstruction( "If positive then PC = immediate16" );
-
-				if ( ! chip8.Cpu.Regs.flags.s )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xfa:
-			{
-				// Jump to specified address if negative.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "JM 0x%x", immediate16 );
-				DumpInstruction( "If negative then PC = immediate16" );
-
-				if ( chip8.Cpu.Regs.flags.s )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xea:
-			{
-				// Jump to specified address if parity even.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "JPE 0x%x", immediate16 );
-				DumpInstruction( "If parity even then PC = immediate16" );
-
-				if ( chip8.Cpu.Regs.flags.p )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xe2:
-			{
-				// Jump to specified address if parity odd.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : immediate
-				DumpDisassembly( "JPO 0x%x", immediate16 );
-				DumpInstruction( "If parity odd then PC = immediate16" );
-
-				if ( ! chip8.Cpu.Regs.flags.p )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xe9:
-			{
-				// Jump to HL value.
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "PCHL" );
-				DumpInstruction( "PC = HL" );
-
-				// -1 to take account of the increment at the end of the loop.
-				SetRegisterPc( GetRegisterHl( ) - 1 );
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Call.
-			// ------------------------------------------------------------
-			case 0xcd:
-			{
-				// Calls specified address (save next PC location to stack).
-				// Cycles : 5
-				// States : 17
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "CALL 0x%x", immediate16 );
-				DumpInstruction( "(SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
-
-				// Store next instruction (+3 as next two bytes make up the jump to address).
-				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
-
-				if ( chip8.Cpu.Regs.pc == 0x08F5 )
-				{
-					static int a = 5;
-					++a;
-				}
-
-				// -1 to take account of the increment at the end of the loop.
-				SetRegisterPc( immediate16 - 1 );
-			}
-			break;
-
-			case 0xdc:
-			{
-				// Calls specified address on carry (save next PC location to stack).
-				// Cycles : 3/5
-				// States : 11/17
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "CC 0x%x", immediate16 );
-				DumpInstruction( "If carry (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
-
-				if ( GetFlags( ).cy )
-				{
-					// Store next instruction (+3 as next two bytes make up the jump to address).
-					PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
-
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xd4:
-			{
-				// Calls specified address on no carry (save next PC location to stack).
-				// Cycles : 3/5
-				// States : 11/17
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "CNC 0x%x", immediate16 );
-				DumpInstruction( "If no carry (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
-
-				if ( ! GetFlags( ).cy )
-				{
-					// Store next instruction (+3 as next two bytes make up the jump to address).
-					PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
-
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xcc:
-			{
-				// Calls specified address on zero (save next PC location to stack).
-				// Cycles : 3/5
-				// States : 11/17
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "CZ 0x%x", immediate16 );
-				DumpInstruction( "If zero (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
-
-				if ( GetFlags( ).z )
-				{
-					// Store next instruction (+3 as next two bytes make up the jump to address).
-					PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
-
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xc4:
-			{
-				// Calls specified address on not zero (save next PC location to stack).
-				// Cycles : 3/5
-				// States : 11/17
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "CNZ 0x%x", immediate16 );
-				DumpInstruction( "If zero (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
-
-				if ( ! GetFlags( ).z )
-				{
-					// Store next instruction (+3 as next two bytes make up the jump to address).
-					PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
-
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xf4:
-			{
-				// Calls specified address on positive (save next PC location to stack).
-				// Cycles : 3/5
-				// States : 11/17
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "CP 0x%x", immediate16 );
-				DumpInstruction( "If positive (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
-
-				if ( ! GetFlags( ).s )
-				{
-					// Store next instruction (+3 as next two bytes make up the jump to address).
-					PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
-
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xfc:
-			{
-				// Calls specified address on negative (save next PC location to stack).
-				// Cycles : 3/5
-				// States : 11/17
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "CM 0x%x", immediate16 );
-				DumpInstruction( "If positive (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
-
-				if ( GetFlags( ).s )
-				{
-					// Store next instruction (+3 as next two bytes make up the jump to address).
-					PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
-
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xec:
-			{
-				// Calls specified address on parity even (save next PC location to stack).
-				// Cycles : 3/5
-				// States : 11/17
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "CPE 0x%x", immediate16 );
-				DumpInstruction( "If parity even (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
-
-				if ( GetFlags( ).p )
-				{
-					// Store next instruction (+3 as next two bytes make up the jump to address).
-					PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
-
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			case 0xe4:
-			{
-				// Calls specified address on parity odd (save next PC location to stack).
-				// Cycles : 3/5
-				// States : 11/17
-				// Flags  : none
-				// Addressing : immediate/register indirect
-				DumpDisassembly( "CPO 0x%x", immediate16 );
-				DumpInstruction( "If parity odd (SP) = PC+1 ; SP -= 2 ; PC = immediate16" );
-
-				if ( ! GetFlags( ).p )
-				{
-					// Store next instruction (+3 as next two bytes make up the jump to address).
-					PushAndDecrementStack16( chip8.Cpu.Regs.pc + 3 );
-
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( immediate16 - 1 );
-				}
-				else
-				{
-					// Next two instruction are address we didn't jump to.
-					DoubleIncrementPc( );
-				}
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Return.
-			// ------------------------------------------------------------
-			case 0xc9:
-			{
-				// Return to caller (on stack).
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RET" );
-				DumpInstruction( "Return to caller" );
-
-				if ( g_InRst )
-				{
-					g_InRst = false;
-					if ( chip8.Cpu.Regs.pc != 0x87 )
-					{
-						static int a = 5;
-						++a;
-					}
-				}
-
-				// -1 to take account of the increment at the end of the loop.
-				SetRegisterPc( PopStack16( ) - 1 );
-
-				// We have popped the last two stack entries.
-				DoubleIncrementSp( );
-			}
-			break;
-
-			case 0xd8:
-			{
-				// Return on carry to caller (on stack).
-				// Cycles : 1/3
-				// States : 5/11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RC" );
-				DumpInstruction( "Return on carry to caller" );
-
-				if ( GetFlags( ).cy )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( PopStack16( ) - 1 );
-
-					// We have popped the last two stack entries.
-					DoubleIncrementSp( );
-				}
-			}
-			break;
-
-			case 0xd0:
-			{
-				// Return on not carry to caller (on stack).
-				// Cycles : 1/3
-				// States : 5/11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RNC" );
-				DumpInstruction( "Return on not carry to caller" );
-
-				if ( ! GetFlags( ).cy )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( PopStack16( ) - 1 );
-
-					// We have popped the last two stack entries.
-					DoubleIncrementSp( );
-				}
-			}
-			break;
-
-			case 0xc8:
-			{
-				// Return on zero to caller (on stack).
-				// Cycles : 1/3
-				// States : 5/11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RZ" );
-				DumpInstruction( "Return on zero to caller" );
-
-				if ( GetFlags( ).z )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( PopStack16( ) - 1 );
-
-					// We have popped the last two stack entries.
-					DoubleIncrementSp( );
-				}
-			}
-			break;
-
-			case 0xc0:
-			{
-				// Return on not zero to caller (on stack).
-				// Cycles : 1/3
-				// States : 5/11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RNZ" );
-				DumpInstruction( "Return on not zero to caller" );
-
-				if ( ! GetFlags( ).z )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( PopStack16( ) - 1 );
-
-					// We have popped the last two stack entries.
-					DoubleIncrementSp( );
-				}
-			}
-			break;
-
-			case 0xf0:
-			{
-				// Return on positive to caller (on stack).
-				// Cycles : 1/3
-				// States : 5/11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RP" );
-				DumpInstruction( "Return on positive to caller" );
-
-				if ( ! GetFlags( ).s )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( PopStack16( ) - 1 );
-
-					// We have popped the last two stack entries.
-					DoubleIncrementSp( );
-				}
-			}
-			break;
-
-			case 0xf8:
-			{
-				// Return on negative to caller (on stack).
-				// Cycles : 1/3
-				// States : 5/11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RM" );
-				DumpInstruction( "Return on negative to caller" );
-
-				if ( GetFlags( ).s )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( PopStack16( ) - 1 );
-
-					// We have popped the last two stack entries.
-					DoubleIncrementSp( );
-				}
-			}
-			break;
-
-			case 0xe8:
-			{
-				// Return on parity even to caller (on stack).
-				// Cycles : 1/3
-				// States : 5/11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RPE" );
-				DumpInstruction( "Return on parity even to caller" );
-
-				if ( GetFlags( ).p )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( PopStack16( ) - 1 );
-
-					// We have popped the last two stack entries.
-					DoubleIncrementSp( );
-				}
-			}
-			break;
-
-			case 0xe0:
-			{
-				// Return on parity odd to caller (on stack).
-				// Cycles : 1/3
-				// States : 5/11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RPO" );
-				DumpInstruction( "Return on parity odd to caller" );
-
-				if ( ! GetFlags( ).p )
-				{
-					// -1 to take account of the increment at the end of the loop.
-					SetRegisterPc( PopStack16( ) - 1 );
-
-					// We have popped the last two stack entries.
-					DoubleIncrementSp( );
-				}
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Restart.
-			// ------------------------------------------------------------
-			case _GenDstVariations( 0xc7 ):
-			{
-				// Restart.
-				// Cycles : 3
-				// States : 11
-				// Flags  : none
-				// Addressing : register indirect
-				DumpDisassembly( "RST" );
-				DumpInstruction( "Restart" );
-
-				// Store next instruction (+1 as we don't have any extra data for this instruction, it is encoded into the instruction).
-				PushAndDecrementStack16( chip8.Cpu.Regs.pc + 1 );
-
-				// -1 to take account of the increment at the end of the loop.
-				SetRegisterPc( ( d * 8 ) - 1 );
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Increment and decrement.
-			// ------------------------------------------------------------
-			case _GenDstVariations( 0x4 ):
-			{
-				// Increment register.
-				// Cycles : 1
-				// States : 5
-				// Flags  : Z, S, P, AC
-				// Addressing : register
-				DumpDisassembly( "INR %s", RegName( d ) );
-				DumpInstruction( "r%d += 1", d );
-
-				chip8.Cpu.Regs.gpr[ RegIndex( d ) ] += 1;
-
-				GetFlags( ).z = chip8.Cpu.Regs.gpr[ RegIndex( d ) ] == 0;
-				GetFlags( ).s = chip8.Cpu.Regs.gpr[ RegIndex( d ) ] >> 7;
-				GetFlags( ).p = ParityTable256[ chip8.Cpu.Regs.gpr[ RegIndex( d ) ] ];
-				GetFlags( ).ac = ( chip8.Cpu.Regs.gpr[ RegIndex( d ) ] & 0xf ) == 0x0;
-			}
-			break;
-
-			case _GenDstVariations( 0x5 ):
-			{
-				// Decrement register.
-				// Cycles : 1
-				// States : 5
-				// Flags  : Z, S, P, AC
-				// Addressing : register
-				DumpDisassembly( "DCR %s", RegName( d ) );
-				DumpInstruction( "r%d -= 1", d );
-
-				chip8.Cpu.Regs.gpr[ RegIndex( d ) ] -= 1;
-
-				GetFlags( ).z = chip8.Cpu.Regs.gpr[ RegIndex( d ) ] == 0;
-				GetFlags( ).s = chip8.Cpu.Regs.gpr[ RegIndex( d ) ] >> 7;
-				GetFlags( ).p = ParityTable256[ chip8.Cpu.Regs.gpr[ RegIndex( d ) ] ];
-				GetFlags( ).ac = ( chip8.Cpu.Regs.gpr[ RegIndex( d ) ] & 0xf ) == 0xf;
-			}
-			break;
-
-			case 0x34:
-			{
-				// Increment value in memory (HL).
-				// Cycles : 3
-				// States : 10
-				// Flags  : Z, S, P, AC
-				// Addressing : register indirect
-				DumpDisassembly( "INR M" );
-				DumpInstruction( "(HL) += 1" );
-
-				Uint8 v = GetHlMemory8( );
-				v += 1;
-				SetHlMemory8( v );
-
-				GetFlags( ).z = v == 0;
-				GetFlags( ).s = v >> 7;
-				GetFlags( ).p = ParityTable256[ v ];
-				GetFlags( ).ac = ( v & 0xf ) == 0x0;
-			}
-			break;
-
-			case 0x35:
-			{
-				// Decrement value in memory (HL).
-				// Cycles : 3
-				// States : 10
-				// Flags  : Z, S, P, AC
-				// Addressing : register
-				DumpDisassembly( "DCR M" );
-				DumpInstruction( "(HL) -= 1" );
-
-				Uint8 v = GetHlMemory8( );
-				v -= 1;
-				SetHlMemory8( v );
-
-				GetFlags( ).z = v == 0;
-				GetFlags( ).s = v >> 7;
-				GetFlags( ).p = ParityTable256[ v ];
-				GetFlags( ).ac = ( v & 0xf ) == 0xf;
-			}
-			break;
-
-			case 0x03:
-			{
-				// Increment BC.
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "INX B" );
-				DumpInstruction( "BC += 1" );
-
-				chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::BC ] += 1;
-			}
-			break;
-
-			case 0x13:
-			{
-				// Increment DE.
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "INX D" );
-				DumpInstruction( "DE += 1" );
-
-				chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::DE ] += 1;
-			}
-			break;
-
-			case 0x23:
-			{
-				// Increment HL.
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "INX H" );
-				DumpInstruction( "HL += 1" );
-
-				chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::HL ] += 1;
-			}
-			break;
-
-			case 0x0b:
-			{
-				// Decrement BC.
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "DCX B" );
-				DumpInstruction( "BC -= 1" );
-
-				chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::BC ] -= 1;
-			}
-			break;
-
-			case 0x1b:
-			{
-				// Decrement DE.
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "DCX D" );
-				DumpInstruction( "DE -= 1" );
-
-				chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::DE ] -= 1;
-			}
-			break;
-
-			case 0x2b:
-			{
-				// Decrement HL.
-				// Cycles : 1
-				// States : 5
-				// Flags  : none
-				// Addressing : register
-				DumpDisassembly( "DCX H" );
-				DumpInstruction( "HL -= 1" );
-
-				chip8.Cpu.Regs.gprPair[ Cpu8080::CommandProcessingUnit::Registers::GprPair::HL ] -= 1;
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Add.
-			// ------------------------------------------------------------
-			case _GenSrcVariations( 0x80 ):
-			{
-				// Add register to accumulator.
-				// Cycles : 1
-				// States : 4
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register
-				DumpDisassembly( "ADD %s", RegName( s ) );
-				DumpInstruction( "accumulator += r%d", s );
-
-				// Result (as 16 bit to detect carry).
-				Uint16 r  = chip8.Cpu.Regs.accumulator + chip8.Cpu.Regs.gpr[ RegIndex( s ) ];
-
-				// Result of adding lower nibbles together (to detect auxiliary carry).
-				Uint8 nr = ( chip8.Cpu.Regs.accumulator & 0xf ) + ( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf );
-
-				// Truncate Uint16 to Uint8, we handle flags after.
-				chip8.Cpu.Regs.accumulator = ( Uint8 )r;
-
-				GetFlags( ).z = chip8.Cpu.Regs.accumulator == 0;
-				GetFlags( ).s = chip8.Cpu.Regs.accumulator >> 7;
-				GetFlags( ).p = ParityTable256[ chip8.Cpu.Regs.accumulator ];
-				GetFlags( ).cy = r > 0xff;
-				GetFlags( ).ac = nr > 0xf;
-			}
-			break;
-
-			case _GenSrcVariations( 0x88 ):
-			{
-				// Add register and carry flag to accumulator.
-				// Cycles : 1
-				// States : 4
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register
-				DumpDisassembly( "ADC %s", RegName( s ) );
-				DumpInstruction( "accumulator += r%d + carry", s );
-
-				// Result (as 16 bit to detect carry).
-				Uint16 r  = chip8.Cpu.Regs.accumulator + chip8.Cpu.Regs.gpr[ RegIndex( s ) ] + GetFlags( ).cy;
-
-				// Result of adding lower nibbles together (to detect auxiliary carry).
-				Uint8 nr = ( chip8.Cpu.Regs.accumulator & 0xf ) + ( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf ) + GetFlags( ).cy;
-
-				// Truncate Uint16 to Uint8, we handle flags after.
-				chip8.Cpu.Regs.accumulator = ( Uint8 )r;
-
-				GetFlags( ).z = chip8.Cpu.Regs.accumulator == 0;
-				GetFlags( ).s = chip8.Cpu.Regs.accumulator >> 7;
-				GetFlags( ).p = ParityTable256[ chip8.Cpu.Regs.accumulator ];
-				GetFlags( ).cy = r > 0xff;
-				GetFlags( ).ac = nr > 0xf;
-			}
-			break;
-
-			case 0x86:
-			{
-				// Add (HL) to accumulator.
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register indirect
-				DumpDisassembly( "ADD M" );
-				DumpInstruction( "accumulator += (HL)" );
-
-				// Result (as 16 bit to detect carry).
-				Uint16 r  = GetAccumulator( ) + GetHlMemory8( );
-
-				// Result of adding lower nibbles together (to detect auxiliary carry).
-				Uint8 nr = ( GetAccumulator( ) & 0xf ) + ( GetHlMemory8( ) & 0xf );
-
-				// Truncate Uint16 to Uint8, we handle flags after.
-				SetAccumulator( ( Uint8 )r );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r > 0xff;
-				GetFlags( ).ac = nr > 0xf;
-			}
-			break;
-
-			case 0x8e:
-			{
-				// Add (HL) and carry flag to accumulator.
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register indirect
-				DumpDisassembly( "ADC M" );
-				DumpInstruction( "accumulator += (HL) + carry" );
-
-				// Result (as 16 bit to detect carry).
-				Uint16 r  = GetAccumulator( ) + GetHlMemory8( ) + GetFlags( ).cy;
-
-				// Result of adding lower nibbles together (to detect auxiliary carry).
-				Uint8 nr = ( GetAccumulator( ) & 0xf ) + ( GetHlMemory8( ) & 0xf ) + GetFlags( ).cy;
-
-				// Truncate Uint16 to Uint8, we handle flags after.
-				SetAccumulator( ( Uint8 )r );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r > 0xff;
-				GetFlags( ).ac = nr > 0xf;
-			}
-			break;
-
-			case 0xc6:
-			{
-				// Add immediate to accumulator.
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : immediate
-				DumpDisassembly( "ADI 0x%x", immediate );
-				DumpInstruction( "accumulator += %d", immediate );
-
-				// Result (as 16 bit to detect carry).
-				Uint16 r  = GetAccumulator( ) + immediate;
-
-				// Result of adding lower nibbles together (to detect auxiliary carry).
-				Uint8 nr = ( GetAccumulator( ) & 0xf ) + ( immediate & 0xf );
-
-				// Truncate Uint16 to Uint8, we handle flags after.
-				SetAccumulator( ( Uint8 )r );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r > 0xff;
-				GetFlags( ).ac = nr > 0xf;
-
-				// Skip over immediate we used this operation.
-				IncrementPc( );
-			}
-			break;
-
-			case 0xce:
-			{
-				// Add immediate and carry to accumulator.
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : immediate
-				DumpDisassembly( "ACI 0x%x", immediate );
-				DumpInstruction( "accumulator += %d + carry", immediate );
-
-				// Result (as 16 bit to detect carry).
-				Uint16 r  = GetAccumulator( ) + immediate + GetFlags( ).cy;
-
-				// Result of adding lower nibbles together (to detect auxiliary carry).
-				Uint8 nr = ( GetAccumulator( ) & 0xf ) + ( immediate & 0xf ) + GetFlags( ).cy;
-
-				// Truncate Uint16 to Uint8, we handle flags after.
-				SetAccumulator( ( Uint8 )r );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r > 0xff;
-				GetFlags( ).ac = nr > 0xf;
-
-				// Skip over immediate we used this operation.
-				IncrementPc( );
-			}
-			break;
-
-			case 0x09:
-			{
-				// Add BC to HL.
-				// Cycles : 3
-				// States : 10
-				// Flags  : CY
-				// Addressing : register
-				DumpDisassembly( "DAD B" );
-				DumpInstruction( "HL += BC" );
-
-				// Result (as 32 bit to detect carry).
-				Uint32 r  = GetRegisterHl( ) + GetRegisterBc( );
-
-				// Truncate Uint32 to Uint16, we handle flags after.
-				SetRegisterHl( ( Uint16 )r );
-
-				GetFlags( ).cy = r > 0xffff;
-			}
-			break;
-
-			case 0x19:
-			{
-				// Add DE to HL.
-				// Cycles : 3
-				// States : 10
-				// Flags  : CY
-				// Addressing : register
-				DumpDisassembly( "DAD D" );
-				DumpInstruction( "HL += DE" );
-
-				// Result (as 32 bit to detect carry).
-				Uint32 r  = GetRegisterHl( ) + GetRegisterDe( );
-
-				// Truncate Uint32 to Uint16, we handle flags after.
-				SetRegisterHl( ( Uint16 )r );
-
-				GetFlags( ).cy = r > 0xffff;
-			}
-			break;
-
-			case 0x29:
-			{
-				// Add HL to HL.
-				// Cycles : 3
-				// States : 10
-				// Flags  : CY
-				// Addressing : register
-				DumpDisassembly( "DAD H" );
-				DumpInstruction( "HL += HL" );
-
-				// Result (as 32 bit to detect carry).
-				Uint32 r  = GetRegisterHl( ) + GetRegisterHl( );
-
-				// Truncate Uint32 to Uint16, we handle flags after.
-				SetRegisterHl( ( Uint16 )r );
-
-				GetFlags( ).cy = r > 0xffff;
-			}
-			break;
-
-			case 0x39:
-			{
-				// Add SP to HL.
-				// Cycles : 3
-				// States : 10
-				// Flags  : CY
-				// Addressing : register
-				DumpDisassembly( "DAD SP" );
-				DumpInstruction( "HL += SP" );
-
-				// Result (as 32 bit to detect carry).
-				Uint32 r  = GetRegisterHl( ) + GetRegisterSp( );
-
-				// Truncate Uint32 to Uint16, we handle flags after.
-				SetRegisterHl( ( Uint16 )r );
-
-				GetFlags( ).cy = r > 0xffff;
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Subtract.
-			// ------------------------------------------------------------
-			case _GenSrcVariations( 0x90 ):
-			{
-				// Subtract register from accumulator.
-				// Cycles : 1
-				// States : 4
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register
-				DumpDisassembly( "SUB %s", RegName( s ) );
-				DumpInstruction( "accumulator -= r%d", s );
-
-				// Result (as signed 16 bit to detect carry).
-				Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )chip8.Cpu.Regs.gpr[ RegIndex( s ) ];
-
-				// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
-				Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf );
-
-				// Handle borrow after.
-				SetAccumulator( GetAccumulator( ) - chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r < 0;
-				GetFlags( ).ac = nr < 0;
-			}
-			break;
-
-			case _GenSrcVariations( 0x98 ):
-			{
-				// Subtract register and borrow from accumulator.
-				// Cycles : 1
-				// States : 4
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register
-				DumpDisassembly( "SBB %s", RegName( s ) );
-				DumpInstruction( "accumulator -= (r%d + borrow)", s );
-
-				// Result (as signed 16 bit to detect carry).
-				Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )chip8.Cpu.Regs.gpr[ RegIndex( s ) ] - ( Sint16 )GetFlags( ).cy;
-
-				// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
-				Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf ) - GetFlags( ).cy;
-
-				// Handle borrow after.
-				SetAccumulator( GetAccumulator( ) - chip8.Cpu.Regs.gpr[ RegIndex( s ) ] - GetFlags( ).cy );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r < 0;
-				GetFlags( ).ac = nr < 0;
-			}
-			break;
-
-			case 0x96:
-			{
-				// Subtract (HL) from accumulator.
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register indirect
-				DumpDisassembly( "SUB M" );
-				DumpInstruction( "accumulator -= (HL)" );
-
-				// Result (as signed 16 bit to detect carry).
-				Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )GetHlMemory8( );
-
-				// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
-				Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( GetHlMemory8( ) & 0xf );
-
-				// Handle borrow after.
-				SetAccumulator( GetAccumulator( ) - GetHlMemory8( ) );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r < 0;
-				GetFlags( ).ac = nr < 0;
-			}
-			break;
-
-			case 0x9e:
-			{
-				// Subtract (HL) and carry from accumulator.
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register indirect
-				DumpDisassembly( "SBB M" );
-				DumpInstruction( "accumulator -= ( (HL) + borrow )" );
-
-				// Result (as signed 16 bit to detect carry).
-				Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )GetHlMemory8( ) - GetFlags( ).cy;
-
-				// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
-				Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( GetHlMemory8( ) & 0xf ) - GetFlags( ).cy;
-
-				// Handle borrow after.
-				SetAccumulator( GetAccumulator( ) - GetHlMemory8( ) - GetFlags( ).cy );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r < 0;
-				GetFlags( ).ac = nr < 0;
-			}
-			break;
-
-			case 0xd6:
-			{
-				// Subtract immediate from accumulator.
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : immediate
-				DumpDisassembly( "SUI 0x%x", immediate );
-				DumpInstruction( "accumulator -= %d", immediate );
-
-				// Result (as signed 16 bit to detect carry).
-				Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )immediate;
-
-				// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
-				Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( immediate & 0xf );
-
-				// Handle borrow after.
-				SetAccumulator( GetAccumulator( ) - immediate );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r < 0;
-				GetFlags( ).ac = nr < 0;
-
-				// Skip over immediate we used this operation.
-				IncrementPc( );
-			}
-			break;
-
-			case 0xde:
-			{
-				// Subtract immediate and carry from accumulator.
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : immediate
-				DumpDisassembly( "SBI 0x%x", immediate );
-				DumpInstruction( "accumulator -= (%d + borrow)", immediate );
-
-				// Result (as signed 16 bit to detect carry).
-				Sint16 r  = ( Sint16 )GetAccumulator( ) - ( Sint16 )immediate - GetFlags( ).cy;
-
-				// Result of subtracting lower nibbles from each other (to detect auxiliary carry).
-				Sint16 nr = ( Sint16 )( GetAccumulator( ) & 0xf ) - ( Sint16 )( immediate & 0xf ) - GetFlags( ).cy;
-
-				// Handle borrow after.
-				SetAccumulator( GetAccumulator( ) - immediate - GetFlags( ).cy );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = r < 0;
-				GetFlags( ).ac = nr < 0;
-
-				// Skip over immediate we used this operation.
-				IncrementPc( );
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Logical.
-			// ------------------------------------------------------------
-			case _GenSrcVariations( 0xa0 ):
-			{
-				// Accumulator is AND with register (result to accumulator).
-				// Cycles : 1
-				// States : 4
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register
-				DumpDisassembly( "ANA %s", RegName( s ) );
-				DumpInstruction( "accumulator &= r%d", s );
-
-				SetAccumulator( GetAccumulator( ) & chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = 0;	// Documents specify this (makes sense).
-				GetFlags( ).ac = 0;	// TODO: Feels like this should be 0, although 8085A specifies ANA leaves AC set.
-			}
-			break;
-
-			case _GenSrcVariations( 0xa8 ):
-			{
-				// Accumulator is XOR with register (result to accumulator).
-				// Cycles : 1
-				// States : 4
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register
-				DumpDisassembly( "XRA %s", RegName( s ) );
-				DumpInstruction( "accumulator ^= r%d", s );
-
-				SetAccumulator( GetAccumulator( ) ^ chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = 0;	// Documents specify this (makes sense).
-				GetFlags( ).ac = 0;	// Documents specify this too.
-			}
-			break;
-
-			case _GenSrcVariations( 0xb0 ):
-			{
-				// Accumulator is OR with register (result to accumulator).
-				// Cycles : 1
-				// States : 4
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register
-				DumpDisassembly( "ORA %s", RegName( s ) );
-				DumpInstruction( "accumulator |= r%d", s );
-
-				SetAccumulator( GetAccumulator( ) | chip8.Cpu.Regs.gpr[ RegIndex( s ) ] );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = 0;	// Documents specify this (makes sense).
-				GetFlags( ).ac = 0;	// Documents specify this too.
-			}
-			break;
-
-			case _GenSrcVariations( 0xb8 ):
-			{
-				// Compare accumulator with register.
-				// Cycles : 1
-				// States : 4
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register
-				DumpDisassembly( "CMP %s", RegName( s ) );
-				DumpInstruction( "tempReg = accumulator - r%d", s );
-
-				Uint8 r = GetAccumulator( ) - chip8.Cpu.Regs.gpr[ RegIndex( s ) ];
-
-				GetFlags( ).z = r == 0;
-				GetFlags( ).s = r >> 7;
-				GetFlags( ).p = ParityTable256[ r ];
-				GetFlags( ).cy = GetAccumulator( ) < chip8.Cpu.Regs.gpr[ RegIndex( s ) ] ? 1 : 0;
-				GetFlags( ).ac = ( GetAccumulator( ) & 0xf ) < ( chip8.Cpu.Regs.gpr[ RegIndex( s ) ] & 0xf );
-			}
-			break;
-
-			case 0xa6:
-			{
-				// Accumulator is AND with (HL) (result to accumulator).
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register indirect
-				DumpDisassembly( "ANA M" );
-				DumpInstruction( "accumulator &= (HL)" );
-
-				SetAccumulator( GetAccumulator( ) & GetHlMemory8( ) );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = 0;	// Documents specify this (makes sense).
-				GetFlags( ).ac = 0;	// TODO: Feels like this should be 0, although 8085A specifies ANA leaves AC set.
-			}
-			break;
-
-			case 0xae:
-			{
-				// Accumulator is XOR with (HL) (result to accumulator).
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register indirect
-				DumpDisassembly( "XRA M" );
-				DumpInstruction( "accumulator ^= (HL)" );
-
-				SetAccumulator( GetAccumulator( ) ^ GetHlMemory8( ) );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = 0;	// Documents specify this (makes sense).
-				GetFlags( ).ac = 0;	// Documents specify this too.
-			}
-			break;
-
-			case 0xb6:
-			{
-				// Accumulator is OR with (HL) (result to accumulator).
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register indirect
-				DumpDisassembly( "ORA M" );
-				DumpInstruction( "accumulator |= (HL)" );
-
-				SetAccumulator( GetAccumulator( ) | GetHlMemory8( ) );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = 0;	// Documents specify this (makes sense).
-				GetFlags( ).ac = 0;	// Documents specify this too.
-			}
-			break;
-
-			case 0xbe:
-			{
-				// Compare accumulator with (HL).
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : register indirect
-				DumpDisassembly( "CMP M" );
-				DumpInstruction( "tempReg = accumulator - (HL)" );
-
-				Uint8 r = GetAccumulator( ) - GetHlMemory8( );
-
-				GetFlags( ).z = r == 0;
-				GetFlags( ).s = r >> 7;
-				GetFlags( ).p = ParityTable256[ r ];
-				GetFlags( ).cy = GetAccumulator( ) < GetHlMemory8( ) ? 1 : 0;
-				GetFlags( ).ac = ( GetAccumulator( ) & 0xf ) < ( GetHlMemory8( ) & 0xf );
-			}
-			break;
-
-			case 0xe6:
-			{
-				// Accumulator is AND with immediate (result to accumulator).
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : immediate
-				DumpDisassembly( "ANI 0x%x", immediate );
-				DumpInstruction( "accumulator &= %d", immediate );
-
-				SetAccumulator( GetAccumulator( ) & immediate );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = 0;	// Documents specify this (makes sense).
-				GetFlags( ).ac = 0;	// Documents specify this too.
-
-				// Skip over immediate we used this operation.
-				IncrementPc( );
-			}
-			break;
-
-			case 0xee:
-			{
-				// Accumulator is XOR with immediate (result to accumulator).
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : immediate
-				DumpDisassembly( "XRI 0x%x", immediate );
-				DumpInstruction( "accumulator ^= %d", immediate );
-
-				SetAccumulator( GetAccumulator( ) ^ immediate );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = 0;	// Documents specify this (makes sense).
-				GetFlags( ).ac = 0;	// Documents specify this too.
-
-				// Skip over immediate we used this operation.
-				IncrementPc( );
-			}
-			break;
-
-			case 0xf6:
-			{
-				// Accumulator is OR with immediate (result to accumulator).
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : immediate
-				DumpDisassembly( "ORI 0x%x", immediate );
-				DumpInstruction( "accumulator |= %d", immediate );
-
-				SetAccumulator( GetAccumulator( ) | immediate );
-
-				GetFlags( ).z = GetAccumulator( ) == 0;
-				GetFlags( ).s = GetAccumulator( ) >> 7;
-				GetFlags( ).p = ParityTable256[ GetAccumulator( ) ];
-				GetFlags( ).cy = 0;	// Documents specify this (makes sense).
-				GetFlags( ).ac = 0;	// Documents specify this too.
-
-				// Skip over immediate we used this operation.
-				IncrementPc( );
-			}
-			break;
-
-			case 0xfe:
-			{
-				// Compare accumulator with immediate.
-				// Cycles : 2
-				// States : 7
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : immediate
-				DumpDisassembly( "CPI 0x%x", immediate );
-				DumpInstruction( "tempReg = accumulator - %d", immediate );
-
-				Uint8 r = GetAccumulator( ) - immediate;
-
-				GetFlags( ).z = r == 0;
-				GetFlags( ).s = r >> 7;
-				GetFlags( ).p = ParityTable256[ r ];
-				GetFlags( ).cy = GetAccumulator( ) < immediate ? 1 : 0;
-				GetFlags( ).ac = ( GetAccumulator( ) & 0xf ) < ( immediate & 0xf ) ? 1 : 0;
-
-				// Skip over immediate we used this operation.
-				IncrementPc( );
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Rotate.
-			// ------------------------------------------------------------
-			case 0x7:
-			{
-				// Accumulator is rotated left (carry and LSB gets MSB).
-				// Cycles : 1
-				// States : 4
-				// Flags  : CY
-				// Addressing : -
-				DumpDisassembly( "RLC" );
-				DumpInstruction( "accumulator <<= 1" );
-
-				GetFlags( ).cy = GetAccumulator( ) >> 7;
-
-				SetAccumulator( ( GetAccumulator( ) << 1 ) | GetFlags( ).cy );
-			}
-			break;
+		printf( "%u scenarios mismatched, %u missing from %s\n", report.Mismatched, report.Missing, goldenFile );
+		return passed ? 0 : 1;
+	}
 
-			case 0xf:
-			{
-				// Accumulator is rotated right (carry and MSB gets LSB).
-				// Cycles : 1
-				// States : 4
-				// Flags  : CY
-				// Addressing : -
-				DumpDisassembly( "RRC" );
-				DumpInstruction( "accumulator >>= 1" );
+	MovieRecorder recorder;
+	Uint32 flags = ( useHle ? kMovieFlagHle : 0 ) | ( g_SkipIdleLoops ? kMovieFlagIdleSkip : 0 );
 
-				GetFlags( ).cy = GetAccumulator( ) & 0x1;
+	// Search for inputs from the start of a game headless, saving what was found as a movie.
+	if ( searchFile )
+	{
+		if ( ! recorder.Open( searchFile, chip8.Memory.Rom, flags, keyframeInterval ) )
+		{
+			printf( "Unable to create movie %s\n", searchFile );
+			return 1;
+		}
 
-				SetAccumulator( ( GetAccumulator( ) >> 1 ) | ( GetFlags( ).cy << 7 ) );
-			}
-			break;
+		StartOnePlayerGame( chip8, &recorder );
+		search.Threads = threads;
 
-			case 0x17:
-			{
-				// Accumulator is rotated left (carry gets MSB, LSB gets carry).
-				// Cycles : 1
-				// States : 4
-				// Flags  : CY
-				// Addressing : -
-				DumpDisassembly( "RAL" );
-				DumpInstruction( "accumulator <<= 1" );
+		Uint32 startTime = SDL_GetTicks( );
+		SearchResult result;
+		bool found = RunSearch( chip8, search, result );
+		Uint32 elapsed = std::max( SDL_GetTicks( ) - startTime, 1u );
 
-				// Store carry.
-				Uint8 lsb = GetFlags( ).cy;
+		printf( "Searched %llu frames in %u ms (%llu frames/s), %llu states merged\n", ( unsigned long long )result.FramesEmulated, elapsed,
+			( unsigned long long )( result.FramesEmulated * 1000 / elapsed ), ( unsigned long long )result.StatesMerged );
+		if ( ! found )
+		{
+			printf( "Goal not reached within %u steps\n", search.MaxSteps );
+			return 1;
+		}
 
-				// Set carry to MSB.
-				GetFlags( ).cy = GetAccumulator( ) >> 7;
+		for ( size_t ix = 0; ix < result.Actions.size( ); ++ix )
+		{
+			RunFramesWithInputs( chip8, InvadersActionToInputs( result.Actions[ ix ] ), search.FramesPerStep, &recorder );
+		}
 
-				SetAccumulator( ( GetAccumulator( ) << 1 ) | lsb );
-			}
-			break;
+		printf( "Goal reached at frame %u, saved to %s\n", chip8.Frame, searchFile );
+		return 0;
+	}
 
-			case 0x1f:
-			{
-				// Accumulator is rotated right (carry gets LSB, MSB gets carry).
-				// Cycles : 1
-				// States : 4
-				// Flags  : CY
-				// Addressing : -
-				DumpDisassembly( "RAR" );
-				DumpInstruction( "accumulator >>= 1" );
+	if ( recordFile )
+	{
+		if ( ! recorder.Open( recordFile, chip8.Memory.Rom, flags, keyframeInterval ) )
+		{
+			printf( "Unable to create movie %s\n", recordFile );
+			return 1;
+		}
+	}
 
-				// Store carry.
-				Uint8 msb = GetFlags( ).cy;
+	// Rewinding would rewrite history a movie has already recorded.
+	RewindBuffer * rewind = recordFile ? NULL : new RewindBuffer( kRewindSeconds * 60 );
 
-				// Set carry to LSB.
-				GetFlags( ).cy = GetAccumulator( ) & 0x1;
+	Api api;
+	api.Initialise( );
 
-				SetAccumulator( ( GetAccumulator( ) >> 1 ) | ( msb << 7 ) );
-			}
-			break;
+	// Last time we did our 60Hz update.
+	Uint32 last60HzTime = SDL_GetTicks( );
 
-			// ------------------------------------------------------------
-			// Specials.
-			// ------------------------------------------------------------
-			case 0x2f:
-			{
-				// Accumulator is complimented.
-				// Cycles : 1
-				// States : 4
-				// Flags  : none
-				// Addressing : -
-				DumpDisassembly( "CMA" );
-				DumpInstruction( "accumulator ~= accumulator" );
-
-				SetAccumulator( ~ GetAccumulator( )  );
-			}
-			break;
+	// Display updates not drawn since the last one that was (see -frameskip), and the frame that was drawn.
+	Uint32 updatesSkipped = 0;
+	Uint32 drawnFrame = ~0u;
 
-			case 0x37:
-			{
-				// Carry is set to 1.
-				// Cycles : 1
-				// States : 4
-				// Flags  : CY
-				// Addressing : -
-				DumpDisassembly( "STC" );
-				DumpInstruction( "CARRY = 1" );
-
-				GetFlags( ).cy = 1;
-			}
-			break;
+	// Loop forever.
+	for ( ; ; )
+	{
+		// Get time (in milliseconds).
+		Uint32 timeNow = SDL_GetTicks( );
 
-			case 0x3f:
+		if ( ! api.IsRewinding( ) && IsInterruptDue( chip8 ) )
+		{
+			if ( chip8.NextInterrupt == Cpu8080::Interrupt::VBlankEnd )
 			{
-				// Carry flag is complimented.
-				// Cycles : 1
-				// States : 4
-				// Flags  : CY
-				// Addressing : -
-				DumpDisassembly( "CMC" );
-				DumpInstruction( "carry ~= carry" );
-
-				GetFlags( ).cy = 1 - GetFlags( ).cy;
+				while ( timeNow - last60HzTime <= 1000.f / 60.f )
+				{
+					SDL_Delay( 0 );
+					timeNow = SDL_GetTicks( );
+				}
 			}
-			break;
 
-			case 0x27:
+			// Need to do a VBLANK end interrupt when we can.
+			if ( RaiseInterrupt( chip8 ) )
 			{
-				// BCD accumulator.
-				// Cycles : 1
-				// States : 4
-				// Flags  : Z, S, P, CY, AC
-				// Addressing : -
-				DumpDisassembly( "DAA" );
-				DumpInstruction( "BCD accumulator" );
-
-				Uint16	acc = GetAccumulator( );
-
-				Uint8	low = acc & 0xf;
-				if ( ( low > 9 ) || GetFlags( ).ac )
-				{
-					low += 6;
-					acc += 6;
-				}
+				recorder.EndFrame( chip8 );
 
-				Uint8	high = ( acc >> 4 ) & 0xf;
-				if ( ( high > 9 ) || GetFlags( ).cy )
+				if ( rewind )
 				{
-					high += 6;
-					acc += ( 6 << 4 );
+					rewind->Capture( chip8 );
 				}
-
-				// Truncate, sort out flags after.
-				SetAccumulator( ( Uint8 )acc );
-
-				GetFlags( ).z = acc == 0;
-				GetFlags( ).s = acc >> 7;
-				GetFlags( ).p = ParityTable256[ acc & 0xff ];
-				GetFlags( ).cy = high > 0xf;
-				GetFlags( ).ac = low > 0xf;
 			}
-			break;
+		}
+
+		// If it has been 60Hz since our last update...
+		if ( timeNow - last60HzTime > 1000.f / 60.f )
+		{
+			// Update to know when next 60Hz timer should be issued.
+			last60HzTime = timeNow;
 
-			// ------------------------------------------------------------
-			// Input/output.
-			// ------------------------------------------------------------
-			case 0xdb:
+			// Show the frame we rewound to (if it has been decoded).
+			if ( rewind )
 			{
-				// Data from specified port stored into accumulator
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : direct
-				DumpDisassembly( "IN 0x%x", immediate );
-				DumpInstruction( "A = DataBus[ %d ]", immediate );
-
-				SetAccumulator( chip8.DataBusRead[ immediate ] );
-
-				// Skip over immediate we used this operation.
-				IncrementPc( );
+				rewind->FinishSeek( chip8 );
 			}
-			break;
 
-			case 0xd3:
+			// VRAM is only converted for updates that are shown, and only once per frame (nothing changes while paused).
+			if ( updatesSkipped >= displayFrameSkip && chip8.Frame != drawnFrame )
 			{
-				// Accumulator contents stored onto specified data port.
-				// Cycles : 3
-				// States : 10
-				// Flags  : none
-				// Addressing : direct
-				DumpDisassembly( "OUT 0x%x", immediate );
-				DumpInstruction( "DataBus[ %d ] = A", immediate );
-
-				chip8.DataBusWrite[ immediate ] = GetAccumulator( );
-
-				if ( immediate == 6 )
+				// Show where the current input will have got to a few frames from now,
+				// the game only reads it in its interrupt handlers so otherwise it takes
+				// a frame or two to show. The real machine carries on from where it was.
+				const Cpu8080 * shown = &chip8;
+				if ( runAheadFrames && ! api.IsRewinding( ) )
 				{
-					if ( GetAccumulator( ) < 32 )
+					s_RunAhead = chip8;
+					for ( Uint32 ix = 0; ix < runAheadFrames; ++ix )
 					{
-#if 0
-						if ( 'A' + GetAccumulator( ) == 'A' )
-						{
-							static int a = 5;
-							++a;
-						}
-						printf( "%c\n", 'A' + GetAccumulator( ) );
-#endif
+						RunFrame( s_RunAhead );
 					}
+					shown = &s_RunAhead;
 				}
 
-				// Skip over immediate we used this operation.
-				IncrementPc( );
-			}
-			break;
-
-			// ------------------------------------------------------------
-			// Control.
-			// ------------------------------------------------------------
-			case 0xfb:
-			{
-				// Enable interrupts.
-				// Cycles : 1
-				// States : 4
-				// Flags  : none
-				// Addressing : -
-				DumpDisassembly( "EI" );
-				DumpInstruction( "Enable interrupts (after next instruction)" );
-
-				// Set to 2, decremented and end of loop, then one more instruction, then decrement to 0 and interrupts enabled.
-				chip8.EnableInterruptsCountdown = 2;
-			}
-			break;
+				// Write image to screen.
+				api.DrawVram( &shown->Memory[ 0x2400 ] );
+				api.Present( );
 
-			case 0xf3:
-			{
-				// Disable interrupts.
-				// Cycles : 1
-				// States : 4
-				// Flags  : none
-				// Addressing : -
-				DumpDisassembly( "DI" );
-				DumpInstruction( "Disable interrupts (after next instruction)" );
-
-				// Set to 2, decremented and end of loop, then one more instruction, then decrement to 0 and interrupts disabled.
-				chip8.DisableInterruptsCountdown = 2;
+				drawnFrame = chip8.Frame;
+				updatesSkipped = 0;
 			}
-			break;
-
-			case 0x0:
+			else
 			{
-				// No operation.
-				// Cycles : 1
-				// States : 4
-				// Flags  : none
-				// Addressing : -
-				DumpDisassembly( "NOP" );
-				DumpInstruction( "No operation" );
+				updatesSkipped++;
 			}
-			break;
 
-			case 0x76:
-			{
-				// Halt.
-				// Cycles : 1
-				// States : 7
-				// Flags  : none
-				// Addressing : -
-				DumpDisassembly( "HLT" );
-				DumpInstruction( "No operation" );
-				assert( 0 );
-			}
-			break;
+			// Process keys, etc.
+			api.Tick( );
+			recorder.RecordInputs( chip8 );
 
-			default:
+			// Step back a frame every update while rewinding.
+			if ( rewind && api.IsRewinding( ) && ! rewind->IsSeeking( ) )
 			{
-				// Unsupported instruction.
-				assert( 0 );
+				rewind->StartSeek( chip8.Frame - 1 );
 			}
-			break;
 		}
 
-		// Update last instruction (for debugging).
-		lastInstruction = instruction;
-
-		// Jump forward to next instruction.
-		chip8.Cpu.Regs.pc += 1;
-
-		// Increment instruction counter.
-		instructionsProcessedSinceLast60Update++;
-
-		// Handle interrupt enable/disable.
-		if ( chip8.EnableInterruptsCountdown )
+		// The machine is paused while rewinding.
+		if ( api.IsRewinding( ) )
 		{
-			chip8.EnableInterruptsCountdown--;
-			if ( chip8.EnableInterruptsCountdown == 0 )
-			{
-				chip8.InterruptsEnabled = true;
-			}
-		}
-		if ( chip8.DisableInterruptsCountdown )
-		{
-			chip8.DisableInterruptsCountdown--;
-			if ( chip8.DisableInterruptsCountdown == 0 )
-			{
-				chip8.InterruptsEnabled = false;
-			}
+			SDL_Delay( 1 );
+			continue;
 		}
+
+		g_StepCpuEngine( chip8 );
 	}
 
+	delete rewind;
+
 	api.Destroy( );
 
 	return 0;